@@ -1,16 +1,25 @@
+#pragma once
+
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiPoint.h>
 #include <geos/geom/Polygon.h>
 #include <geos/geom/util/SineStarFactory.h>
+#include <geos/constants.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/util.h>
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <vector>
 
 namespace geos {
 namespace benchmark {
 
-std::unique_ptr<geom::Polygon>
+inline std::unique_ptr<geom::Polygon>
 createSineStar(const geom::CoordinateXY& origin, double size, std::size_t npts) {
     geom::util::SineStarFactory gsf(geom::GeometryFactory::getDefaultInstance());
     gsf.setCentre(origin);
@@ -45,7 +54,7 @@ createGeometriesOnGrid(const geom::Envelope& env, std::size_t nItems, Generator&
     return geoms;
 }
 
-std::unique_ptr<geom::Geometry>
+inline std::unique_ptr<geom::Geometry>
 createLine(const geom::CoordinateXY& base, double size, std::size_t npts) {
     geom::util::SineStarFactory gsf(geom::GeometryFactory::getDefaultInstance());
     gsf.setCentre(base);
@@ -58,27 +67,27 @@ createLine(const geom::CoordinateXY& base, double size, std::size_t npts) {
 }
 
 
-std::vector<std::unique_ptr<geom::Geometry>>
+inline std::vector<std::unique_ptr<geom::Geometry>>
 createPolygons(const geom::Envelope& env, std::size_t nItems, double size, std::size_t npts) {
     return createGeometriesOnGrid(env, nItems, [size, npts](const geom::CoordinateXY& base) {
         return createSineStar(base, size, npts);
     });
 }
-std::vector<std::unique_ptr<geom::Geometry>>
+inline std::vector<std::unique_ptr<geom::Geometry>>
 createLines(const geom::Envelope& env, std::size_t nItems, double size, std::size_t npts) {
     return createGeometriesOnGrid(env, nItems, [size, npts](const geom::CoordinateXY& base) {
         return createLine(base, size, npts);
     });
 }
 
-std::vector<std::unique_ptr<geom::Geometry>>
+inline std::vector<std::unique_ptr<geom::Geometry>>
 createPoints(const geom::Envelope& env, std::size_t nItems) {
     return createGeometriesOnGrid(env, nItems, [](const geom::CoordinateXY& base) {
         return geom::GeometryFactory::getDefaultInstance()->createPoint(base);
     });
 }
 
-std::unique_ptr<geom::CoordinateSequence>
+inline std::unique_ptr<geom::CoordinateSequence>
 createRandomCoords(const geom::Envelope& env, std::size_t npts, std::default_random_engine& e) {
     auto ret = detail::make_unique<geom::CoordinateSequence>(npts, true, true, false);
 
@@ -94,6 +103,196 @@ createRandomCoords(const geom::Envelope& env, std::size_t npts, std::default_ran
     return ret;
 }
 
+/**
+ * Creates a polygonal coverage of nx by ny cells, shaped like land parcels:
+ * the cell corners are perturbed grid nodes, and each cell edge is a wavy
+ * line of edgeVertices interior vertices which is shared exactly by the
+ * two cells it bounds.
+ */
+inline std::vector<std::unique_ptr<geom::Geometry>>
+createCoverage(const geom::Envelope& env, std::size_t nx, std::size_t ny,
+               std::size_t edgeVertices, unsigned int seed = 42) {
+    const auto& gfact = *geom::GeometryFactory::getDefaultInstance();
+    std::default_random_engine e(seed);
+    std::uniform_real_distribution<> jitter(-0.2, 0.2);
+    std::uniform_real_distribution<> wave(-0.08, 0.08);
+
+    double dx = env.getWidth() / static_cast<double>(nx);
+    double dy = env.getHeight() / static_cast<double>(ny);
+
+    // Nodes on the envelope boundary are not perturbed across it
+    std::vector<geom::CoordinateXY> nodes((nx + 1) * (ny + 1));
+    auto node = [&nodes, nx](std::size_t i, std::size_t j) -> geom::CoordinateXY& {
+        return nodes[j * (nx + 1) + i];
+    };
+    for (std::size_t j = 0; j <= ny; j++) {
+        for (std::size_t i = 0; i <= nx; i++) {
+            double x = env.getMinX() + static_cast<double>(i) * dx;
+            double y = env.getMinY() + static_cast<double>(j) * dy;
+            if (i > 0 && i < nx) x += jitter(e) * dx;
+            if (j > 0 && j < ny) y += jitter(e) * dy;
+            node(i, j) = geom::CoordinateXY(x, y);
+        }
+    }
+
+    // The vertices of an edge, excluding its end nodes. Edges on the
+    // envelope boundary are straight, so the coverage fills the envelope.
+    auto createEdge = [&](const geom::CoordinateXY& p0, const geom::CoordinateXY& p1, bool isBoundary) {
+        std::vector<geom::CoordinateXY> pts;
+        double len = p0.distance(p1);
+        double offset = 0;
+        for (std::size_t k = 1; k <= edgeVertices; k++) {
+            double t = static_cast<double>(k) / static_cast<double>(edgeVertices + 1);
+            offset = isBoundary ? 0 : 0.7 * offset + wave(e) * len;
+            // Offsets taper to zero at the nodes, so edges cannot cross there
+            double d = offset * std::sin(MATH_PI * t);
+            pts.emplace_back(p0.x + t * (p1.x - p0.x) - d * (p1.y - p0.y) / len,
+                             p0.y + t * (p1.y - p0.y) + d * (p1.x - p0.x) / len);
+        }
+        return pts;
+    };
+
+    std::vector<std::vector<geom::CoordinateXY>> hEdges(nx * (ny + 1));
+    std::vector<std::vector<geom::CoordinateXY>> vEdges((nx + 1) * ny);
+    for (std::size_t j = 0; j <= ny; j++) {
+        for (std::size_t i = 0; i < nx; i++) {
+            hEdges[j * nx + i] = createEdge(node(i, j), node(i + 1, j), j == 0 || j == ny);
+        }
+    }
+    for (std::size_t j = 0; j < ny; j++) {
+        for (std::size_t i = 0; i <= nx; i++) {
+            vEdges[j * (nx + 1) + i] = createEdge(node(i, j), node(i, j + 1), i == 0 || i == nx);
+        }
+    }
+
+    std::vector<std::unique_ptr<geom::Geometry>> cells;
+    cells.reserve(nx * ny);
+    for (std::size_t j = 0; j < ny; j++) {
+        for (std::size_t i = 0; i < nx; i++) {
+            auto seq = detail::make_unique<geom::CoordinateSequence>(0u, false, false);
+            seq->reserve(4 * (edgeVertices + 1) + 1);
+            const auto& bottom = hEdges[j * nx + i];
+            const auto& right = vEdges[j * (nx + 1) + i + 1];
+            const auto& top = hEdges[(j + 1) * nx + i];
+            const auto& left = vEdges[j * (nx + 1) + i];
+
+            seq->add(node(i, j));
+            for (const auto& p : bottom) seq->add(p);
+            seq->add(node(i + 1, j));
+            for (const auto& p : right) seq->add(p);
+            seq->add(node(i + 1, j + 1));
+            for (auto it = top.rbegin(); it != top.rend(); ++it) seq->add(*it);
+            seq->add(node(i, j + 1));
+            for (auto it = left.rbegin(); it != left.rend(); ++it) seq->add(*it);
+            seq->add(node(i, j));
+
+            cells.push_back(gfact.createPolygon(gfact.createLinearRing(std::move(seq))));
+        }
+    }
+    return cells;
+}
+
+/**
+ * Creates lines shaped like a road network: random walks of nVertices
+ * vertices whose heading changes gradually, which cross each other.
+ */
+inline std::vector<std::unique_ptr<geom::Geometry>>
+createRoads(const geom::Envelope& env, std::size_t nRoads, std::size_t nVertices,
+            unsigned int seed = 42) {
+    const auto& gfact = *geom::GeometryFactory::getDefaultInstance();
+    std::default_random_engine e(seed);
+    std::uniform_real_distribution<> xdist(env.getMinX(), env.getMaxX());
+    std::uniform_real_distribution<> ydist(env.getMinY(), env.getMaxY());
+    std::uniform_real_distribution<> headingDist(0, 2 * MATH_PI);
+    std::normal_distribution<> turn(0, 0.05);
+
+    double step = 2 * std::max(env.getWidth(), env.getHeight()) / static_cast<double>(nVertices);
+
+    std::vector<std::unique_ptr<geom::Geometry>> roads;
+    roads.reserve(nRoads);
+    for (std::size_t i = 0; i < nRoads; i++) {
+        auto seq = detail::make_unique<geom::CoordinateSequence>(0u, false, false);
+        seq->reserve(nVertices);
+        geom::CoordinateXY p(xdist(e), ydist(e));
+        double heading = headingDist(e);
+        for (std::size_t k = 0; k < nVertices; k++) {
+            seq->add(p);
+            heading += turn(e);
+            p.x += step * std::cos(heading);
+            p.y += step * std::sin(heading);
+            // Turn back into the envelope at its boundary
+            if (!env.covers(p.x, p.y)) {
+                heading += MATH_PI;
+                p.x = std::min(std::max(p.x, env.getMinX()), env.getMaxX());
+                p.y = std::min(std::max(p.y, env.getMinY()), env.getMaxY());
+            }
+        }
+        roads.push_back(gfact.createLineString(std::move(seq)));
+    }
+    return roads;
+}
+
+/**
+ * Creates a point cloud of nPoints points, normally distributed around
+ * nClusters random centres.
+ */
+inline std::unique_ptr<geom::Geometry>
+createPointCloud(const geom::Envelope& env, std::size_t nPoints, std::size_t nClusters,
+                 unsigned int seed = 42) {
+    std::default_random_engine e(seed);
+    std::uniform_real_distribution<> xdist(env.getMinX(), env.getMaxX());
+    std::uniform_real_distribution<> ydist(env.getMinY(), env.getMaxY());
+    double spread = std::min(env.getWidth(), env.getHeight()) / (4 * std::sqrt(static_cast<double>(nClusters)));
+    std::normal_distribution<> offset(0, spread);
+
+    std::vector<geom::CoordinateXY> centres;
+    for (std::size_t i = 0; i < nClusters; i++) {
+        centres.emplace_back(xdist(e), ydist(e));
+    }
+
+    geom::CoordinateSequence seq(0u, false, false);
+    seq.reserve(nPoints);
+    for (std::size_t i = 0; i < nPoints; i++) {
+        const auto& c = centres[i % nClusters];
+        seq.add(geom::CoordinateXY(c.x + offset(e), c.y + offset(e)));
+    }
+    return geom::GeometryFactory::getDefaultInstance()->createMultiPoint(seq);
+}
+
+/**
+ * Creates a polygon with a ring of npts vertices with an irregular,
+ * coastline-like shape. The ring is star-shaped around its centre,
+ * so the polygon is valid.
+ */
+inline std::unique_ptr<geom::Polygon>
+createIrregularPolygon(const geom::CoordinateXY& centre, double radius, std::size_t npts,
+                       unsigned int seed = 42) {
+    const auto& gfact = *geom::GeometryFactory::getDefaultInstance();
+    std::default_random_engine e(seed);
+    std::uniform_real_distribution<> phase(0, 2 * MATH_PI);
+    // Correlated noise, whose slope does not depend on npts
+    double angleStep = 2 * MATH_PI / static_cast<double>(npts);
+    std::normal_distribution<> noiseStep(0, 0.5 * angleStep);
+    double noise = 0;
+
+    // A few harmonics give large bays and headlands
+    double phases[] = { phase(e), phase(e), phase(e) };
+
+    auto seq = detail::make_unique<geom::CoordinateSequence>(0u, false, false);
+    seq->reserve(npts + 1);
+    for (std::size_t i = 0; i < npts; i++) {
+        double angle = angleStep * static_cast<double>(i);
+        noise = std::min(std::max(0.995 * noise + noiseStep(e), -0.05), 0.05);
+        double r = radius * (1 + 0.2 * std::sin(3 * angle + phases[0])
+                               + 0.1 * std::sin(11 * angle + phases[1])
+                               + 0.05 * std::sin(37 * angle + phases[2])
+                               + noise);
+        seq->add(geom::CoordinateXY(centre.x + r * std::cos(angle), centre.y + r * std::sin(angle)));
+    }
+    seq->closeRing();
+    return gfact.createPolygon(gfact.createLinearRing(std::move(seq)));
+}
+
 }
 }
 
@@ -64,6 +64,18 @@ static void BM_DelaunayFromGeom(benchmark::State& state) {
     }
 }
 
+static void BM_DelaunayPointCloud(benchmark::State& state) {
+    Envelope e(0, 100, 0, 100);
+    auto nPts = static_cast<std::size_t>(state.range(0));
+    auto sites = geos::benchmark::createPointCloud(e, nPts, 50);
+
+    for (auto _ : state) {
+        geos::triangulate::DelaunayTriangulationBuilder dtb;
+        dtb.setSites(*sites);
+        benchmark::DoNotOptimize(dtb.getSubdivision());
+    }
+}
+
 static void BM_VoronoiFromSeq(benchmark::State& state) {
     Envelope e(0, 100, 0, 100);
     auto gfact = geos::geom::GeometryFactory::getDefaultInstance();
@@ -118,6 +130,7 @@ static void BM_OrderedVoronoiFromGeom(benchmark::State& state) {
 
 BENCHMARK(BM_DelaunayFromSeq)->Range(10, 1e6);
 BENCHMARK(BM_DelaunayFromGeom)->Range(10, 1e6);
+BENCHMARK(BM_DelaunayPointCloud)->Range(1000, 1e6);
 BENCHMARK(BM_VoronoiFromSeq)->Range(10, 1e6);
 BENCHMARK(BM_VoronoiFromGeom)->Range(10, 1e6);
 BENCHMARK(BM_OrderedVoronoiFromGeom)->Range(10, 1e6);
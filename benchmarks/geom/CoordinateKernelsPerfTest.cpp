@@ -0,0 +1,122 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <geos/algorithm/CoordinateKernels.h>
+#include <geos/algorithm/RayCrossingCounter.h>
+#include <geos/constants.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+
+#include <cmath>
+
+using geos::algorithm::CoordinateKernels;
+using geos::algorithm::RayCrossingCounter;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::CoordinateXYZM;
+using geos::geom::Envelope;
+
+// Closed ring of n vertices on a wavy circle
+static CoordinateSequence makeRing(std::size_t n, bool hasZ) {
+    CoordinateSequence seq = hasZ ? CoordinateSequence::XYZ(0) : CoordinateSequence::XY(0);
+    seq.reserve(n + 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        double a = 2 * geos::MATH_PI * static_cast<double>(i) / static_cast<double>(n);
+        double r = 100 + std::sin(1000 * a);
+        seq.add(CoordinateXYZM(r * std::cos(a), r * std::sin(a), 1, 0));
+    }
+    seq.closeRing();
+    return seq;
+}
+
+/*
+ * Selects the instruction set given by the first argument of the
+ * benchmark, or skips the benchmark if it is not supported.
+ */
+static bool selectInstructionSet(benchmark::State& state) {
+    auto isa = static_cast<CoordinateKernels::InstructionSet>(state.range(0));
+    if (!CoordinateKernels::isSupported(isa)) {
+        state.SkipWithError("instruction set not supported");
+        return false;
+    }
+    CoordinateKernels::setInstructionSet(isa);
+    return true;
+}
+
+static void BM_Envelope(benchmark::State& state) {
+    auto seq = makeRing(static_cast<std::size_t>(state.range(2)), state.range(1) != 0);
+    if (!selectInstructionSet(state)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        Envelope env;
+        seq.expandEnvelope(env);
+        benchmark::DoNotOptimize(env);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(seq.size()));
+}
+
+static void BM_AreaOfRing(benchmark::State& state) {
+    auto seq = makeRing(static_cast<std::size_t>(state.range(2)), state.range(1) != 0);
+    if (!selectInstructionSet(state)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(CoordinateKernels::signedAreaOfRing(seq));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(seq.size()));
+}
+
+static void BM_LengthOfLine(benchmark::State& state) {
+    auto seq = makeRing(static_cast<std::size_t>(state.range(2)), state.range(1) != 0);
+    if (!selectInstructionSet(state)) {
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(CoordinateKernels::lengthOfLine(seq));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(seq.size()));
+}
+
+static void BM_LocatePointInRing(benchmark::State& state) {
+    auto seq = makeRing(static_cast<std::size_t>(state.range(2)), state.range(1) != 0);
+    if (!selectInstructionSet(state)) {
+        return;
+    }
+
+    CoordinateXY p(3, 7);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(RayCrossingCounter::locatePointInRing(p, seq));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(seq.size()));
+}
+
+// Arguments: instruction set (SCALAR, SSE2, AVX2, AVX512), hasZ, number of vertices
+#define GEOS_KERNEL_BENCHMARK(bm) \
+    BENCHMARK(bm)->ArgNames({"isa", "z", "n"}) \
+                 ->ArgsProduct({{0, 1, 2, 3}, {0, 1}, {10000, 1000000}}) \
+                 ->Unit(benchmark::kMicrosecond)
+
+GEOS_KERNEL_BENCHMARK(BM_Envelope);
+GEOS_KERNEL_BENCHMARK(BM_AreaOfRing);
+GEOS_KERNEL_BENCHMARK(BM_LengthOfLine);
+GEOS_KERNEL_BENCHMARK(BM_LocatePointInRing);
+
+BENCHMARK_MAIN();
@@ -14,8 +14,16 @@
 
 #include <benchmark/benchmark.h>
 
+#include <geos/algorithm/Area.h>
+#include <geos/algorithm/Length.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/constants.h>
 
+#include <cmath>
+
+using geos::algorithm::Area;
+using geos::algorithm::Length;
 using geos::geom::Coordinate;
 using geos::geom::CoordinateSequence;
 
@@ -48,9 +56,47 @@ static void BM_HasRepeatedPoints(benchmark::State & state) {
     }
 }
 
+// Ring of n points on a circle, with Z values if hasZ
+static CoordinateSequence makeRing(std::size_t n, bool hasZ) {
+    CoordinateSequence seq(n + 1, hasZ, false);
+    for (std::size_t i = 0; i < n; ++i) {
+        double a = 2 * geos::MATH_PI * static_cast<double>(i) / static_cast<double>(n);
+        seq.setAt(Coordinate(100 * std::cos(a), 100 * std::sin(a), 1), i);
+    }
+    seq.setAt(seq.getAt(0), n);
+    return seq;
+}
+
+static void BM_GetEnvelope(benchmark::State& state) {
+    auto seq = makeRing(static_cast<std::size_t>(state.range(0)), state.range(1) != 0);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(seq.getEnvelope());
+    }
+}
+
+static void BM_AreaOfRing(benchmark::State& state) {
+    auto seq = makeRing(static_cast<std::size_t>(state.range(0)), state.range(1) != 0);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Area::ofRingSigned(&seq));
+    }
+}
+
+static void BM_LengthOfLine(benchmark::State& state) {
+    auto seq = makeRing(static_cast<std::size_t>(state.range(0)), state.range(1) != 0);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Length::ofLine(&seq));
+    }
+}
+
 BENCHMARK(BM_Size);
 BENCHMARK(BM_Initialize);
 BENCHMARK(BM_HasRepeatedPoints);
+BENCHMARK(BM_GetEnvelope)->ArgsProduct({{100, 10000}, {0, 1}});
+BENCHMARK(BM_AreaOfRing)->ArgsProduct({{100, 10000}, {0, 1}});
+BENCHMARK(BM_LengthOfLine)->ArgsProduct({{100, 10000}, {0, 1}});
 
 BENCHMARK_MAIN();
 
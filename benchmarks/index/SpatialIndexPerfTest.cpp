@@ -12,6 +12,7 @@
  *
  **********************************************************************/
 
+#include <atomic>
 #include <random>
 
 #include <benchmark/benchmark.h>
@@ -241,6 +242,23 @@ static void BM_STRtree2DConstruct(benchmark::State& state) {
     }
 }
 
+static void BM_STRtree2DBuild(benchmark::State& state) {
+    std::default_random_engine eng(12345);
+    Envelope extent(0, 1, 0, 1);
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto numThreads = static_cast<std::size_t>(state.range(1));
+    auto envelopes = generate_envelopes(eng, extent, n);
+
+    for (auto _ : state) {
+        TemplateSTRtree<const Envelope*> tree(10, n, numThreads);
+        for (auto& e : envelopes) {
+            tree.insert(e, &e);
+        }
+        tree.build();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
 template<class Tree>
 static void BM_STRtree2DQuery(benchmark::State& state) {
     std::default_random_engine eng(12345);
@@ -283,6 +301,56 @@ static void BM_STRtree2DQueryPairs(benchmark::State& state) {
     }
 }
 
+static void BM_STRtree2DJoin(benchmark::State& state) {
+    std::default_random_engine eng(12345);
+    Envelope extent(0, 1, 0, 1);
+    auto envelopes1 = generate_envelopes(eng, extent, 100000);
+    auto envelopes2 = generate_envelopes(eng, extent, 100000);
+
+    TemplateSTRtree<const Envelope*> tree1;
+    TemplateSTRtree<const Envelope*> tree2;
+    for (auto& e : envelopes1) {
+        tree1.insert(e, &e);
+    }
+    for (auto& e : envelopes2) {
+        tree2.insert(e, &e);
+    }
+    tree1.build();
+    tree2.build();
+
+    auto numThreads = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        std::atomic<std::size_t> hits(0);
+        tree1.join(tree2, [&hits](const Envelope*, const Envelope*) {
+            hits.fetch_add(1, std::memory_order_relaxed);
+        }, numThreads);
+        benchmark::DoNotOptimize(hits.load());
+    }
+}
+
+static void BM_STRtree2DJoinNaive(benchmark::State& state) {
+    std::default_random_engine eng(12345);
+    Envelope extent(0, 1, 0, 1);
+    auto envelopes1 = generate_envelopes(eng, extent, 100000);
+    auto envelopes2 = generate_envelopes(eng, extent, 100000);
+
+    TemplateSTRtree<const Envelope*> tree2;
+    for (auto& e : envelopes2) {
+        tree2.insert(e, &e);
+    }
+    tree2.build();
+
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (auto& e : envelopes1) {
+            tree2.query(e, [&hits](const Envelope*) {
+                hits++;
+            });
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+}
+
 static void BM_STRtree2DQueryPairsNaive(benchmark::State& state) {
     std::default_random_engine eng(12345);
     Envelope extent(0, 1, 0, 1);
@@ -335,6 +403,29 @@ static void BM_STRtree2DNearest(benchmark::State& state) {
     }
 }
 
+static void BM_STRtree2DNearestK(benchmark::State& state) {
+    std::default_random_engine eng(12345);
+    Envelope extent(0, 1, 0, 1);
+    auto envelopes = generate_envelopes(eng, extent, 10000);
+    auto queryPoints = generate_uniform_points(eng, extent, 1000);
+    auto k = static_cast<std::size_t>(state.range(0));
+
+    TemplateSTRtree<const Envelope*> tree;
+    for (auto& e : envelopes) {
+        tree.insert(e, &e);
+    }
+    tree.build();
+
+    EnvelopeDistance dist;
+    for (auto _ : state) {
+        for (const auto& pt : queryPoints) {
+            Envelope e(pt);
+            auto found = tree.nearestNeighbours(e, &e, k, dist);
+            benchmark::DoNotOptimize(found.data());
+        }
+    }
+}
+
 BENCHMARK_TEMPLATE(BM_STRtree1DConstruct, SortedPackedIntervalRTree);
 BENCHMARK_TEMPLATE(BM_STRtree1DConstruct, TemplateIntervalTree);
 BENCHMARK_TEMPLATE(BM_STRtree1DQuery, SortedPackedIntervalRTree);
@@ -345,9 +436,16 @@ BENCHMARK_TEMPLATE(BM_STRtree2DConstruct, STRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DConstruct, SimpleSTRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DConstruct, TemplateSTRtree<const Envelope*>);
 
+// Bulk-loading with a single thread, and with all hardware threads
+BENCHMARK(BM_STRtree2DBuild)
+    ->ArgNames({"n", "threads"})
+    ->ArgsProduct({{1000000, 10000000, 100000000}, {1, 0}})
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_TEMPLATE(BM_STRtree2DNearest, STRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DNearest, SimpleSTRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DNearest, TemplateSTRtree<const Envelope*>);
+BENCHMARK(BM_STRtree2DNearestK)->ArgName("k")->Arg(1)->Arg(10)->Arg(100);
 
 BENCHMARK_TEMPLATE(BM_STRtree2DQuery, Quadtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DQuery, STRtree);
@@ -357,5 +455,8 @@ BENCHMARK_TEMPLATE(BM_STRtree2DQuery, TemplateSTRtree<const Envelope*>);
 BENCHMARK(BM_STRtree2DQueryPairs);
 BENCHMARK(BM_STRtree2DQueryPairsNaive);
 
+BENCHMARK(BM_STRtree2DJoin)->ArgName("threads")->Arg(1)->Arg(0)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_STRtree2DJoinNaive)->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
 
@@ -0,0 +1,98 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/GeoJSON.h>
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/io/GeoJSONWriter.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::GeometryFactory;
+using geos::io::GeoJSONFeature;
+using geos::io::GeoJSONValue;
+
+// Features with a LineString of n random points and a few properties
+static std::vector<GeoJSONFeature> makeFeatures(std::size_t numFeatures, std::size_t n) {
+    auto gfact = GeometryFactory::getDefaultInstance();
+
+    std::default_random_engine eng(12345);
+    std::uniform_real_distribution<double> dist(-180, 180);
+
+    std::vector<GeoJSONFeature> features;
+    for (std::size_t i = 0; i < numFeatures; i++) {
+        auto seq = std::make_unique<CoordinateSequence>(0u, false, false);
+        for (std::size_t j = 0; j < n; j++) {
+            seq->add(CoordinateXY(dist(eng), dist(eng)));
+        }
+        std::map<std::string, GeoJSONValue> properties {
+            { "name", GeoJSONValue(std::string("feature ") + std::to_string(i)) },
+            { "value", GeoJSONValue(dist(eng)) }
+        };
+        features.emplace_back(gfact->createLineString(std::move(seq)), std::move(properties), std::to_string(i));
+    }
+    return features;
+}
+
+static void BM_GeoJSONWriter(benchmark::State& state) {
+    auto features = makeFeatures(static_cast<std::size_t>(state.range(0)),
+                                 static_cast<std::size_t>(state.range(1)));
+    geos::io::GeoJSONFeatureCollection collection(std::move(features));
+
+    geos::io::GeoJSONWriter writer;
+    for (auto _ : state) {
+        std::ostringstream os;
+        os << writer.write(collection);
+        benchmark::DoNotOptimize(os.tellp());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_GeoJSONStreamWriter(benchmark::State& state) {
+    auto features = makeFeatures(static_cast<std::size_t>(state.range(0)),
+                                 static_cast<std::size_t>(state.range(1)));
+
+    for (auto _ : state) {
+        std::ostringstream os;
+        geos::io::GeoJSONStreamWriter writer(os);
+        writer.beginFeatureCollection();
+        for (const auto& feature : features) {
+            writer.writeFeature(feature);
+        }
+        writer.endFeatureCollection();
+        benchmark::DoNotOptimize(os.tellp());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_GeoJSONWriter)
+    ->ArgNames({"features", "n"})
+    ->ArgsProduct({{1000}, {10, 1000}});
+
+BENCHMARK(BM_GeoJSONStreamWriter)
+    ->ArgNames({"features", "n"})
+    ->ArgsProduct({{1000}, {10, 1000}});
+
+BENCHMARK_MAIN();
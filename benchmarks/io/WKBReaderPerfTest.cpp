@@ -0,0 +1,70 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKBConstants.h>
+#include <geos/io/WKBReader.h>
+#include <geos/io/WKBWriter.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXYZM;
+using geos::geom::GeometryFactory;
+namespace WKBConstants = geos::io::WKBConstants;
+
+// WKB of a LineString of n points, with Z values if hasZ
+static std::string makeLineWKB(std::size_t n, bool hasZ, int byteOrder) {
+    auto gfact = GeometryFactory::getDefaultInstance();
+
+    auto seq = std::make_unique<CoordinateSequence>(0u, hasZ, false);
+    for (std::size_t i = 0; i < n; i++) {
+        double d = static_cast<double>(i);
+        seq->add(CoordinateXYZM(d, d * 0.5, d * 2, 0));
+    }
+    auto line = gfact->createLineString(std::move(seq));
+
+    geos::io::WKBWriter writer(3, byteOrder);
+    std::stringstream wkb;
+    writer.write(*line, wkb);
+    return wkb.str();
+}
+
+static void BM_ReadLineString(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    bool hasZ = state.range(1);
+    int byteOrder = state.range(2) ? WKBConstants::wkbNDR : WKBConstants::wkbXDR;
+
+    std::string wkb = makeLineWKB(n, hasZ, byteOrder);
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(wkb.data());
+
+    geos::io::WKBReader reader;
+    for (auto _ : state) {
+        auto g = reader.read(bytes, wkb.size());
+        benchmark::DoNotOptimize(g.get());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+BENCHMARK(BM_ReadLineString)
+    ->ArgNames({"n", "z", "ndr"})
+    ->ArgsProduct({{10, 1000, 100000}, {0, 1}, {0, 1}});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,99 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+
+#include <memory>
+#include <random>
+#include <string>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXYZM;
+using geos::geom::Geometry;
+using geos::geom::GeometryFactory;
+
+// A LineString of n points with random coordinates, with Z values if hasZ
+static std::unique_ptr<Geometry> makeLine(std::size_t n, bool hasZ) {
+    auto gfact = GeometryFactory::getDefaultInstance();
+
+    std::default_random_engine eng(12345);
+    std::uniform_real_distribution<double> dist(-180, 180);
+
+    auto seq = std::make_unique<CoordinateSequence>(0u, hasZ, false);
+    for (std::size_t i = 0; i < n; i++) {
+        seq->add(CoordinateXYZM(dist(eng), dist(eng), dist(eng), 0));
+    }
+    return gfact->createLineString(std::move(seq));
+}
+
+static std::string makeLineWKT(std::size_t n, bool hasZ, int precision) {
+    geos::io::WKTWriter writer;
+    writer.setOutputDimension(hasZ ? 3 : 2);
+    if (precision >= 0) {
+        writer.setRoundingPrecision(precision);
+    }
+    return writer.write(*makeLine(n, hasZ));
+}
+
+static void BM_ReadLineString(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    bool hasZ = state.range(1);
+    int precision = static_cast<int>(state.range(2));
+
+    std::string wkt = makeLineWKT(n, hasZ, precision);
+
+    geos::io::WKTReader reader;
+    for (auto _ : state) {
+        auto g = reader.read(wkt);
+        benchmark::DoNotOptimize(g.get());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(wkt.size()));
+}
+
+static void BM_WriteLineString(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    bool hasZ = state.range(1);
+    int precision = static_cast<int>(state.range(2));
+
+    auto line = makeLine(n, hasZ);
+
+    geos::io::WKTWriter writer;
+    writer.setOutputDimension(hasZ ? 3 : 2);
+    if (precision >= 0) {
+        writer.setRoundingPrecision(precision);
+    }
+    for (auto _ : state) {
+        auto wkt = writer.write(*line);
+        benchmark::DoNotOptimize(wkt.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+// Precision -1 uses the default precision of the writer
+BENCHMARK(BM_ReadLineString)
+    ->ArgNames({"n", "z", "precision"})
+    ->ArgsProduct({{10, 1000, 100000}, {0, 1}, {-1, 6}});
+
+BENCHMARK(BM_WriteLineString)
+    ->ArgNames({"n", "z", "precision"})
+    ->ArgsProduct({{10, 1000, 100000}, {0, 1}, {-1, 6}});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,25 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+/*
+ * Entry point of perf_suite, a single benchmark program covering the main
+ * operations of GEOS on generated data of realistic shape.
+ *
+ * The input data is created with fixed seeds, so results of different
+ * builds can be compared with compare_benchmarks.py. See the README.
+ */
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
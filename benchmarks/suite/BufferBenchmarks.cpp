@@ -0,0 +1,80 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkUtils.h>
+#include <geos/geom/Geometry.h>
+#include <geos/operation/buffer/BufferOp.h>
+
+using geos::geom::CoordinateXY;
+using geos::geom::Envelope;
+using geos::operation::buffer::BufferOp;
+
+// Buffer of each road of a network
+static void BM_BufferRoads(benchmark::State& state) {
+    auto nVertices = static_cast<std::size_t>(state.range(0));
+
+    auto roads = geos::benchmark::createRoads(Envelope(0, 100, 0, 100), 20, nVertices);
+
+    for (auto _ : state) {
+        for (const auto& road : roads) {
+            auto result = BufferOp::bufferOp(road.get(), 0.2);
+            benchmark::DoNotOptimize(result.get());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(roads.size()));
+}
+
+// Positive and negative buffers of an irregular polygon
+static void BM_BufferPolygon(benchmark::State& state) {
+    auto npts = static_cast<std::size_t>(state.range(0));
+    double distance = static_cast<double>(state.range(1));
+
+    auto poly = geos::benchmark::createIrregularPolygon(CoordinateXY(0, 0), 100, npts);
+
+    for (auto _ : state) {
+        auto result = BufferOp::bufferOp(poly.get(), distance);
+        benchmark::DoNotOptimize(result.get());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Buffer of a point cloud, which unions the circles around the points
+static void BM_BufferPoints(benchmark::State& state) {
+    auto npts = static_cast<std::size_t>(state.range(0));
+
+    auto cloud = geos::benchmark::createPointCloud(Envelope(0, 100, 0, 100), npts, 10);
+
+    for (auto _ : state) {
+        auto result = BufferOp::bufferOp(cloud.get(), 0.2);
+        benchmark::DoNotOptimize(result.get());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_BufferRoads)
+    ->ArgName("n")
+    ->Arg(100)->Arg(1000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_BufferPolygon)
+    ->ArgNames({"n", "distance"})
+    ->ArgsProduct({{1000, 100000}, {-5, 5}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_BufferPoints)
+    ->ArgName("n")
+    ->Arg(1000)->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
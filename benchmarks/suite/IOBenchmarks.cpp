@@ -0,0 +1,128 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkUtils.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/GeoJSONReader.h>
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/io/GeoJSONWriter.h>
+#include <geos/io/WKBReader.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+
+#include <sstream>
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::GeometryFactory;
+
+// The formats read and written
+enum Format { WKB, WKT, GEOJSON, GEOJSON_STREAM };
+
+// A coverage of 50 x 50 parcels, as a MultiPolygon of 210,000 vertices
+static std::unique_ptr<Geometry> createIOData() {
+    const auto& gfact = *GeometryFactory::getDefaultInstance();
+    auto cells = geos::benchmark::createCoverage(Envelope(0, 100, 0, 100), 50, 50, 20);
+    return gfact.createMultiPolygon(std::move(cells));
+}
+
+static std::string write(const Geometry& g, Format format) {
+    std::ostringstream os;
+    switch (format) {
+    case WKB: {
+        geos::io::WKBWriter writer;
+        writer.write(g, os);
+        break;
+    }
+    case WKT: {
+        geos::io::WKTWriter writer;
+        os << writer.write(g);
+        break;
+    }
+    case GEOJSON: {
+        geos::io::GeoJSONWriter writer;
+        os << writer.write(&g);
+        break;
+    }
+    case GEOJSON_STREAM: {
+        geos::io::GeoJSONStreamWriter writer(os);
+        writer.writeGeometry(g);
+        break;
+    }
+    }
+    return os.str();
+}
+
+static void BM_Write(benchmark::State& state) {
+    auto format = static_cast<Format>(state.range(0));
+    auto g = createIOData();
+
+    std::size_t size = 0;
+    for (auto _ : state) {
+        size = write(*g, format).size();
+        benchmark::DoNotOptimize(size);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+static void BM_Read(benchmark::State& state) {
+    auto format = static_cast<Format>(state.range(0));
+    std::string text = write(*createIOData(), format);
+
+    for (auto _ : state) {
+        std::unique_ptr<Geometry> g;
+        switch (format) {
+        case WKB: {
+            geos::io::WKBReader reader;
+            g = reader.read(reinterpret_cast<const unsigned char*>(text.data()), text.size());
+            break;
+        }
+        case WKT: {
+            geos::io::WKTReader reader;
+            g = reader.read(text);
+            break;
+        }
+        case GEOJSON: {
+            geos::io::GeoJSONReader reader;
+            g = reader.read(text);
+            break;
+        }
+        case GEOJSON_STREAM: {
+            geos::io::GeoJSONStreamReader reader;
+            std::istringstream is(text);
+            reader.readGeometries(is, [&g](std::unique_ptr<Geometry>&& geom) {
+                g = std::move(geom);
+            });
+            break;
+        }
+        }
+        benchmark::DoNotOptimize(g.get());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+
+BENCHMARK(BM_Write)
+    ->ArgName("format")
+    ->DenseRange(WKB, GEOJSON_STREAM)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_Read)
+    ->ArgName("format")
+    ->DenseRange(WKB, GEOJSON_STREAM)
+    ->Unit(benchmark::kMillisecond);
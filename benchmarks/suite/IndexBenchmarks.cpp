@@ -0,0 +1,88 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkUtils.h>
+#include <geos/geom/Geometry.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::index::strtree::TemplateSTRtree;
+
+// The envelopes of the segments of a road network of n vertices
+static std::vector<Envelope> createSegmentEnvelopes(std::size_t n) {
+    auto roads = geos::benchmark::createRoads(Envelope(0, 100, 0, 100), 100, n / 100);
+    std::vector<Envelope> envs;
+    envs.reserve(n);
+    for (const auto& road : roads) {
+        auto pts = road->getCoordinates();
+        for (std::size_t i = 1; i < pts->size(); i++) {
+            envs.emplace_back(pts->getAt<geos::geom::CoordinateXY>(i - 1),
+                              pts->getAt<geos::geom::CoordinateXY>(i));
+        }
+    }
+    return envs;
+}
+
+// Build of an STRtree of road segments
+static void BM_STRtreeBuild(benchmark::State& state) {
+    auto envs = createSegmentEnvelopes(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        TemplateSTRtree<std::size_t> tree(10, envs.size());
+        for (std::size_t i = 0; i < envs.size(); i++) {
+            tree.insert(envs[i], i);
+        }
+        tree.build();
+        benchmark::DoNotOptimize(tree.getRoot());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(envs.size()));
+}
+
+// Queries of an STRtree of road segments with the points of a cloud
+static void BM_STRtreeQuery(benchmark::State& state) {
+    auto envs = createSegmentEnvelopes(static_cast<std::size_t>(state.range(0)));
+    auto cloud = geos::benchmark::createPointCloud(Envelope(0, 100, 0, 100), 100000, 20);
+
+    TemplateSTRtree<std::size_t> tree(10, envs.size());
+    for (std::size_t i = 0; i < envs.size(); i++) {
+        tree.insert(envs[i], i);
+    }
+    tree.build();
+
+    for (auto _ : state) {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < cloud->getNumGeometries(); i++) {
+            Envelope queryEnv(*cloud->getGeometryN(i)->getEnvelopeInternal());
+            queryEnv.expandBy(0.1);
+            tree.query(queryEnv, [&count](std::size_t) {
+                count++;
+            });
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(cloud->getNumGeometries()));
+}
+
+BENCHMARK(BM_STRtreeBuild)
+    ->ArgName("n")
+    ->Arg(10000)->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_STRtreeQuery)
+    ->ArgName("n")
+    ->Arg(10000)->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
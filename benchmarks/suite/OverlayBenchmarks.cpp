@@ -0,0 +1,68 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkUtils.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+
+using geos::geom::CoordinateXY;
+using geos::geom::Envelope;
+using geos::geom::GeometryFactory;
+using geos::operation::overlayng::OverlayNG;
+using geos::operation::overlayng::OverlayNGRobust;
+
+// Overlay of two overlapping irregular polygons of n vertices
+static void BM_OverlayPolygons(benchmark::State& state) {
+    auto npts = static_cast<std::size_t>(state.range(0));
+    int opCode = static_cast<int>(state.range(1));
+
+    auto a = geos::benchmark::createIrregularPolygon(CoordinateXY(0, 0), 100, npts, 1);
+    auto b = geos::benchmark::createIrregularPolygon(CoordinateXY(50, 20), 100, npts, 2);
+
+    for (auto _ : state) {
+        auto result = OverlayNGRobust::Overlay(a.get(), b.get(), opCode);
+        benchmark::DoNotOptimize(result.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+
+// Intersection of a coverage of n x n parcels with an irregular polygon
+static void BM_OverlayCoverage(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    const auto& gfact = *GeometryFactory::getDefaultInstance();
+
+    auto cells = geos::benchmark::createCoverage(Envelope(0, 100, 0, 100), n, n, 10);
+    auto coverage = gfact.createMultiPolygon(std::move(cells));
+    auto clip = geos::benchmark::createIrregularPolygon(CoordinateXY(50, 50), 40, 10000);
+
+    for (auto _ : state) {
+        auto result = OverlayNGRobust::Overlay(coverage.get(), clip.get(), OverlayNG::INTERSECTION);
+        benchmark::DoNotOptimize(result.get());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n));
+}
+
+BENCHMARK(BM_OverlayPolygons)
+    ->ArgNames({"n", "op"})
+    ->ArgsProduct({{1000, 10000, 100000}, {OverlayNG::INTERSECTION, OverlayNG::UNION, OverlayNG::DIFFERENCE}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_OverlayCoverage)
+    ->ArgName("n")
+    ->Arg(10)->Arg(50)
+    ->Unit(benchmark::kMillisecond);
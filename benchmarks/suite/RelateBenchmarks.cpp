@@ -0,0 +1,101 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkUtils.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Point.h>
+#include <geos/operation/relateng/RelateNG.h>
+#include <geos/operation/relateng/RelatePredicate.h>
+
+using geos::geom::CoordinateXY;
+using geos::geom::Envelope;
+using geos::operation::relateng::RelateNG;
+using geos::operation::relateng::RelatePredicate;
+
+// Prepared intersects of an irregular polygon with the points of a cloud
+static void BM_RelatePreparedPoints(benchmark::State& state) {
+    auto npts = static_cast<std::size_t>(state.range(0));
+
+    auto poly = geos::benchmark::createIrregularPolygon(CoordinateXY(50, 50), 40, npts);
+    auto cloud = geos::benchmark::createPointCloud(Envelope(0, 100, 0, 100), 10000, 20);
+
+    for (auto _ : state) {
+        auto rel = RelateNG::prepare(poly.get());
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < cloud->getNumGeometries(); i++) {
+            auto pred = RelatePredicate::intersects();
+            if (rel->evaluate(cloud->getGeometryN(i), *pred)) {
+                count++;
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(cloud->getNumGeometries()));
+}
+
+// Full intersection matrix of roads against the parcels of a coverage
+static void BM_RelateRoadsCoverage(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+
+    Envelope env(0, 100, 0, 100);
+    auto cells = geos::benchmark::createCoverage(env, n, n, 10);
+    auto roads = geos::benchmark::createRoads(env, 10, 1000);
+
+    for (auto _ : state) {
+        for (const auto& road : roads) {
+            for (const auto& cell : cells) {
+                auto im = RelateNG::relate(cell.get(), road.get());
+                benchmark::DoNotOptimize(im.get());
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(roads.size() * cells.size()));
+}
+
+// Covers of a polygon and a road network
+static void BM_RelateCoversRoads(benchmark::State& state) {
+    auto npts = static_cast<std::size_t>(state.range(0));
+
+    Envelope env(0, 100, 0, 100);
+    auto poly = geos::benchmark::createIrregularPolygon(CoordinateXY(50, 50), 60, npts);
+    auto roads = geos::benchmark::createRoads(env, 100, 1000);
+
+    for (auto _ : state) {
+        std::size_t count = 0;
+        for (const auto& road : roads) {
+            if (RelateNG::covers(poly.get(), road.get())) {
+                count++;
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(roads.size()));
+}
+
+BENCHMARK(BM_RelatePreparedPoints)
+    ->ArgName("n")
+    ->Arg(1000)->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_RelateRoadsCoverage)
+    ->ArgName("n")
+    ->Arg(10)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_RelateCoversRoads)
+    ->ArgName("n")
+    ->Arg(1000)->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
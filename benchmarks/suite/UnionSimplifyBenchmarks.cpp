@@ -0,0 +1,127 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkUtils.h>
+#include <geos/coverage/CoverageSimplifier.h>
+#include <geos/coverage/CoverageUnion.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/operation/union/UnaryUnionOp.h>
+#include <geos/simplify/DouglasPeuckerSimplifier.h>
+#include <geos/simplify/TopologyPreservingSimplifier.h>
+
+using geos::geom::Envelope;
+using geos::geom::GeometryFactory;
+
+// Unary union of a coverage of n x n parcels
+static void BM_UnaryUnionCoverage(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    const auto& gfact = *GeometryFactory::getDefaultInstance();
+
+    auto cells = geos::benchmark::createCoverage(Envelope(0, 100, 0, 100), n, n, 10);
+    auto coll = gfact.createGeometryCollection(std::move(cells));
+
+    for (auto _ : state) {
+        auto result = geos::operation::geounion::UnaryUnionOp::Union(static_cast<const geos::geom::Geometry&>(*coll));
+        benchmark::DoNotOptimize(result.get());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n));
+}
+
+// Coverage union of a coverage of n x n parcels
+static void BM_CoverageUnion(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    const auto& gfact = *GeometryFactory::getDefaultInstance();
+
+    auto cells = geos::benchmark::createCoverage(Envelope(0, 100, 0, 100), n, n, 10);
+    auto coll = gfact.createGeometryCollection(std::move(cells));
+
+    for (auto _ : state) {
+        auto result = geos::coverage::CoverageUnion::Union(coll.get());
+        benchmark::DoNotOptimize(result.get());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n));
+}
+
+// Topology-preserving simplification of a coverage as a MultiPolygon
+static void BM_TopologyPreservingSimplifyCoverage(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    const auto& gfact = *GeometryFactory::getDefaultInstance();
+
+    auto cells = geos::benchmark::createCoverage(Envelope(0, 100, 0, 100), n, n, 20);
+    auto coverage = gfact.createMultiPolygon(std::move(cells));
+    double tolerance = 10.0 / static_cast<double>(n);
+
+    for (auto _ : state) {
+        auto result = geos::simplify::TopologyPreservingSimplifier::simplify(coverage.get(), tolerance);
+        benchmark::DoNotOptimize(result.get());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n));
+}
+
+// Simplification of a coverage preserving its shared edges
+static void BM_CoverageSimplify(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+
+    auto cells = geos::benchmark::createCoverage(Envelope(0, 100, 0, 100), n, n, 20);
+    double tolerance = 10.0 / static_cast<double>(n);
+
+    for (auto _ : state) {
+        auto result = geos::coverage::CoverageSimplifier::simplify(cells, tolerance);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n * n));
+}
+
+// Douglas-Peucker simplification of roads
+static void BM_DouglasPeuckerSimplifyRoads(benchmark::State& state) {
+    auto nVertices = static_cast<std::size_t>(state.range(0));
+
+    auto roads = geos::benchmark::createRoads(Envelope(0, 100, 0, 100), 20, nVertices);
+
+    for (auto _ : state) {
+        for (const auto& road : roads) {
+            auto result = geos::simplify::DouglasPeuckerSimplifier::simplify(road.get(), 0.5);
+            benchmark::DoNotOptimize(result.get());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(roads.size() * nVertices));
+}
+
+BENCHMARK(BM_UnaryUnionCoverage)
+    ->ArgName("n")
+    ->Arg(10)->Arg(50)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_CoverageUnion)
+    ->ArgName("n")
+    ->Arg(10)->Arg(50)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_TopologyPreservingSimplifyCoverage)
+    ->ArgName("n")
+    ->Arg(10)->Arg(30)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_CoverageSimplify)
+    ->ArgName("n")
+    ->Arg(10)->Arg(30)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_DouglasPeuckerSimplifyRoads)
+    ->ArgName("n")
+    ->Arg(1000)->Arg(100000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+################################################################################
+# Part of GEOS benchmarks
+#
+# Copyright (C) 2025 GEOS contributors
+#
+# This is free software; you can redistribute and/or modify it under
+# the terms of the GNU Lesser General Public Licence as published
+# by the Free Software Foundation.
+# See the COPYING file for more information.
+################################################################################
+"""
+Compares two JSON outputs of a google-benchmark program, such as
+perf_suite run with --benchmark_out=FILE --benchmark_out_format=json,
+and reports the benchmarks which are slower in the second one.
+
+When the benchmarks were run with --benchmark_repetitions, the median
+of the repetitions is compared.
+
+The exit status is 1 if any benchmark is slower by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path, metric):
+    """Returns the time in nanoseconds of each benchmark of a file."""
+    with open(path) as f:
+        runs = json.load(f)["benchmarks"]
+
+    times = {}
+    has_median = any(r.get("aggregate_name") == "median" for r in runs)
+    for r in runs:
+        if r.get("error_occurred"):
+            continue
+        if has_median:
+            if r.get("aggregate_name") != "median":
+                continue
+            name = r["run_name"]
+        else:
+            if r.get("run_type") == "aggregate":
+                continue
+            name = r["name"]
+        times[name] = r[metric] * UNIT_NS[r.get("time_unit", "ns")]
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="JSON output of the baseline build")
+    parser.add_argument("contender", help="JSON output of the build to compare")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="relative slowdown reported as a regression (default 0.10)")
+    parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="cpu_time",
+                        help="time compared (default cpu_time)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    contender = load(args.contender, args.metric)
+
+    regressions = []
+    width = max((len(name) for name in baseline), default=10)
+    print("{:<{w}}  {:>14}  {:>14}  {:>8}".format("Benchmark", "Baseline (us)", "Contender (us)", "Change", w=width))
+    for name, base in baseline.items():
+        if name not in contender:
+            print("{:<{w}}  {:>14.1f}  {:>14}".format(name, base / 1e3, "missing", w=width))
+            continue
+        new = contender[name]
+        change = (new - base) / base if base > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            regressions.append(name)
+            flag = "  REGRESSION"
+        print("{:<{w}}  {:>14.1f}  {:>14.1f}  {:>+7.1%}{}".format(name, base / 1e3, new / 1e3, change, flag, w=width))
+
+    for name in contender:
+        if name not in baseline:
+            print("{:<{w}}  {:>14}  {:>14.1f}".format(name, "missing", contender[name] / 1e3, w=width))
+
+    if regressions:
+        print("\n{} benchmark(s) slower by more than {:.0%}".format(len(regressions), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
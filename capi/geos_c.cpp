@@ -16,6 +16,7 @@
  ***********************************************************************/
 
 #include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/index/strtree/STRtreeSnapshot.h>
 #include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKBReader.h>
@@ -25,6 +26,7 @@
 #include <geos/io/GeoJSONWriter.h>
 #include <geos/operation/buffer/BufferParameters.h>
 #include <geos/operation/cluster/Clusters.h>
+#include <geos/triangulate/TriangleMesh.h>
 #include <geos/util/Interrupt.h>
 
 #include <stdexcept>
@@ -45,6 +47,8 @@
 #define GEOSCoordSequence geos::geom::CoordinateSequence
 #define GEOSBufferParams geos::operation::buffer::BufferParameters
 #define GEOSSTRtree geos::index::strtree::TemplateSTRtree<void*>
+#define GEOSSTRtreeSnapshot geos::index::strtree::STRtreeSnapshot
+#define GEOSTriangleMesh geos::triangulate::TriangleMesh
 #define GEOSWKTReader geos::io::WKTReader
 #define GEOSWKTWriter geos::io::WKTWriter
 #define GEOSWKBReader geos::io::WKBReader
@@ -676,6 +680,12 @@ extern "C" {
         return GEOSUnaryUnionPrec_r(handle, g, gridSize);
     }
 
+    Geometry*
+    GEOSUnaryUnionParallel(const Geometry* g, unsigned int numThreads)
+    {
+        return GEOSUnaryUnionParallel_r(handle, g, numThreads);
+    }
+
     Geometry*
     GEOSCoverageUnion(const Geometry* g)
     {
@@ -1588,6 +1598,12 @@ extern "C" {
         return GEOSPrepare_r(handle, g);
     }
 
+    const geos::geom::prep::PreparedGeometry*
+    GEOSPrepareShared(const Geometry* g)
+    {
+        return GEOSPrepareShared_r(handle, g);
+    }
+
     void
     GEOSPreparedGeom_destroy(const geos::geom::prep::PreparedGeometry* a)
     {
@@ -1648,6 +1664,38 @@ extern "C" {
         return GEOSPreparedIntersectsXY_r(handle, pg1, x, y);
     }
 
+    int
+    GEOSPreparedContainsBatch(const geos::geom::prep::PreparedGeometry* pg1,
+                              const Geometry* const* geoms, unsigned int ngeoms,
+                              unsigned char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedContainsBatch_r(handle, pg1, geoms, ngeoms, results, numThreads);
+    }
+
+    int
+    GEOSPreparedContainsXYBatch(const geos::geom::prep::PreparedGeometry* pg1,
+                                const double* x, const double* y, unsigned int npoints,
+                                unsigned char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedContainsXYBatch_r(handle, pg1, x, y, npoints, results, numThreads);
+    }
+
+    int
+    GEOSPreparedIntersectsBatch(const geos::geom::prep::PreparedGeometry* pg1,
+                                const Geometry* const* geoms, unsigned int ngeoms,
+                                unsigned char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedIntersectsBatch_r(handle, pg1, geoms, ngeoms, results, numThreads);
+    }
+
+    int
+    GEOSPreparedIntersectsXYBatch(const geos::geom::prep::PreparedGeometry* pg1,
+                                  const double* x, const double* y, unsigned int npoints,
+                                  unsigned char* results, unsigned int numThreads)
+    {
+        return GEOSPreparedIntersectsXYBatch_r(handle, pg1, x, y, npoints, results, numThreads);
+    }
+
     char
     GEOSPreparedOverlaps(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2)
     {
@@ -1741,6 +1789,38 @@ extern "C" {
         return GEOSSTRtree_nearest_generic_r(handle, tree, item, itemEnvelope, distancefn, userdata);
     }
 
+    int
+    GEOSSTRtree_nearestK(GEOSSTRtree* tree,
+                         const void* item,
+                         const GEOSGeometry* itemEnvelope,
+                         unsigned int k,
+                         double maxDistance,
+                         GEOSDistanceCallback distancefn,
+                         void* userdata,
+                         const void** results,
+                         double* distances)
+    {
+        return GEOSSTRtree_nearestK_r(handle, tree, item, itemEnvelope, k, maxDistance,
+                                      distancefn, userdata, results, distances);
+    }
+
+    int
+    GEOSSTRtree_nearestKBatch(GEOSSTRtree* tree,
+                              const GEOSGeometry* const* geoms,
+                              unsigned int ngeoms,
+                              unsigned int k,
+                              double maxDistance,
+                              GEOSDistanceCallback distancefn,
+                              void* userdata,
+                              const void** results,
+                              double* distances,
+                              unsigned int* counts,
+                              unsigned int numThreads)
+    {
+        return GEOSSTRtree_nearestKBatch_r(handle, tree, geoms, ngeoms, k, maxDistance,
+                                           distancefn, userdata, results, distances, counts, numThreads);
+    }
+
     void
     GEOSSTRtree_iterate(GEOSSTRtree* tree,
                         GEOSQueryCallback callback,
@@ -1763,6 +1843,33 @@ extern "C" {
         GEOSSTRtree_destroy_r(handle, tree);
     }
 
+    int
+    GEOSSTRtree_writeSnapshot(GEOSSTRtree* tree, const char* path)
+    {
+        return GEOSSTRtree_writeSnapshot_r(handle, tree, path);
+    }
+
+    GEOSSTRtreeSnapshot*
+    GEOSSTRtreeSnapshot_open(const char* path)
+    {
+        return GEOSSTRtreeSnapshot_open_r(handle, path);
+    }
+
+    void
+    GEOSSTRtreeSnapshot_query(const GEOSSTRtreeSnapshot* snapshot,
+                              const geos::geom::Geometry* g,
+                              GEOSQueryCallback cb,
+                              void* userdata)
+    {
+        GEOSSTRtreeSnapshot_query_r(handle, snapshot, g, cb, userdata);
+    }
+
+    void
+    GEOSSTRtreeSnapshot_destroy(GEOSSTRtreeSnapshot* snapshot)
+    {
+        GEOSSTRtreeSnapshot_destroy_r(handle, snapshot);
+    }
+
     double
     GEOSProject(const geos::geom::Geometry* g,
                 const geos::geom::Geometry* p)
@@ -1925,6 +2032,54 @@ extern "C" {
         return GEOSConstrainedDelaunayTriangulation_r(handle, g);
     }
 
+    GEOSTriangleMesh*
+    GEOSDelaunayTriangulationMesh(const Geometry* g, double tolerance)
+    {
+        return GEOSDelaunayTriangulationMesh_r(handle, g, tolerance);
+    }
+
+    GEOSTriangleMesh*
+    GEOSConstrainedDelaunayTriangulationMesh(const Geometry* g)
+    {
+        return GEOSConstrainedDelaunayTriangulationMesh_r(handle, g);
+    }
+
+    std::size_t
+    GEOSTriangleMesh_getNumVertices(const GEOSTriangleMesh* mesh)
+    {
+        return GEOSTriangleMesh_getNumVertices_r(handle, mesh);
+    }
+
+    const CoordinateSequence*
+    GEOSTriangleMesh_getVertices(const GEOSTriangleMesh* mesh)
+    {
+        return GEOSTriangleMesh_getVertices_r(handle, mesh);
+    }
+
+    std::size_t
+    GEOSTriangleMesh_getNumTriangles(const GEOSTriangleMesh* mesh)
+    {
+        return GEOSTriangleMesh_getNumTriangles_r(handle, mesh);
+    }
+
+    const int*
+    GEOSTriangleMesh_getTriangles(const GEOSTriangleMesh* mesh)
+    {
+        return GEOSTriangleMesh_getTriangles_r(handle, mesh);
+    }
+
+    const int*
+    GEOSTriangleMesh_getNeighbours(const GEOSTriangleMesh* mesh)
+    {
+        return GEOSTriangleMesh_getNeighbours_r(handle, mesh);
+    }
+
+    void
+    GEOSTriangleMesh_destroy(GEOSTriangleMesh* mesh)
+    {
+        GEOSTriangleMesh_destroy_r(handle, mesh);
+    }
+
     Geometry*
     GEOSVoronoiDiagram(const Geometry* g, const Geometry* env, double tolerance, int flags)
     {
@@ -1951,11 +2106,28 @@ extern "C" {
         return GEOSCoverageIsValid_r(handle, input, gapWidth, invalidEdges);
     }
 
+    int
+    GEOSCoverageIsValidParallel(
+        const Geometry* input,
+        double gapWidth,
+        Geometry** invalidEdges,
+        unsigned int numThreads)
+    {
+        return GEOSCoverageIsValidParallel_r(handle, input, gapWidth, invalidEdges, numThreads);
+    }
+
     Geometry*
     GEOSCoverageSimplifyVW(const Geometry* input, double tolerance, int preserveBoundary)
     {
         return GEOSCoverageSimplifyVW_r(handle, input, tolerance, preserveBoundary);
     }
 
+    Geometry*
+    GEOSCoverageSimplifyVWParallel(const Geometry* input, double tolerance, int preserveBoundary,
+                                   unsigned int numThreads)
+    {
+        return GEOSCoverageSimplifyVWParallel_r(handle, input, tolerance, preserveBoundary, numThreads);
+    }
+
 
 } /* extern "C" */
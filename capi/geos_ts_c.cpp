@@ -55,10 +55,12 @@
 #include <geos/geom/PrecisionModel.h>
 #include <geos/geom/SimpleCurve.h>
 #include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryBatch.h>
 #include <geos/geom/prep/PreparedGeometryFactory.h>
 #include <geos/geom/util/Densifier.h>
 #include <geos/geom/util/GeometryFixer.h>
 #include <geos/index/ItemVisitor.h>
+#include <geos/index/strtree/STRtreeSnapshot.h>
 #include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKBWriter.h>
@@ -106,11 +108,16 @@
 #include <geos/simplify/PolygonHullSimplifier.h>
 #include <geos/simplify/TopologyPreservingSimplifier.h>
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/TriangleMesh.h>
 #include <geos/triangulate/VoronoiDiagramBuilder.h>
 #include <geos/triangulate/polygon/ConstrainedDelaunayTriangulator.h>
 #include <geos/util.h>
+#include <geos/util/Arena.h>
 #include <geos/util/IllegalArgumentException.h>
+#include <geos/util/IllegalStateException.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/PhaseProfiler.h>
+#include <geos/util/ThreadPool.h>
 #include <geos/util/UniqueCoordinateArrayFilter.h>
 #include <geos/util/Machine.h>
 #include <geos/version.h>
@@ -119,6 +126,7 @@
 #include <cmath> // finite
 #include <cstdarg>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -143,6 +151,8 @@
 #define GEOSClusterInfo geos::operation::cluster::Clusters
 #define GEOSBufferParams geos::operation::buffer::BufferParameters
 #define GEOSSTRtree geos::index::strtree::TemplateSTRtree<void*>
+#define GEOSSTRtreeSnapshot geos::index::strtree::STRtreeSnapshot
+#define GEOSTriangleMesh geos::triangulate::TriangleMesh
 #define GEOSWKTReader geos::io::WKTReader
 #define GEOSWKTWriter geos::io::WKTWriter
 #define GEOSWKBReader geos::io::WKBReader
@@ -191,6 +201,7 @@ using geos::geom::MultiPolygon;
 using geos::geom::Point;
 using geos::geom::Polygon;
 using geos::geom::PrecisionModel;
+using geos::geom::prep::PreparedGeometryBatch;
 using geos::geom::SimpleCurve;
 using geos::geom::Surface;
 
@@ -237,6 +248,8 @@ typedef struct GEOSContextHandle_HS {
     int WKBByteOrder;
     int initialized;
     std::unique_ptr<Point> point2d;
+    std::unique_ptr<geos::util::Arena> arena;
+    std::unique_ptr<geos::util::PhaseProfiler> profiler;
 
     GEOSContextHandle_HS()
         :
@@ -384,6 +397,62 @@ public:
 };
 
 
+// CAPI_ItemDistance computes the distance between STRtree items
+// using a user-supplied callback.
+struct CAPI_ItemDistance {
+    CAPI_ItemDistance(GEOSDistanceCallback p_distancefn, void* p_userdata)
+        : m_distancefn(p_distancefn), m_userdata(p_userdata) {}
+
+    GEOSDistanceCallback m_distancefn;
+    void* m_userdata;
+
+    double operator()(const void* a, const void* b) const
+    {
+        double d;
+
+        if(!m_distancefn(a, b, &d, m_userdata)) {
+            throw std::runtime_error(std::string("Failed to compute distance."));
+        }
+
+        return d;
+    }
+};
+
+// CAPI_GeometryDistance computes the distance between STRtree
+// items that are geometries.
+struct CAPI_GeometryDistance {
+    double operator()(void* a, void* b) const {
+        return static_cast<const Geometry*>(a)->distance(static_cast<const Geometry*>(b));
+    }
+};
+
+// Finds up to k items of an STRtree nearest to an item, within
+// maxDistance if it is not negative, storing them and their
+// distances, and returning the number found.
+template<typename ItemDistance>
+unsigned int
+CAPI_nearestK(GEOSSTRtree& tree, const void* item, const geos::geom::Envelope& itemEnvelope,
+              unsigned int k, double maxDistance, ItemDistance& itemDistance,
+              const void** results, double* distances)
+{
+    unsigned int found = 0;
+    if (k == 0) {
+        return found;
+    }
+    if (maxDistance < 0) {
+        maxDistance = geos::DoubleInfinity;
+    }
+    tree.visitNearest(itemEnvelope, const_cast<void*>(item), itemDistance, maxDistance,
+    [&](void* const& nearest, double distance) {
+        results[found] = nearest;
+        if (distances) {
+            distances[found] = distance;
+        }
+        return ++found < k;
+    });
+    return found;
+}
+
 //## PROTOTYPES #############################################
 
 extern "C" const char GEOS_DLL* GEOSjtsport();
@@ -438,6 +507,9 @@ inline auto execute(
         return errval;
     }
 
+    geos::util::Arena::Scope arenaScope(handle->arena.get());
+    geos::util::PhaseProfiler::Scope profilerScope(handle->profiler.get());
+
     try {
         return f();
     } catch (const std::exception& e) {
@@ -462,6 +534,9 @@ inline auto execute(GEOSContextHandle_t extHandle, F&& f) -> decltype(f()) {
         return nullptr;
     }
 
+    geos::util::Arena::Scope arenaScope(handle->arena.get());
+    geos::util::PhaseProfiler::Scope profilerScope(handle->profiler.get());
+
     try {
         return f();
     } catch (const std::exception& e) {
@@ -478,6 +553,9 @@ inline auto execute(GEOSContextHandle_t extHandle, F&& f) -> decltype(f()) {
 template<typename F, typename std::enable_if<std::is_void<decltype(std::declval<F>()())>::value, std::nullptr_t>::type = nullptr>
 inline void execute(GEOSContextHandle_t extHandle, F&& f) {
     GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+    geos::util::Arena::Scope arenaScope(handle ? handle->arena.get() : nullptr);
+    geos::util::PhaseProfiler::Scope profilerScope(handle ? handle->profiler.get() : nullptr);
+
     try {
         f();
     } catch (const std::exception& e) {
@@ -556,6 +634,94 @@ extern "C" {
         return handle->setErrorHandler(ef, userData);
     }
 
+    int
+    GEOSContext_setArenaEnabled_r(GEOSContextHandle_t extHandle, int enabled)
+    {
+        // A disabled arena is destroyed once it is no longer active
+        std::unique_ptr<geos::util::Arena> disabled;
+
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            if (!enabled) {
+                disabled = std::move(handle->arena);
+            }
+            else if (!handle->arena) {
+                handle->arena.reset(new geos::util::Arena());
+            }
+            return 1;
+        });
+    }
+
+    int
+    GEOSContext_resetArena_r(GEOSContextHandle_t extHandle)
+    {
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            if (!handle->arena) {
+                throw geos::util::IllegalStateException("Arena allocation is not enabled");
+            }
+            handle->arena->reset();
+            return 1;
+        });
+    }
+
+    int
+    GEOSContext_setProfilingEnabled_r(GEOSContextHandle_t extHandle, int enabled)
+    {
+        // A disabled profiler is destroyed once it is no longer active
+        std::unique_ptr<geos::util::PhaseProfiler> disabled;
+
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            if (!enabled) {
+                disabled = std::move(handle->profiler);
+            }
+            else if (!handle->profiler) {
+                handle->profiler.reset(new geos::util::PhaseProfiler());
+            }
+            return 1;
+        });
+    }
+
+    int
+    GEOSContext_getProfilingCounters_r(GEOSContextHandle_t extHandle, int phase,
+                                       const char** name, unsigned long long* count, double* seconds)
+    {
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            if (!handle->profiler) {
+                throw geos::util::IllegalStateException("Profiling is not enabled");
+            }
+            if (phase < 0 || phase >= geos::util::PhaseProfiler::NUM_PHASES) {
+                throw IllegalArgumentException("Invalid profiling phase");
+            }
+            auto p = static_cast<geos::util::PhaseProfiler::Phase>(phase);
+            if (name) {
+                *name = geos::util::PhaseProfiler::getPhaseName(p);
+            }
+            if (count) {
+                *count = handle->profiler->getCount(p);
+            }
+            if (seconds) {
+                *seconds = std::chrono::duration<double>(handle->profiler->getTime(p)).count();
+            }
+            return 1;
+        });
+    }
+
+    int
+    GEOSContext_resetProfiling_r(GEOSContextHandle_t extHandle)
+    {
+        return execute(extHandle, 0, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            if (!handle->profiler) {
+                throw geos::util::IllegalStateException("Profiling is not enabled");
+            }
+            handle->profiler->reset();
+            return 1;
+        });
+    }
+
     void
     finishGEOS_r(GEOSContextHandle_t extHandle)
     {
@@ -1677,6 +1843,16 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSUnaryUnionParallel_r(GEOSContextHandle_t extHandle, const Geometry* g, unsigned int numThreads)
+    {
+        return execute(extHandle, [&]() {
+            auto g3 = OverlayNGRobust::Union(g, numThreads);
+            g3->setSRID(g->getSRID());
+            return g3.release();
+        });
+    }
+
     Geometry*
     GEOSNode_r(GEOSContextHandle_t extHandle, const Geometry* g)
     {
@@ -3760,6 +3936,14 @@ extern "C" {
         });
     }
 
+    const geos::geom::prep::PreparedGeometry*
+    GEOSPrepareShared_r(GEOSContextHandle_t extHandle, const Geometry* g)
+    {
+        return execute(extHandle, [&]() {
+            return geos::geom::prep::PreparedGeometryFactory::prepareShared(g).release();
+        });
+    }
+
     void
     GEOSPreparedGeom_destroy_r(GEOSContextHandle_t extHandle, const geos::geom::prep::PreparedGeometry* a)
     {
@@ -3849,6 +4033,54 @@ extern "C" {
         return GEOSPreparedIntersects_r(extHandle, pg, extHandle->point2d.get());
     }
 
+    int
+    GEOSPreparedContainsBatch_r(GEOSContextHandle_t extHandle,
+                                const geos::geom::prep::PreparedGeometry* pg,
+                                const Geometry* const* geoms, unsigned int ngeoms,
+                                unsigned char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            PreparedGeometryBatch::contains(*pg, geoms, ngeoms, results, numThreads);
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedContainsXYBatch_r(GEOSContextHandle_t extHandle,
+                                  const geos::geom::prep::PreparedGeometry* pg,
+                                  const double* x, const double* y, unsigned int npoints,
+                                  unsigned char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            PreparedGeometryBatch::containsXY(*pg, x, y, npoints, results, numThreads);
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedIntersectsBatch_r(GEOSContextHandle_t extHandle,
+                                  const geos::geom::prep::PreparedGeometry* pg,
+                                  const Geometry* const* geoms, unsigned int ngeoms,
+                                  unsigned char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            PreparedGeometryBatch::intersects(*pg, geoms, ngeoms, results, numThreads);
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedIntersectsXYBatch_r(GEOSContextHandle_t extHandle,
+                                    const geos::geom::prep::PreparedGeometry* pg,
+                                    const double* x, const double* y, unsigned int npoints,
+                                    unsigned char* results, unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            PreparedGeometryBatch::intersectsXY(*pg, x, y, npoints, results, numThreads);
+            return 1;
+        });
+    }
+
     char
     GEOSPreparedOverlaps_r(GEOSContextHandle_t extHandle,
                            const geos::geom::prep::PreparedGeometry* pg, const Geometry* g)
@@ -3989,41 +4221,79 @@ extern "C" {
                                   GEOSDistanceCallback distancefn,
                                   void* userdata)
     {
-        using namespace geos::index::strtree;
-
-        struct CustomItemDistance {
-            CustomItemDistance(GEOSDistanceCallback p_distancefn, void* p_userdata)
-                : m_distancefn(p_distancefn), m_userdata(p_userdata) {}
-
-            GEOSDistanceCallback m_distancefn;
-            void* m_userdata;
-
-            double operator()(const void* a, const void* b) const
-            {
-                double d;
-
-                if(!m_distancefn(a, b, &d, m_userdata)) {
-                    throw std::runtime_error(std::string("Failed to compute distance."));
-                }
-
-                return d;
+        return execute(extHandle, [&]() {
+            if(distancefn) {
+                CAPI_ItemDistance itemDistance(distancefn, userdata);
+                return tree->nearestNeighbour(*itemEnvelope->getEnvelopeInternal(), (void*) item, itemDistance);
             }
-        };
-
-        struct GeometryDistance {
-            double operator()(void* a, void* b) const {
-                return static_cast<const Geometry*>(a)->distance(static_cast<const Geometry*>(b));
+            else {
+                return tree->nearestNeighbour<CAPI_GeometryDistance>(*itemEnvelope->getEnvelopeInternal(), (void*) item);
             }
-        };
+        });
+    }
 
-        return execute(extHandle, [&]() {
+    int
+    GEOSSTRtree_nearestK_r(GEOSContextHandle_t extHandle,
+                           GEOSSTRtree* tree,
+                           const void* item,
+                           const geos::geom::Geometry* itemEnvelope,
+                           unsigned int k,
+                           double maxDistance,
+                           GEOSDistanceCallback distancefn,
+                           void* userdata,
+                           const void** results,
+                           double* distances)
+    {
+        return execute(extHandle, -1, [&]() {
+            const Envelope& env = *itemEnvelope->getEnvelopeInternal();
+            unsigned int found;
             if(distancefn) {
-                CustomItemDistance itemDistance(distancefn, userdata);
-                return tree->nearestNeighbour(*itemEnvelope->getEnvelopeInternal(), (void*) item, itemDistance);
+                CAPI_ItemDistance itemDistance(distancefn, userdata);
+                found = CAPI_nearestK(*tree, item, env, k, maxDistance, itemDistance, results, distances);
             }
             else {
-                return tree->nearestNeighbour<GeometryDistance>(*itemEnvelope->getEnvelopeInternal(), (void*) item);
+                CAPI_GeometryDistance itemDistance;
+                found = CAPI_nearestK(*tree, item, env, k, maxDistance, itemDistance, results, distances);
             }
+            return static_cast<int>(found);
+        });
+    }
+
+    int
+    GEOSSTRtree_nearestKBatch_r(GEOSContextHandle_t extHandle,
+                                GEOSSTRtree* tree,
+                                const geos::geom::Geometry* const* geoms,
+                                unsigned int ngeoms,
+                                unsigned int k,
+                                double maxDistance,
+                                GEOSDistanceCallback distancefn,
+                                void* userdata,
+                                const void** results,
+                                double* distances,
+                                unsigned int* counts,
+                                unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            // Build the tree before querying it from several threads
+            tree->build();
+
+            geos::util::ThreadPool pool(numThreads);
+            pool.parallelFor(ngeoms, [&](std::size_t i) {
+                const Geometry* g = geoms[i];
+                const void** itemResults = results + i * k;
+                double* itemDistances = distances ? distances + i * k : nullptr;
+                if(distancefn) {
+                    CAPI_ItemDistance itemDistance(distancefn, userdata);
+                    counts[i] = CAPI_nearestK(*tree, g, *g->getEnvelopeInternal(), k, maxDistance,
+                                              itemDistance, itemResults, itemDistances);
+                }
+                else {
+                    CAPI_GeometryDistance itemDistance;
+                    counts[i] = CAPI_nearestK(*tree, g, *g->getEnvelopeInternal(), k, maxDistance,
+                                              itemDistance, itemResults, itemDistances);
+                }
+            });
+            return 1;
         });
     }
 
@@ -4058,6 +4328,57 @@ extern "C" {
         });
     }
 
+    int
+    GEOSSTRtree_writeSnapshot_r(GEOSContextHandle_t extHandle,
+                                GEOSSTRtree* tree,
+                                const char* path)
+    {
+        return execute(extHandle, 0, [&]() {
+            std::ofstream os(path, std::ios::binary);
+            if (!os) {
+                throw std::runtime_error(std::string("Cannot open ") + path);
+            }
+            geos::index::strtree::STRtreeSnapshot::write(*tree, os);
+            os.close();
+            if (!os) {
+                throw std::runtime_error(std::string("Error writing ") + path);
+            }
+            return 1;
+        });
+    }
+
+    GEOSSTRtreeSnapshot*
+    GEOSSTRtreeSnapshot_open_r(GEOSContextHandle_t extHandle,
+                               const char* path)
+    {
+        return execute(extHandle, [&]() {
+            return GEOSSTRtreeSnapshot::open(path).release();
+        });
+    }
+
+    void
+    GEOSSTRtreeSnapshot_query_r(GEOSContextHandle_t extHandle,
+                                const GEOSSTRtreeSnapshot* snapshot,
+                                const geos::geom::Geometry* g,
+                                GEOSQueryCallback callback,
+                                void* userdata)
+    {
+        execute(extHandle, [&]() {
+            snapshot->query(*g->getEnvelopeInternal(), [callback, userdata](std::uint64_t id) {
+                callback(reinterpret_cast<void*>(static_cast<std::uintptr_t>(id)), userdata);
+            });
+        });
+    }
+
+    void
+    GEOSSTRtreeSnapshot_destroy_r(GEOSContextHandle_t extHandle,
+                                  GEOSSTRtreeSnapshot* snapshot)
+    {
+        return execute(extHandle, [&]() {
+            delete snapshot;
+        });
+    }
+
     double
     GEOSProject_r(GEOSContextHandle_t extHandle,
                   const Geometry* g,
@@ -4373,6 +4694,94 @@ extern "C" {
         });
     }
 
+    GEOSTriangleMesh*
+    GEOSDelaunayTriangulationMesh_r(GEOSContextHandle_t extHandle, const Geometry* g1, double tolerance)
+    {
+        using geos::triangulate::DelaunayTriangulationBuilder;
+
+        return execute(extHandle, [&]() {
+            DelaunayTriangulationBuilder builder;
+            builder.setTolerance(tolerance);
+            builder.setSites(*g1);
+
+            auto mesh = builder.getTriangleMesh();
+            // compute the neighbours now, so that the accessors are const
+            mesh->getNeighbours();
+            return mesh.release();
+        });
+    }
+
+    GEOSTriangleMesh*
+    GEOSConstrainedDelaunayTriangulationMesh_r(GEOSContextHandle_t extHandle, const Geometry* g1)
+    {
+        using geos::triangulate::polygon::ConstrainedDelaunayTriangulator;
+
+        return execute(extHandle, [&]() {
+            auto mesh = ConstrainedDelaunayTriangulator::triangulateToMesh(g1);
+            mesh->getNeighbours();
+            return mesh.release();
+        });
+    }
+
+    std::size_t
+    GEOSTriangleMesh_getNumVertices_r(GEOSContextHandle_t extHandle, const GEOSTriangleMesh* mesh)
+    {
+        return execute(extHandle, 0, [&]() -> std::size_t {
+            return mesh->getNumVertices();
+        });
+    }
+
+    const CoordinateSequence*
+    GEOSTriangleMesh_getVertices_r(GEOSContextHandle_t extHandle, const GEOSTriangleMesh* mesh)
+    {
+        return execute(extHandle, [&]() {
+            return &mesh->getVertices();
+        });
+    }
+
+    std::size_t
+    GEOSTriangleMesh_getNumTriangles_r(GEOSContextHandle_t extHandle, const GEOSTriangleMesh* mesh)
+    {
+        return execute(extHandle, 0, [&]() -> std::size_t {
+            return mesh->getNumTriangles();
+        });
+    }
+
+    static_assert(sizeof(int) == sizeof(std::int32_t), "TriangleMesh indices are returned as int");
+
+    // The indices of a mesh as an array, which is not null for an
+    // empty mesh, since null signals an error
+    static const int*
+    meshIndices(const std::vector<std::int32_t>& indices)
+    {
+        static const int noIndices[1] = { 0 };
+        return indices.empty() ? noIndices : reinterpret_cast<const int*>(indices.data());
+    }
+
+    const int*
+    GEOSTriangleMesh_getTriangles_r(GEOSContextHandle_t extHandle, const GEOSTriangleMesh* mesh)
+    {
+        return execute(extHandle, [&]() {
+            return meshIndices(mesh->getTriangles());
+        });
+    }
+
+    const int*
+    GEOSTriangleMesh_getNeighbours_r(GEOSContextHandle_t extHandle, const GEOSTriangleMesh* mesh)
+    {
+        return execute(extHandle, [&]() {
+            return meshIndices(mesh->getNeighbours());
+        });
+    }
+
+    void
+    GEOSTriangleMesh_destroy_r(GEOSContextHandle_t extHandle, GEOSTriangleMesh* mesh)
+    {
+        return execute(extHandle, [&]() {
+            delete mesh;
+        });
+    }
+
     Geometry*
     GEOSVoronoiDiagram_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* env, double tolerance,
                          int flags)
@@ -4427,6 +4836,16 @@ extern "C" {
         const Geometry* input,
         double gapWidth,
         Geometry** invalidEdges)
+    {
+        return GEOSCoverageIsValidParallel_r(extHandle, input, gapWidth, invalidEdges, 1);
+    }
+
+    int
+    GEOSCoverageIsValidParallel_r(GEOSContextHandle_t extHandle,
+        const Geometry* input,
+        double gapWidth,
+        Geometry** invalidEdges,
+        unsigned int numThreads)
     {
         using geos::coverage::CoverageValidator;
 
@@ -4445,6 +4864,7 @@ extern "C" {
 
             CoverageValidator cov(coverage);
             cov.setGapWidth(gapWidth);
+            cov.setNumThreads(numThreads);
             std::vector<std::unique_ptr<Geometry>> invalid = cov.validate();
             bool hasInvalid = CoverageValidator::hasInvalidResult(invalid);
 
@@ -4470,6 +4890,16 @@ extern "C" {
         const Geometry* input,
         double tolerance,
         int preserveBoundary)
+    {
+        return GEOSCoverageSimplifyVWParallel_r(extHandle, input, tolerance, preserveBoundary, 1);
+    }
+
+    Geometry*
+    GEOSCoverageSimplifyVWParallel_r(GEOSContextHandle_t extHandle,
+        const Geometry* input,
+        double tolerance,
+        int preserveBoundary,
+        unsigned int numThreads)
     {
         using geos::coverage::CoverageSimplifier;
 
@@ -4483,6 +4913,7 @@ extern "C" {
                 coverage.push_back(g.get());
             }
             CoverageSimplifier cov(coverage);
+            cov.setNumThreads(numThreads);
             std::vector<std::unique_ptr<Geometry>> simple;
             if (preserveBoundary == 1) {
                 simple = cov.simplifyInner(tolerance);
@@ -68,6 +68,10 @@ public:
     * ring is oriented CW, negative if the ring is oriented CCW, and zero if the
     * ring is degenerate or flat.
     *
+    * The terms are summed serially. CoordinateKernels::signedAreaOfRing
+    * computes the same area faster on long rings, but may differ from it
+    * in the last bits.
+    *
     * @param ring
     *          the coordinates forming the ring
     * @return the signed area of the ring
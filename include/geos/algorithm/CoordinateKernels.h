@@ -0,0 +1,132 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class CoordinateXY;
+}
+}
+
+namespace geos {
+namespace algorithm { // geos::algorithm
+
+/** \brief
+ * Vectorized implementations of the inner loops of common
+ * computations over a [CoordinateSequence](@ref geom::CoordinateSequence).
+ *
+ * On x86-64 processors compiled with GCC or Clang, the kernels are
+ * implemented with SSE2, AVX2 and AVX-512 instructions, and the best
+ * instruction set supported by the processor is selected at runtime.
+ * On other platforms a portable scalar implementation is used.
+ *
+ * Sums are accumulated in eight partial sums in a fixed order, by the
+ * vector and scalar implementations alike, so that the results of the
+ * kernels do not depend on the instruction set used. Since floating-point
+ * addition is not associative, they are not bit-identical to a serial
+ * sum of the same terms.
+ */
+class GEOS_DLL CoordinateKernels {
+
+public:
+
+    enum class InstructionSet {
+        SCALAR,
+        SSE2,
+        AVX2,
+        AVX512
+    };
+
+    /**
+     * Tests whether an instruction set is supported by
+     * the processor and by this build of the library.
+     */
+    static bool isSupported(InstructionSet isa);
+
+    /**
+     * Gets the instruction set used by the kernels.
+     * By default this is the best supported instruction set.
+     */
+    static InstructionSet getInstructionSet();
+
+    /**
+     * Sets the instruction set used by the kernels, for all threads.
+     * Intended for testing and benchmarking.
+     *
+     * @throws util::IllegalArgumentException if the instruction set is not supported
+     */
+    static void setInstructionSet(InstructionSet isa);
+
+    /**
+     * Computes the minimum and maximum X and Y ordinates of the points
+     * of a sequence starting at a given index. NaN ordinates are ignored.
+     * If there is no non-NaN value, the minimum is `+Inf` and the
+     * maximum is `-Inf`.
+     *
+     * @param seq the sequence
+     * @param start index of the first point to consider
+     * @param minx receives the minimum X value
+     * @param maxx receives the maximum X value
+     * @param miny receives the minimum Y value
+     * @param maxy receives the maximum Y value
+     */
+    static void minMax(const geom::CoordinateSequence& seq, std::size_t start,
+                       double& minx, double& maxx, double& miny, double& maxy);
+
+    /**
+     * Computes the signed area of a ring with the Shoelace formula.
+     *
+     * @param ring the points of a closed ring
+     * @return the signed area (positive if the ring is oriented clockwise)
+     *
+     * @see Area::ofRingSigned, which sums serially
+     */
+    static double signedAreaOfRing(const geom::CoordinateSequence& ring);
+
+    /**
+     * Computes the length of the line formed by a sequence of points.
+     *
+     * @see Length::ofLine, which sums serially
+     */
+    static double lengthOfLine(const geom::CoordinateSequence& pts);
+
+    /**
+     * Finds the next segment of a ring which may affect the result of
+     * a [RayCrossingCounter](@ref RayCrossingCounter) for a point.
+     *
+     * Segments which lie entirely to the left of the point, or entirely
+     * above or below it, are skipped.
+     *
+     * @param ring the points of the ring
+     * @param p the point being located
+     * @param start the index of the end point of the first segment to test
+     * @return the index of the end point of the next segment to process,
+     *         or the size of the ring if there is none
+     */
+    static std::size_t nextRayCrossingCandidate(const geom::CoordinateSequence& ring,
+                                                const geom::CoordinateXY& p,
+                                                std::size_t start);
+
+};
+
+} // namespace geos::algorithm
+} // namespace geos
+
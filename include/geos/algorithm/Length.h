@@ -36,6 +36,10 @@ public:
     /**
      * Computes the length of a linestring specified by a sequence of points.
      *
+     * The segment lengths are summed serially.
+     * CoordinateKernels::lengthOfLine computes the same length faster on
+     * long lines, but may differ from it in the last bits.
+     *
      * @param ring the points specifying the linestring
      * @return the length of the linestring
      */
@@ -22,6 +22,7 @@
 #include <geos/index/strtree/TemplateSTRtree.h>
 
 #include <memory>
+#include <mutex>
 #include <vector> // composition
 
 namespace geos {
@@ -49,6 +50,7 @@ namespace locate { // geos::algorithm::locate
  * Polygonal and [LinearRing](@ref geom::LinearRing) geometries are supported.
  *
  * The index is lazy-loaded, which allows creating instances even if they are not used.
+ * It is built exactly once, so a locator may be used from several threads at once.
  *
  */
 class GEOS_DLL IndexedPointInAreaLocator : public PointOnGeometryLocator {
@@ -101,6 +103,7 @@ private:
 
     const geom::Geometry& areaGeom;
     std::unique_ptr<IntervalIndexedGeometry> index;
+    std::once_flag indexBuilt;
 
     void buildIndex(const geom::Geometry& g);
 
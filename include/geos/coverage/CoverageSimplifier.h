@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 #include <memory>
 #include <geos/export.h>
@@ -134,12 +135,25 @@ public:
     std::vector<std::unique_ptr<Geometry>> simplifyInner(
         double tolerance);
 
+    /**
+    * Sets the number of threads used to simplify the edges
+    * of the coverage (see TPVWSimplifier::setNumThreads()).
+    * The default is 1; 0 uses one thread per hardware thread.
+    *
+    * @param numThreads the number of threads
+    */
+    void setNumThreads(std::size_t numThreads)
+    {
+        m_numThreads = numThreads;
+    }
+
 
 private:
 
     // Members
     const std::vector<const Geometry*>& m_input;
     const GeometryFactory* m_geomFactory;
+    std::size_t m_numThreads;
 
     // Methods
     void simplifyEdges(
@@ -16,6 +16,8 @@
 
 #include <geos/index/strtree/TemplateSTRtree.h>
 
+#include <cstddef>
+
 
 // Forward declarations
 namespace geos {
@@ -56,6 +58,9 @@ namespace coverage { // geos::coverage
  * (linework identified as part of a gap which is actually wider).
  * See CoverageGapFinder for an alternate way to detect gaps which may be more accurate.
  *
+ * The polygons may be validated on several threads (see setNumThreads()),
+ * since each is checked against its neighbours independently.
+ *
  * @author Martin Davis
  *
  */
@@ -68,6 +73,7 @@ private:
 
     std::vector<const Geometry*>& m_coverage;
     double m_gapWidth = 0.0;
+    std::size_t m_numThreads = 1;
 
     std::unique_ptr<Geometry> validate(
         const Geometry* targetGeom,
@@ -94,6 +100,18 @@ public:
         m_gapWidth = gapWidth;
     };
 
+    /**
+    * Sets the number of threads used to validate the polygons.
+    * The spatial index of the coverage is built once and
+    * queried by all threads.
+    * The default is 1; 0 uses one thread per hardware thread.
+    *
+    * @param numThreads the number of threads
+    */
+    void setNumThreads(std::size_t numThreads) {
+        m_numThreads = numThreads;
+    };
+
     /**
     * Validates the polygonal coverage.
     * The result is an array of the same size as the input coverage.
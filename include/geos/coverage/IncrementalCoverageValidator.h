@@ -0,0 +1,159 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/index/quadtree/Quadtree.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {      // geos
+namespace coverage { // geos::coverage
+
+/**
+ * Validates a polygonal coverage which is edited polygon by polygon.
+ *
+ * Polygons are added, replaced and removed individually, and
+ * are identified by the id returned when they are added.
+ * The validator keeps a dynamic spatial index of the coverage and
+ * tracks the polygons affected by each edit: the edited polygon,
+ * and the polygons within the gap width of its old or new envelope.
+ * validate() revalidates only those polygons, in the same way
+ * as CoverageValidator.
+ *
+ * The polygons are not owned by the validator, and must remain
+ * alive until they are replaced or removed.
+ */
+class GEOS_DLL IncrementalCoverageValidator {
+    using Envelope = geos::geom::Envelope;
+    using Geometry = geos::geom::Geometry;
+
+public:
+
+    /**
+    * Creates a validator of an empty coverage.
+    *
+    * @param gapWidth the maximum width of gaps to detect
+    */
+    explicit IncrementalCoverageValidator(double gapWidth = 0.0)
+        : m_gapWidth(gapWidth)
+        , m_numInvalid(0)
+        {};
+
+    IncrementalCoverageValidator(const IncrementalCoverageValidator&) = delete;
+    IncrementalCoverageValidator& operator=(const IncrementalCoverageValidator&) = delete;
+
+    /**
+    * Adds a polygon to the coverage.
+    *
+    * @param geom a polygonal geometry
+    * @return the id of the polygon
+    */
+    std::size_t add(const Geometry* geom);
+
+    /**
+    * Replaces a polygon of the coverage.
+    *
+    * @param id the id of the polygon to replace
+    * @param geom the new polygonal geometry
+    * @throws util::IllegalArgumentException if there is no polygon with the id
+    */
+    void replace(std::size_t id, const Geometry* geom);
+
+    /**
+    * Removes a polygon from the coverage.
+    * Its id is not reused.
+    *
+    * @param id the id of the polygon to remove
+    * @throws util::IllegalArgumentException if there is no polygon with the id
+    */
+    void remove(std::size_t id);
+
+    /**
+    * Validates the polygons affected by the edits made since the
+    * last validation (all polygons, on the first call).
+    * The result contains an entry for each of these polygons, which is
+    * either null, or if the polygon does not form a valid coverage,
+    * a linear geometry containing the invalid boundary segments.
+    *
+    * @return the validation results of the revalidated polygons, by id
+    */
+    std::map<std::size_t, std::unique_ptr<Geometry>> validate();
+
+    /**
+    * Tests whether the coverage was valid at the last validation.
+    *
+    * @return true if no polygon was invalid
+    */
+    bool isValid() const {
+        return m_numInvalid == 0;
+    };
+
+    /// Number of polygons in the coverage
+    std::size_t size() const;
+
+private:
+
+    struct Entry {
+        const Geometry* geom;
+        Envelope env;
+        bool isDirty;
+        bool isInvalid;
+    };
+
+    double m_gapWidth;
+    std::size_t m_numInvalid;
+    std::vector<Entry> m_entries;
+    std::vector<std::size_t> m_dirty;
+    index::quadtree::Quadtree m_index;
+
+    Entry& getEntry(std::size_t id);
+
+    void insert(std::size_t id);
+
+    void removeFromIndex(std::size_t id);
+
+    void markDirty(std::size_t id);
+
+    void markNeighboursDirty(const Envelope& env);
+
+    std::vector<std::size_t> queryNeighbours(const Envelope& env);
+
+    std::unique_ptr<Geometry> validate(std::size_t id);
+
+};
+
+} // namespace geos::coverage
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
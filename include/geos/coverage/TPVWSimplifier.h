@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <queue>
 
 #include <geos/index/strtree/TemplateSTRtree.h>
@@ -54,6 +55,14 @@ namespace coverage { // geos::coverage
  * This equates roughly to the maximum
  * distance by which a simplified line can change from the original.
  *
+ * The lines may be simplified on several threads (see setNumThreads()).
+ * The lines are then partitioned into the cells of a grid, and the lines
+ * whose envelopes intersect only lines of their own cell are simplified
+ * concurrently, cell by cell; the remaining lines are simplified afterwards.
+ * The result does not depend on the number of threads, but may differ
+ * slightly from the single-threaded result, since the lines are
+ * simplified in a different order.
+ *
  * @author mdavis
  *
  */
@@ -189,10 +198,40 @@ public:
         const MultiLineString* constraintLines,
         double distanceTolerance);
 
+    /**
+    * Simplifies a set of lines like simplify(lines, freeRings,
+    * constraintLines, distanceTolerance), on several threads.
+    *
+    * @param lines the lines to simplify
+    * @param freeRings flags indicating which ring edges do not have node endpoints
+    * @param constraintLines the linear constraints
+    * @param distanceTolerance the simplification tolerance
+    * @param numThreads the number of threads (0 for one per hardware thread)
+    * @return the simplified lines
+    */
+    static std::unique_ptr<MultiLineString> simplify(
+        const MultiLineString* lines,
+        std::vector<bool>& freeRings,
+        const MultiLineString* constraintLines,
+        double distanceTolerance,
+        std::size_t numThreads);
+
     // Constructor
     TPVWSimplifier(const MultiLineString* lines,
         double distanceTolerance);
 
+    /**
+    * Sets the number of threads used to simplify the lines.
+    * The default is 1; 0 uses one thread per hardware thread.
+    */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
+    /// The number of lines per grid cell aimed at when simplifying on several threads
+    static constexpr std::size_t EDGES_PER_PARTITION = 1024;
+
 
 private:
 
@@ -202,6 +241,7 @@ private:
     double areaTolerance;
     const GeometryFactory* geomFactory;
     const MultiLineString* constraintLines;
+    std::size_t numThreads;
 
 
     // Methods
@@ -211,6 +251,10 @@ private:
 
     std::unique_ptr<MultiLineString> simplify();
 
+    std::vector<std::unique_ptr<CoordinateSequence>> simplifyPartitioned(
+        std::vector<Edge>& edges,
+        EdgeIndex& edgeIndex);
+
     std::vector<Edge> createEdges(
         const MultiLineString* lines,
         std::vector<bool>& freeRing);
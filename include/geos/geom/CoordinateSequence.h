@@ -19,6 +19,7 @@
 
 #include <geos/geom/Coordinate.h> // for applyCoordinateFilter
 #include <geos/geom/CoordinateSequenceIterator.h>
+#include <geos/util/Arena.h>
 
 #include <cassert>
 #include <vector>
@@ -65,6 +66,49 @@ public:
 
     typedef std::unique_ptr<CoordinateSequence> Ptr;
 
+    /// Sequences and their coordinates are allocated from
+    /// the active util::Arena, if any. All the forms of the global
+    /// operator new are provided, since class-level ones hide them.
+    static void* operator new(std::size_t size) {
+        return geos::util::Arena::allocateCurrent(size);
+    }
+
+    static void operator delete(void* p) noexcept {
+        geos::util::Arena::deallocate(p);
+    }
+
+    static void* operator new(std::size_t size, const std::nothrow_t& tag) noexcept {
+        return geos::util::Arena::allocateCurrent(size, tag);
+    }
+
+    static void operator delete(void* p, const std::nothrow_t&) noexcept {
+        geos::util::Arena::deallocate(p);
+    }
+
+    static void* operator new(std::size_t size, std::align_val_t alignment) {
+        return geos::util::Arena::allocateCurrent(size, alignment);
+    }
+
+    static void operator delete(void* p, std::align_val_t alignment) noexcept {
+        geos::util::Arena::deallocate(p, alignment);
+    }
+
+    static void* operator new(std::size_t size, std::align_val_t alignment,
+                              const std::nothrow_t& tag) noexcept {
+        return geos::util::Arena::allocateCurrent(size, alignment, tag);
+    }
+
+    static void operator delete(void* p, std::align_val_t alignment,
+                                const std::nothrow_t&) noexcept {
+        geos::util::Arena::deallocate(p, alignment);
+    }
+
+    static void* operator new(std::size_t, void* p) noexcept {
+        return p;
+    }
+
+    static void operator delete(void*, void*) noexcept {}
+
     /// \defgroup construct Constructors
     /// @{
 
@@ -765,6 +809,62 @@ public:
     }
 
 
+    /// @}
+
+    /// \defgroup raw Raw ordinate views
+    /// @{
+
+    /**
+     * \brief
+     * A read-only view of the interleaved ordinates of a CoordinateSequence,
+     * with the number of values per coordinate fixed at compile time.
+     *
+     * Loops written against a View avoid the runtime stride of the
+     * sequence, allowing the compiler to unroll and vectorize them.
+     */
+    template<std::size_t Stride>
+    class View {
+    public:
+        static constexpr std::size_t stride = Stride;
+
+        View(const double* p_data, std::size_t p_size) : m_data(p_data), m_size(p_size) {}
+
+        std::size_t size() const {
+            return m_size;
+        }
+
+        const double* data() const {
+            return m_data;
+        }
+
+        double x(std::size_t i) const {
+            return m_data[i * Stride];
+        }
+
+        double y(std::size_t i) const {
+            return m_data[i * Stride + 1];
+        }
+
+    private:
+        const double* m_data;
+        std::size_t m_size;
+    };
+
+    /**
+     * Calls a function with a View of this sequence whose stride
+     * matches the storage of the sequence, and returns its result.
+     *
+     * @param fun a function accepting a `View<2>`, `View<3>` and `View<4>`
+     */
+    template<typename F>
+    auto withView(F&& fun) const {
+        switch(stride()) {
+            case 2:  return fun(View<2>(m_vect.data(), size()));
+            case 4:  return fun(View<4>(m_vect.data(), size()));
+            default: return fun(View<3>(m_vect.data(), size()));
+        }
+    }
+
     /// @}
 
     double* data() {
@@ -776,7 +876,7 @@ public:
     }
 
 private:
-    std::vector<double> m_vect; // Vector to store values
+    std::vector<double, geos::util::ArenaAllocator<double>> m_vect; // Vector to store values
 
     uint8_t m_stride;           // Stride of stored values, corresponding to underlying type
 
@@ -35,6 +35,7 @@
 #include <geos/geom/Dimension.h> // for Dimension::DimensionType
 #include <geos/geom/GeometryComponentFilter.h> // for inheritance
 #include <geos/geom/CoordinateSequence.h> // to materialize CoordinateSequence
+#include <geos/util/Arena.h>
 
 #include <algorithm>
 #include <string>
@@ -209,6 +210,49 @@ public:
     /// An unique_ptr of Geometry
     using Ptr = std::unique_ptr<Geometry> ;
 
+    /// Geometries are allocated from the active util::Arena, if any.
+    /// All the forms of the global operator new are provided, since
+    /// class-level ones hide them.
+    static void* operator new(std::size_t size) {
+        return geos::util::Arena::allocateCurrent(size);
+    }
+
+    static void operator delete(void* p) noexcept {
+        geos::util::Arena::deallocate(p);
+    }
+
+    static void* operator new(std::size_t size, const std::nothrow_t& tag) noexcept {
+        return geos::util::Arena::allocateCurrent(size, tag);
+    }
+
+    static void operator delete(void* p, const std::nothrow_t&) noexcept {
+        geos::util::Arena::deallocate(p);
+    }
+
+    static void* operator new(std::size_t size, std::align_val_t alignment) {
+        return geos::util::Arena::allocateCurrent(size, alignment);
+    }
+
+    static void operator delete(void* p, std::align_val_t alignment) noexcept {
+        geos::util::Arena::deallocate(p, alignment);
+    }
+
+    static void* operator new(std::size_t size, std::align_val_t alignment,
+                              const std::nothrow_t& tag) noexcept {
+        return geos::util::Arena::allocateCurrent(size, alignment, tag);
+    }
+
+    static void operator delete(void* p, std::align_val_t alignment,
+                                const std::nothrow_t&) noexcept {
+        geos::util::Arena::deallocate(p, alignment);
+    }
+
+    static void* operator new(std::size_t, void* p) noexcept {
+        return p;
+    }
+
+    static void operator delete(void*, void*) noexcept {}
+
     /// Make a deep-copy of this Geometry
     std::unique_ptr<Geometry> clone() const { return std::unique_ptr<Geometry>(cloneImpl()); }
 
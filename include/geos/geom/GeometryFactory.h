@@ -30,6 +30,7 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/export.h>
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <cassert>
@@ -522,7 +523,9 @@ private:
     PrecisionModel precisionModel;
     int SRID;
 
-    mutable int _refCount;
+    // Atomic, as geometries sharing this factory may be
+    // created and destroyed concurrently by parallel operations
+    mutable std::atomic<int> _refCount;
     bool _autoDestroy;
 
     friend class Geometry;
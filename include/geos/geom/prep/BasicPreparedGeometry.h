@@ -23,6 +23,9 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/operation/relateng/RelateNG.h>
 
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 #include <string>
 
@@ -59,14 +62,42 @@ class BasicPreparedGeometry: public PreparedGeometry {
 private:
     const geom::Geometry* baseGeom;
     std::vector<const CoordinateXY*> representativePts;
+    bool shared;
     mutable std::unique_ptr<RelateNG> relate_ng;
 
-    RelateNG& getRelateNG() const
-    {
-        if (relate_ng == nullptr)
-            relate_ng = RelateNG::prepare(baseGeom);
+    // RelateNG keeps per-query state next to its lazily built indexes,
+    // so a shared geometry hands out one prepared instance to each
+    // concurrent caller. Each instance builds its own indexes, i.e. at
+    // most once per thread, and is kept for reuse by later callers.
+    mutable std::mutex relateNGPoolMutex;
+    mutable std::vector<std::unique_ptr<RelateNG>> relateNGPool;
 
-        return *relate_ng;
+    template<typename F>
+    auto withRelateNG(F&& f) const -> decltype(f(std::declval<RelateNG&>()))
+    {
+        if (!shared) {
+            if (relate_ng == nullptr)
+                relate_ng = RelateNG::prepare(baseGeom);
+
+            return f(*relate_ng);
+        }
+
+        std::unique_ptr<RelateNG> rng;
+        {
+            std::lock_guard<std::mutex> lock(relateNGPoolMutex);
+            if (!relateNGPool.empty()) {
+                rng = std::move(relateNGPool.back());
+                relateNGPool.pop_back();
+            }
+        }
+        if (rng == nullptr)
+            rng = RelateNG::prepare(baseGeom);
+
+        auto result = f(*rng);
+
+        std::lock_guard<std::mutex> lock(relateNGPoolMutex);
+        relateNGPool.push_back(std::move(rng));
+        return result;
     }
 
 protected:
@@ -95,10 +126,31 @@ protected:
     bool envelopeCovers(const geom::Geometry* g) const;
 
 public:
-    BasicPreparedGeometry(const Geometry* geom);
+    /**
+     * Creates a prepared geometry.
+     *
+     * @param geom the geometry to prepare
+     * @param shared whether the prepared geometry may be queried from
+     *        several threads at once. A shared geometry builds each of its
+     *        indexes exactly once, and does not modify them afterwards,
+     *        except for the RelateNG used by the predicates without a
+     *        specialized implementation, which is prepared once for each
+     *        thread querying the geometry concurrently.
+     */
+    BasicPreparedGeometry(const Geometry* geom, bool shared = false);
 
     ~BasicPreparedGeometry() override = default;
 
+    /**
+     * Tests whether this prepared geometry may be queried from several
+     * threads at once.
+     */
+    bool
+    isShared() const
+    {
+        return shared;
+    }
+
     const geom::Geometry&
     getGeometry() const override
     {
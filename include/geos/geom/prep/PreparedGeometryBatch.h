@@ -0,0 +1,116 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+namespace prep {
+class PreparedGeometry;
+}
+}
+}
+
+namespace geos {
+namespace geom { // geos::geom
+namespace prep { // geos::geom::prep
+
+/**
+ * \brief
+ * Evaluates a predicate of a PreparedGeometry against many
+ * candidate geometries or points in a single call.
+ *
+ * Results are written as one byte per candidate (1 if the predicate
+ * holds, 0 otherwise).
+ *
+ * When the prepared geometry is polygonal, point candidates are located
+ * directly with the indexed point-in-area locator of the PreparedPolygon,
+ * avoiding the creation of a Point geometry per candidate.
+ *
+ * The candidates can be distributed over several threads, which
+ * share a single prepared geometry. If `prep` was not created with
+ * PreparedGeometryFactory::prepareShared(), a shared preparation of
+ * its geometry is made for the duration of the call.
+ */
+class GEOS_DLL PreparedGeometryBatch {
+
+public:
+
+    /**
+     * Computes `prep.contains(geoms[i])` for each candidate.
+     *
+     * @param prep the prepared geometry
+     * @param geoms array of `n` candidate geometries
+     * @param n number of candidates
+     * @param results array of `n` bytes receiving the results
+     * @param numThreads number of threads (0 for one per hardware thread)
+     */
+    static void contains(const PreparedGeometry& prep,
+                         const Geometry* const* geoms, std::size_t n,
+                         unsigned char* results, std::size_t numThreads = 1);
+
+    /**
+     * Computes `prep.intersects(geoms[i])` for each candidate.
+     *
+     * @param prep the prepared geometry
+     * @param geoms array of `n` candidate geometries
+     * @param n number of candidates
+     * @param results array of `n` bytes receiving the results
+     * @param numThreads number of threads (0 for one per hardware thread)
+     */
+    static void intersects(const PreparedGeometry& prep,
+                           const Geometry* const* geoms, std::size_t n,
+                           unsigned char* results, std::size_t numThreads = 1);
+
+    /**
+     * Tests whether the prepared geometry contains each of the
+     * points `(x[i], y[i])`.
+     *
+     * @param prep the prepared geometry
+     * @param x array of `n` X ordinates
+     * @param y array of `n` Y ordinates
+     * @param n number of points
+     * @param results array of `n` bytes receiving the results
+     * @param numThreads number of threads (0 for one per hardware thread)
+     */
+    static void containsXY(const PreparedGeometry& prep,
+                           const double* x, const double* y, std::size_t n,
+                           unsigned char* results, std::size_t numThreads = 1);
+
+    /**
+     * Tests whether the prepared geometry intersects each of the
+     * points `(x[i], y[i])`.
+     *
+     * @param prep the prepared geometry
+     * @param x array of `n` X ordinates
+     * @param y array of `n` Y ordinates
+     * @param n number of points
+     * @param results array of `n` bytes receiving the results
+     * @param numThreads number of threads (0 for one per hardware thread)
+     */
+    static void intersectsXY(const PreparedGeometry& prep,
+                             const double* x, const double* y, std::size_t n,
+                             unsigned char* results, std::size_t numThreads = 1);
+
+};
+
+} // namespace geos::geom::prep
+} // namespace geos::geom
+} // namespace geos
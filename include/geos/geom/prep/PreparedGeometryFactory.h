@@ -66,6 +66,24 @@ public:
         return pf.create(geom);
     }
 
+    /**
+     * Creates a new {@link PreparedGeometry} appropriate for the argument
+     * {@link Geometry}, which may be queried from several threads at once.
+     *
+     * The indexes of the geometry are built once and shared by all threads,
+     * except that predicates evaluated with RelateNG prepare it once for
+     * each thread querying the geometry concurrently.
+     *
+     * @param geom the geometry to prepare
+     * @return the prepared geometry
+     */
+    static std::unique_ptr<PreparedGeometry>
+    prepareShared(const geom::Geometry* geom)
+    {
+        PreparedGeometryFactory pf;
+        return pf.create(geom, true);
+    }
+
     /**
      * Destroys {@link PreparedGeometry} allocated with the factory.
      *
@@ -83,7 +101,20 @@ public:
      * @param geom the geometry to prepare
      * @return the prepared geometry
      */
-    std::unique_ptr<PreparedGeometry> create(const geom::Geometry* geom) const;
+    std::unique_ptr<PreparedGeometry> create(const geom::Geometry* geom) const
+    {
+        return create(geom, false);
+    }
+
+    /**
+     * Creates a new {@link PreparedGeometry} appropriate for the argument {@link Geometry}.
+     *
+     * @param geom the geometry to prepare
+     * @param shared whether the prepared geometry may be queried from
+     *        several threads at once
+     * @return the prepared geometry
+     */
+    std::unique_ptr<PreparedGeometry> create(const geom::Geometry* geom, bool shared) const;
 
 };
 
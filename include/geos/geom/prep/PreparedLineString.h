@@ -26,6 +26,7 @@
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
 #include <memory>
+#include <mutex>
 
 namespace geos {
 namespace geom { // geos::geom
@@ -43,12 +44,14 @@ private:
     std::unique_ptr<noding::FastSegmentSetIntersectionFinder> segIntFinder;
     mutable noding::SegmentString::ConstVect segStrings;
     mutable std::unique_ptr<operation::distance::IndexedFacetDistance> indexedDistance;
+    std::once_flag segIntFinderBuilt;
+    mutable std::once_flag indexedDistanceBuilt;
 
 protected:
 public:
-    PreparedLineString(const Geometry* geom)
+    PreparedLineString(const Geometry* geom, bool p_shared = false)
         :
-        BasicPreparedGeometry(geom),
+        BasicPreparedGeometry(geom, p_shared),
         segIntFinder(nullptr)
     { }
 
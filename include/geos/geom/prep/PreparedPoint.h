@@ -36,8 +36,8 @@ class PreparedPoint: public BasicPreparedGeometry {
 private:
 protected:
 public:
-    PreparedPoint(const Geometry* geom)
-        : BasicPreparedGeometry(geom)
+    PreparedPoint(const Geometry* geom, bool p_shared = false)
+        : BasicPreparedGeometry(geom, p_shared)
     { }
 
     /**
@@ -25,6 +25,7 @@
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
 #include <memory>
+#include <mutex>
 
 namespace geos {
 namespace noding {
@@ -56,14 +57,25 @@ private:
     mutable std::unique_ptr<algorithm::locate::PointOnGeometryLocator> indexedPtOnGeomLoc;
     mutable noding::SegmentString::ConstVect segStrings;
     mutable std::unique_ptr<operation::distance::IndexedFacetDistance> indexedDistance;
+    mutable std::once_flag segIntFinderBuilt;
+    mutable std::once_flag indexedPtOnGeomLocBuilt;
+    mutable std::once_flag indexedDistanceBuilt;
 
 protected:
 public:
-    PreparedPolygon(const geom::Geometry* geom);
+    PreparedPolygon(const geom::Geometry* geom, bool shared = false);
     ~PreparedPolygon() override;
 
     noding::FastSegmentSetIntersectionFinder* getIntersectionFinder() const;
     algorithm::locate::PointOnGeometryLocator* getPointLocator() const;
+
+    /**
+     * Gets a point locator using an index over the polygon segments,
+     * creating it if necessary. Unlike getPointLocator(), this always
+     * returns the indexed locator, which is preferable when many
+     * points are known to be located.
+     */
+    algorithm::locate::PointOnGeometryLocator* getIndexedPointLocator() const;
     operation::distance::IndexedFacetDistance* getIndexedFacetDistance() const;
 
     bool contains(const geom::Geometry* g) const override;
@@ -0,0 +1,259 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace geos {
+namespace index {
+namespace strtree {
+
+/**
+ * \brief A read-only, flat representation of a built two-dimensional
+ * TemplateSTRtree, which can be stored in a file and queried in place.
+ *
+ * A snapshot holds the bounds of every node of the tree, the range of
+ * children of each branch node, and a 64-bit identifier for the item of
+ * each leaf node. Nodes are referenced by index rather than by pointer, so
+ * the snapshot can be memory-mapped with open() and queried directly,
+ * without being deserialized or the tree being rebuilt.
+ *
+ * The format is versioned and stored in the byte order of the machine
+ * that wrote it. Snapshots written with a different byte order or format
+ * version are rejected.
+ *
+ * Opening a snapshot only checks its header and size, so that it does not
+ * touch every page of a large mapping. The children of each node are
+ * checked as the node is traversed by a query, and validate() checks the
+ * whole snapshot up front.
+ */
+class GEOS_DLL STRtreeSnapshot {
+
+public:
+
+    static constexpr std::uint32_t VERSION = 1;
+
+    /// A node of the snapshot, as stored in the file.
+    struct Node {
+        double minX;
+        double minY;
+        double maxX;
+        double maxY;
+        /// index of the first child of a branch node, or the item id of a leaf node
+        std::uint64_t childrenBegin;
+        /// index past the last child of a branch node, or 0 for a leaf node
+        std::uint64_t childrenEnd;
+
+        bool isLeaf() const {
+            return childrenEnd == 0;
+        }
+
+        bool intersects(const geom::Envelope& e) const {
+            return !(e.getMinX() > maxX || e.getMaxX() < minX ||
+                     e.getMinY() > maxY || e.getMaxY() < minY);
+        }
+    };
+
+    /**
+     * Creates a snapshot over a buffer holding data written by write().
+     * The buffer is not copied and must remain valid, and aligned on
+     * 8 bytes, for the lifetime of the snapshot.
+     *
+     * @throws util::IllegalArgumentException if the header or size of the
+     *         buffer is not that of a snapshot
+     */
+    STRtreeSnapshot(const void* data, std::size_t size);
+
+    ~STRtreeSnapshot();
+
+    STRtreeSnapshot(const STRtreeSnapshot&) = delete;
+    STRtreeSnapshot& operator=(const STRtreeSnapshot&) = delete;
+
+    /**
+     * Opens a snapshot file by mapping it into memory.
+     *
+     * @throws util::GEOSException if the file cannot be mapped
+     * @throws util::IllegalArgumentException if the header or size of the
+     *         file is not that of a snapshot
+     */
+    static std::unique_ptr<STRtreeSnapshot> open(const std::string& path);
+
+    /**
+     * Checks the children of every node, which queries otherwise
+     * only check for the nodes they traverse.
+     *
+     * @throws util::IllegalArgumentException if a node has invalid children
+     */
+    void validate() const;
+
+    /**
+     * Writes a snapshot of a tree to a stream, building the tree if
+     * necessary. The tree must not be modified while it is written.
+     *
+     * @param tree the tree to write
+     * @param os the stream to write to, which should be opened in binary mode
+     * @param itemId a function returning the 64-bit identifier of an item
+     */
+    template<typename ItemType, typename F>
+    static void write(TemplateSTRtree<ItemType, EnvelopeTraits>& tree, std::ostream& os, F&& itemId)
+    {
+        std::vector<Node> flat;
+        std::uint64_t numItems = 0;
+
+        // Children of a node are contiguous, so a breadth-first traversal
+        // assigns them a contiguous range of indices.
+        using TreeNode = typename TemplateSTRtree<ItemType, EnvelopeTraits>::Node;
+        std::deque<const TreeNode*> queue;
+        if (const TreeNode* root = tree.getRoot()) {
+            queue.push_back(root);
+        }
+        while (!queue.empty()) {
+            const TreeNode* node = queue.front();
+            queue.pop_front();
+
+            const geom::Envelope& e = node->getBounds();
+            Node n { e.getMinX(), e.getMinY(), e.getMaxX(), e.getMaxY(), 0, 0 };
+            if (node->isDeleted()) {
+                setEmpty(n);
+            }
+            else if (node->isLeaf()) {
+                n.childrenBegin = itemId(node->getItem());
+                numItems++;
+            }
+            else {
+                n.childrenBegin = flat.size() + 1 + queue.size();
+                for (const TreeNode* child = node->beginChildren(); child != node->endChildren(); ++child) {
+                    queue.push_back(child);
+                }
+                n.childrenEnd = flat.size() + 1 + queue.size();
+            }
+            flat.push_back(n);
+        }
+
+        write(os, flat, numItems);
+    }
+
+    /**
+     * Writes a snapshot of a tree whose items are integers, or pointers,
+     * using the value of each item as its identifier.
+     */
+    template<typename ItemType>
+    static void write(TemplateSTRtree<ItemType, EnvelopeTraits>& tree, std::ostream& os)
+    {
+        static_assert(std::is_integral<ItemType>::value || std::is_pointer<ItemType>::value,
+                      "items must be integers or pointers; use an itemId function");
+        write(tree, os, [](const ItemType& item) {
+            return toId(item);
+        });
+    }
+
+    /**
+     * Visits the identifiers of the items whose bounds intersect an envelope.
+     *
+     * @param queryEnv the envelope to query
+     * @param visitor a function called with the std::uint64_t identifier of each item found
+     * @throws util::IllegalArgumentException if a traversed node has invalid children
+     */
+    template<typename Visitor>
+    void query(const geom::Envelope& queryEnv, Visitor&& visitor) const
+    {
+        if (numNodes == 0 || queryEnv.isNull()) {
+            return;
+        }
+
+        std::vector<std::uint64_t> stack { 0 };
+        while (!stack.empty()) {
+            std::uint64_t index = stack.back();
+            const Node& node = nodes[index];
+            stack.pop_back();
+
+            if (!node.intersects(queryEnv)) {
+                continue;
+            }
+            if (node.isLeaf()) {
+                visitor(node.childrenBegin);
+                continue;
+            }
+            if (!hasValidChildren(node, index)) {
+                throwInvalidChildren(index);
+            }
+            // Push in reverse so that children are visited in order
+            for (std::uint64_t i = node.childrenEnd; i > node.childrenBegin; i--) {
+                stack.push_back(i - 1);
+            }
+        }
+    }
+
+    /// Returns the identifiers of the items whose bounds intersect an envelope.
+    std::vector<std::uint64_t> query(const geom::Envelope& queryEnv) const;
+
+    /// Returns the number of items in the snapshot.
+    std::size_t getNumItems() const {
+        return numItems;
+    }
+
+    /// Returns the number of nodes in the snapshot.
+    std::size_t getNumNodes() const {
+        return numNodes;
+    }
+
+    /// Returns the bounds of all items in the snapshot, or a null envelope if empty.
+    geom::Envelope getBounds() const;
+
+private:
+
+    struct Mapping;
+
+    const Node* nodes;
+    std::size_t numNodes;
+    std::size_t numItems;
+    std::unique_ptr<Mapping> mapping;
+
+    static void write(std::ostream& os, const std::vector<Node>& nodes, std::uint64_t numItems);
+
+    static void setEmpty(Node& n);
+
+    // Children must follow their parent, so that queries always terminate
+    bool hasValidChildren(const Node& n, std::uint64_t index) const {
+        return n.childrenBegin > index && n.childrenBegin < n.childrenEnd && n.childrenEnd <= numNodes;
+    }
+
+    [[noreturn]] static void throwInvalidChildren(std::uint64_t index);
+
+    template<typename T>
+    static std::uint64_t toId(T* item) {
+        return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(item));
+    }
+
+    template<typename T>
+    static std::uint64_t toId(T item) {
+        return static_cast<std::uint64_t>(item);
+    }
+};
+
+} // namespace geos::index::strtree
+} // namespace geos::index
+} // namespace geos
@@ -66,6 +66,12 @@ public:
         children(begin)
     {}
 
+    TemplateSTRNode(const TemplateSTRNode* begin, const TemplateSTRNode* end, const BoundsType& p_bounds) :
+        bounds(p_bounds),
+        data(end),
+        children(begin)
+    {}
+
     const TemplateSTRNode* beginChildren() const {
         return children;
     }
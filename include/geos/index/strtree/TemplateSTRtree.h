@@ -14,17 +14,22 @@
 
 #pragma once
 
+#include <geos/constants.h>
 #include <geos/geom/Geometry.h>
 #include <geos/index/SpatialIndex.h> // for inheritance
 #include <geos/index/chain/MonotoneChain.h>
 #include <geos/index/ItemVisitor.h>
 #include <geos/util.h>
+#include <geos/util/PhaseProfiler.h>
+#include <geos/util/ThreadPool.h>
 
 #include <geos/index/strtree/TemplateSTRNode.h>
 #include <geos/index/strtree/TemplateSTRNodePair.h>
 #include <geos/index/strtree/TemplateSTRtreeDistance.h>
 #include <geos/index/strtree/Interval.h>
 
+#include <algorithm>
+#include <atomic>
 #include <vector>
 #include <queue>
 #include <mutex>
@@ -130,7 +135,8 @@ public:
     explicit TemplateSTRtreeImpl(size_t p_nodeCapacity = 10) :
         root(nullptr),
         nodeCapacity(p_nodeCapacity),
-        numItems(0)
+        numItems(0),
+        numThreads(1)
         {}
 
     /**
@@ -139,9 +145,30 @@ public:
      * to pre-allocate storage.
      */
     TemplateSTRtreeImpl(size_t p_nodeCapacity, size_t itemCapacity) :
+        TemplateSTRtreeImpl(p_nodeCapacity, itemCapacity, 1) {}
+
+    /**
+     * Constructs a tree with the given maximum number of child nodes that
+     * a node may have, with the expected total number of items in the tree used
+     * to pre-allocate storage, which will be built using the given number of
+     * threads.
+     *
+     * A parallel build partitions the nodes of large levels of the tree into
+     * slices using selection rather than a complete sort, so the tree may
+     * differ from a sequential build in the placement of nodes with equal
+     * coordinates. Query results are the same, although they may be reported
+     * in a different order.
+     *
+     * @param p_nodeCapacity maximum number of children of a node
+     * @param itemCapacity expected number of items, or 0
+     * @param p_numThreads number of threads used to build the tree, or
+     *        0 to use the number of hardware threads
+     */
+    TemplateSTRtreeImpl(size_t p_nodeCapacity, size_t itemCapacity, size_t p_numThreads) :
         root(nullptr),
         nodeCapacity(p_nodeCapacity),
-        numItems(0) {
+        numItems(0),
+        numThreads(p_numThreads) {
         auto finalSize = treeSize(itemCapacity);
         nodes.reserve(finalSize);
     }
@@ -152,7 +179,8 @@ public:
     TemplateSTRtreeImpl(const TemplateSTRtreeImpl& other) :
         root(other.root),
         nodeCapacity(other.nodeCapacity),
-        numItems(other.numItems) {
+        numItems(other.numItems),
+        numThreads(other.numThreads) {
         nodes = other.nodes;
     }
 
@@ -161,6 +189,7 @@ public:
         root = other.root;
         nodeCapacity = other.nodeCapacity;
         numItems = other.numItems;
+        numThreads = other.numThreads;
         nodes = other.nodes;
         return *this;
     }
@@ -249,6 +278,79 @@ public:
         return nearestNeighbour(env, item, id);
     }
 
+    /**
+     * Visit the items of the tree in order of increasing distance to `item`,
+     * whose bounds are `env`, using distance metric `itemDist`. The visitor is
+     * called with each item and its distance, until it returns false or the
+     * items are further than `maxDistance`. Distances computed by `itemDist`
+     * must not be less than the distances between the bounds of the items.
+     */
+    template<typename ItemDistance, typename Visitor>
+    void visitNearest(const BoundsType& env, const ItemType& item, ItemDistance& itemDist,
+                      double maxDistance, Visitor&& visitor) {
+        if (getRoot() == nullptr) {
+            return;
+        }
+
+        TemplateSTRNode<ItemType, BoundsTraits> bnd(item, env);
+        TemplateSTRtreeDistance<ItemType, BoundsTraits, ItemDistance> td(itemDist);
+        td.nearestItems(*getRoot(), bnd, maxDistance, visitor);
+    }
+
+    /**
+     * Determine the `k` items closest to `item`, whose bounds are `env`, using
+     * distance metric `itemDist`, in order of increasing distance. Items
+     * further than `maxDistance` are not included.
+     */
+    template<typename ItemDistance>
+    std::vector<ItemType> nearestNeighbours(const BoundsType& env, const ItemType& item, std::size_t k,
+                                            ItemDistance& itemDist, double maxDistance = DoubleInfinity) {
+        std::vector<ItemType> result;
+        if (k == 0) {
+            return result;
+        }
+        visitNearest(env, item, itemDist, maxDistance, [&result, k](const ItemType& found, double) {
+            result.push_back(found);
+            return result.size() < k;
+        });
+        return result;
+    }
+
+    /**
+     * Determine the `k` items closest to `item`, whose bounds are `env`, using
+     * distance metric `ItemDistance`, in order of increasing distance.
+     */
+    template<typename ItemDistance>
+    std::vector<ItemType> nearestNeighbours(const BoundsType& env, const ItemType& item, std::size_t k) {
+        ItemDistance id;
+        return nearestNeighbours(env, item, k, id);
+    }
+
+    /**
+     * Determine the items within `maxDistance` of `item`, whose bounds are
+     * `env`, using distance metric `itemDist`, in order of increasing distance.
+     */
+    template<typename ItemDistance>
+    std::vector<ItemType> itemsWithinDistance(const BoundsType& env, const ItemType& item, double maxDistance,
+                                              ItemDistance& itemDist) {
+        std::vector<ItemType> result;
+        visitNearest(env, item, itemDist, maxDistance, [&result](const ItemType& found, double) {
+            result.push_back(found);
+            return true;
+        });
+        return result;
+    }
+
+    /**
+     * Determine the items within `maxDistance` of `item`, whose bounds are
+     * `env`, using distance metric `ItemDistance`, in order of increasing distance.
+     */
+    template<typename ItemDistance>
+    std::vector<ItemType> itemsWithinDistance(const BoundsType& env, const ItemType& item, double maxDistance) {
+        ItemDistance id;
+        return itemsWithinDistance(env, item, maxDistance, id);
+    }
+
     template<typename ItemDistance>
     bool isWithinDistance(TemplateSTRtreeImpl<ItemType, BoundsTraits>& other, double maxDistance) {
         ItemDistance itemDist;
@@ -306,6 +408,108 @@ public:
         }
     }
 
+    // Query the tree for the pairs visited by queryPairs(visitor) whose
+    // first item is one of the items [begin, end), numbered in the order
+    // in which queryPairs(visitor) visits them. Querying consecutive ranges
+    // covering all items visits each pair once, in the same order as
+    // queryPairs(visitor); ranges may be queried concurrently once the
+    // tree has been built.
+    template<typename Visitor>
+    void queryPairs(std::size_t begin, std::size_t end, Visitor&& visitor) {
+        if (!built()) {
+            build();
+        }
+
+        if (numItems < 2) {
+            return;
+        }
+
+        end = std::min(end, numItems);
+        for (std::size_t i = begin; i < end; i++) {
+            if (!queryPairs(nodes[i], *root, visitor)) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Query this tree and another tree for all pairs of items whose bounds
+     * intersect, traversing both trees together and pruning pairs of nodes
+     * whose bounds do not intersect.
+     *
+     * The visitor must be callable with arguments
+     * (const ItemType&, const OtherItemType&), with the item from this tree
+     * first. The visitor need not return a value, but if it does return a
+     * value, false values will be taken as a signal to stop the query.
+     *
+     * When more than one thread is used, pairs of subtrees near the roots
+     * are processed in parallel, and the visitor will be called concurrently
+     * from several threads, in no particular order. Both trees are built
+     * before the join begins.
+     *
+     * @param other the tree to join with this tree
+     * @param visitor the function called for each intersecting pair of items
+     * @param p_numThreads the number of threads to use, or 0 to use the
+     *        number of hardware threads
+     */
+    template<typename OtherItemType, typename Visitor>
+    void join(TemplateSTRtreeImpl<OtherItemType, BoundsTraits>& other, Visitor&& visitor, size_t p_numThreads = 1) {
+        using OtherNode = typename TemplateSTRtreeImpl<OtherItemType, BoundsTraits>::Node;
+
+        const Node* thisRoot = getRoot();
+        const OtherNode* otherRoot = other.getRoot();
+        if (!thisRoot || !otherRoot) {
+            return;
+        }
+
+        if (p_numThreads == 1) {
+            join(*thisRoot, *otherRoot, visitor);
+            return;
+        }
+
+        util::ThreadPool pool(p_numThreads);
+
+        // Expand the pair of roots into enough pairs of intersecting
+        // subtrees to balance the load over the pool.
+        std::vector<std::pair<const Node*, const OtherNode*>> pairs;
+        pairs.emplace_back(thisRoot, otherRoot);
+        std::size_t minPairs = 16 * pool.getNumThreads();
+        bool expanded = true;
+        while (pairs.size() < minPairs && expanded) {
+            expanded = false;
+            std::vector<std::pair<const Node*, const OtherNode*>> next;
+            for (const auto& pair : pairs) {
+                if (!pair.first->boundsIntersect(pair.second->getBounds())) {
+                    continue;
+                }
+                if (pair.first->isLeaf() && pair.second->isLeaf()) {
+                    next.push_back(pair);
+                } else if (descendFirst(*pair.first, *pair.second)) {
+                    for (auto* child = pair.first->beginChildren(); child < pair.first->endChildren(); ++child) {
+                        next.emplace_back(child, pair.second);
+                    }
+                    expanded = true;
+                } else {
+                    for (auto* child = pair.second->beginChildren(); child < pair.second->endChildren(); ++child) {
+                        next.emplace_back(pair.first, child);
+                    }
+                    expanded = true;
+                }
+            }
+            pairs = std::move(next);
+        }
+
+        std::atomic<bool> stopped(false);
+        pool.parallelFor(pairs.size(), [&](std::size_t i) {
+            if (stopped.load(std::memory_order_relaxed)) {
+                return;
+            }
+            if (!join(*pairs[i].first, *pairs[i].second, visitor)) {
+                stopped.store(true, std::memory_order_relaxed);
+            }
+        });
+    }
+
     // Query the tree and collect items in the provided vector.
     void query(const BoundsType& queryEnv, std::vector<ItemType>& results) {
         query(queryEnv, [&results](const ItemType& x) {
@@ -386,6 +590,8 @@ public:
             return;
         }
 
+        util::PhaseProfiler::Timer timer(util::PhaseProfiler::INDEX_BUILD);
+
         numItems = nodes.size();
 
         // compute final size of tree and set it aside in a single
@@ -393,12 +599,21 @@ public:
         auto finalSize = treeSize(numItems);
         nodes.reserve(finalSize);
 
+        std::unique_ptr<util::ThreadPool> pool;
+        if (numThreads != 1 && numItems >= PARALLEL_BUILD_MIN_NODES) {
+            pool.reset(new util::ThreadPool(numThreads));
+        }
+
         // begin and end define a range of nodes needing parents
         auto begin = nodes.begin();
         auto number = static_cast<size_t>(std::distance(begin, nodes.end()));
 
         while (number > 1) {
-            createParentNodes(begin, number);
+            if (pool && number >= PARALLEL_BUILD_MIN_NODES) {
+                createParentNodes(*pool, begin, number);
+            } else {
+                createParentNodes(begin, number);
+            }
             std::advance(begin, static_cast<long>(number)); // parents just added become children in the next round
             number = static_cast<size_t>(std::distance(begin, nodes.end()));
         }
@@ -414,6 +629,10 @@ protected:
     Node* root;          //**< a pointer to the root node, if the tree has been built. */
     size_t nodeCapacity; //*< maximum number of children of each node */
     size_t numItems;     //*< total number of items in the tree, if it has been built. */
+    size_t numThreads;   //*< number of threads used to build the tree, 0 for all hardware threads */
+
+    // Levels of the tree with fewer nodes are built sequentially
+    static constexpr size_t PARALLEL_BUILD_MIN_NODES = 1 << 16;
 
     // Prevent instantiation of base class.
     // ~TemplateSTRtreeImpl() = default;
@@ -490,6 +709,89 @@ protected:
         }
     }
 
+    // A version of createParentNodes that sorts slices, and computes the
+    // bounds of their parents, in parallel. Nodes are only assigned to their
+    // slice by selection rather than by sorting all of them.
+    void createParentNodes(util::ThreadPool& pool, const NodeListIterator& begin, size_t number) {
+        auto numSlices = sliceCount(number);
+        std::size_t nodesPerSlice = sliceCapacity(number, numSlices);
+        auto end = begin + static_cast<long>(number);
+
+        partitionSlices(pool, begin, end, nodesPerSlice);
+
+        auto sliceBegin = [&begin, nodesPerSlice, number](size_t j) {
+            return begin + static_cast<long>(std::min(number, j * nodesPerSlice));
+        };
+
+        // Parents of each slice are created after those of the previous slices
+        std::vector<size_t> firstParent(numSlices + 1, 0);
+        for (size_t j = 0; j < numSlices; j++) {
+            auto nodesInSlice = static_cast<size_t>(std::distance(sliceBegin(j), sliceBegin(j + 1)));
+            firstParent[j + 1] = firstParent[j] + (nodesInSlice + nodeCapacity - 1) / nodeCapacity;
+        }
+
+        std::vector<BoundsType> parentBounds(firstParent[numSlices], begin->getBounds());
+        pool.parallelFor(numSlices, [&](size_t j) {
+            auto sliceEnd = sliceBegin(j + 1);
+            // Slices were only partitioned, so one-dimensional nodes must
+            // still be ordered along X within their slice
+            if (BoundsTraits::TwoDimensional::value) {
+                sortNodesY(sliceBegin(j), sliceEnd);
+            } else {
+                sortNodesX(sliceBegin(j), sliceEnd);
+            }
+            size_t parent = firstParent[j];
+            for (auto firstChild = sliceBegin(j); firstChild != sliceEnd; ++parent) {
+                auto childrenForNode = std::min(nodeCapacity, static_cast<size_t>(std::distance(firstChild, sliceEnd)));
+                const Node* ptr_first = &*firstChild;
+                parentBounds[parent] = Node::boundsFromChildren(ptr_first, ptr_first + childrenForNode);
+                std::advance(firstChild, static_cast<long>(childrenForNode));
+            }
+        });
+
+        for (size_t j = 0; j < numSlices; j++) {
+            auto sliceEnd = sliceBegin(j + 1);
+            size_t parent = firstParent[j];
+            for (auto firstChild = sliceBegin(j); firstChild != sliceEnd; ++parent) {
+                auto childrenForNode = std::min(nodeCapacity, static_cast<size_t>(std::distance(firstChild, sliceEnd)));
+                const Node* ptr_first = &*firstChild;
+                assert(nodes.size() < nodes.capacity());
+                nodes.emplace_back(ptr_first, ptr_first + childrenForNode, parentBounds[parent]);
+                std::advance(firstChild, static_cast<long>(childrenForNode));
+            }
+        }
+    }
+
+    // Rearrange the nodes between begin and end so that each node lies in
+    // its vertical slice of nodesPerSlice nodes, recursively splitting the
+    // range at a slice boundary and processing both halves in parallel.
+    void partitionSlices(util::ThreadPool& pool, NodeListIterator begin, NodeListIterator end,
+                         size_t nodesPerSlice) {
+        auto number = static_cast<size_t>(std::distance(begin, end));
+        if (number <= nodesPerSlice) {
+            return;
+        }
+
+        auto slicesInRange = (number + nodesPerSlice - 1) / nodesPerSlice;
+        auto mid = std::next(begin, static_cast<long>(slicesInRange / 2 * nodesPerSlice));
+        std::nth_element(begin, mid, end, [](const Node &a, const Node &b) {
+            return BoundsTraits::getX(a.getBounds()) < BoundsTraits::getX(b.getBounds());
+        });
+
+        if (number < PARALLEL_BUILD_MIN_NODES) {
+            partitionSlices(pool, begin, mid, nodesPerSlice);
+            partitionSlices(pool, mid, end, nodesPerSlice);
+            return;
+        }
+
+        util::TaskGroup tasks(pool);
+        tasks.run([this, &pool, begin, mid, nodesPerSlice]() {
+            partitionSlices(pool, begin, mid, nodesPerSlice);
+        });
+        partitionSlices(pool, mid, end, nodesPerSlice);
+        tasks.wait();
+    }
+
     void addParentNodesFromVerticalSlice(const NodeListIterator& begin, const NodeListIterator& end) {
         if (BoundsTraits::TwoDimensional::value) {
             sortNodesY(begin, end);
@@ -549,6 +851,21 @@ protected:
         return true;
     }
 
+    template<typename Visitor, typename OtherNode,
+            typename std::enable_if<std::is_void<decltype(std::declval<Visitor>()(std::declval<ItemType>(), std::declval<OtherNode>().getItem()))>::value, std::nullptr_t>::type = nullptr >
+    static bool visitJoin(Visitor&& visitor, const Node& node1, const OtherNode& node2)
+    {
+        visitor(node1.getItem(), node2.getItem());
+        return true;
+    }
+
+    template<typename Visitor, typename OtherNode,
+            typename std::enable_if<!std::is_void<decltype(std::declval<Visitor>()(std::declval<ItemType>(), std::declval<OtherNode>().getItem()))>::value, std::nullptr_t>::type = nullptr >
+    static bool visitJoin(Visitor&& visitor, const Node& node1, const OtherNode& node2)
+    {
+        return visitor(node1.getItem(), node2.getItem());
+    }
+
     // MSVC 2015 does not implement C++11 expression SFINAE and considers this a
     // redefinition of a previous method
 #if !defined(_MSC_VER) || _MSC_VER >= 1910
@@ -641,6 +958,45 @@ protected:
         return true; // continue searching
     }
 
+    // Descend into the larger of two nodes, unless it is a leaf.
+    template<typename OtherNode>
+    static bool descendFirst(const Node& node1, const OtherNode& node2) {
+        if (node1.isLeaf()) {
+            return false;
+        }
+        return node2.isLeaf() || node1.getSize() >= node2.getSize();
+    }
+
+    template<typename OtherNode, typename Visitor>
+    bool join(const Node& node1, const OtherNode& node2, Visitor&& visitor) {
+        if (!node1.boundsIntersect(node2.getBounds())) {
+            return true;
+        }
+
+        if (node1.isLeaf() && node2.isLeaf()) {
+            if (node1.isDeleted() || node2.isDeleted()) {
+                return true;
+            }
+            return visitJoin(visitor, node1, node2);
+        }
+
+        if (descendFirst(node1, node2)) {
+            for (auto* child = node1.beginChildren(); child < node1.endChildren(); ++child) {
+                if (!join(*child, node2, visitor)) {
+                    return false; // abort query
+                }
+            }
+        } else {
+            for (auto* child = node2.beginChildren(); child < node2.endChildren(); ++child) {
+                if (!join(node1, *child, visitor)) {
+                    return false; // abort query
+                }
+            }
+        }
+
+        return true; // continue searching
+    }
+
     bool remove(const BoundsType& queryEnv,
                 const Node& node,
                 const ItemType& item) {
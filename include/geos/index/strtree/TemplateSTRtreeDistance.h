@@ -59,6 +59,54 @@ public:
         return isWithinDistance(initPair, maxDistance);
     }
 
+    /**
+     * Visit the items of the tree rooted at `root` in order of increasing
+     * distance to the item of the leaf `queryNode`, stopping at items
+     * further than `maxDistance` or when the visitor returns false.
+     * The visitor is called with each item and its distance.
+     */
+    template<typename Visitor>
+    void nearestItems(const Node& root, const Node& queryNode, double maxDistance, Visitor&& visitor) {
+        if (root.isDeleted()) {
+            return;
+        }
+
+        PairQueue priQ;
+        priQ.emplace(root, queryNode, m_id);
+
+        while (!priQ.empty()) {
+            NodePair pair = priQ.top();
+            priQ.pop();
+
+            /*
+             * The distance of a pair of nodes is a lower bound on the
+             * distance of the items they contain, so leaves are
+             * reached in order of increasing distance.
+             */
+            if (pair.getDistance() > maxDistance) {
+                return;
+            }
+
+            const Node& node = pair.getFirst();
+            if (node.isLeaf()) {
+                if (!visitor(node.getItem(), pair.getDistance())) {
+                    return;
+                }
+                continue;
+            }
+
+            for (const auto* child = node.beginChildren(); child < node.endChildren(); ++child) {
+                if (child->isDeleted()) {
+                    continue;
+                }
+                NodePair sp(*child, queryNode, m_id);
+                if (sp.getDistance() <= maxDistance) {
+                    priQ.push(sp);
+                }
+            }
+        }
+    }
+
 private:
 
     ItemPair nearestNeighbour(NodePair& initPair, double maxDistance) {
@@ -57,6 +57,11 @@ public:
         byteOrder = order;
     };
 
+    int getOrder() const
+    {
+        return byteOrder;
+    };
+
     unsigned char readByte() // throws ParseException
     {
         if(size() < 1) {
@@ -108,6 +113,20 @@ public:
         return ret;
     };
 
+    /**
+     * Skips the next n bytes of the stream and returns a pointer
+     * to them, for reading arrays of values in bulk.
+     */
+    const unsigned char* readBytes(size_t n) // throws ParseException
+    {
+        if(size() < n) {
+            throw ParseException("Unexpected EOF parsing WKB");
+        }
+        auto ret = buf;
+        buf += n;
+        return ret;
+    };
+
     size_t size() const
     {
         return static_cast<size_t>(end - buf);
@@ -0,0 +1,101 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <geos/io/GeoJSON.h>
+#include <geos/geom/Geometry.h>
+
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class GeometryFactory;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoJSONStreamReader
+ * \brief Streaming GeoJSON reader, which passes features to a callback
+ * as they are parsed.
+ *
+ * Unlike GeoJSONReader, the document is not parsed into a JSON tree
+ * before it is read: coordinates are added to coordinate sequences as
+ * they are parsed, and each feature of a FeatureCollection is passed to
+ * the callback, and released, once its closing brace has been read.
+ * The memory used is therefore bounded by the size of the largest feature
+ * rather than by the size of the document.
+ *
+ * The features read are the same as those of GeoJSONReader::readFeatures(),
+ * except that a floating-point id is kept as written in the document.
+ * Since members of a JSON object may be in any order, the features of a
+ * FeatureCollection are passed to the callback before its "type" member
+ * may have been read. A document which turns out not to be a
+ * FeatureCollection then throws a ParseException once it has been read.
+ */
+class GEOS_DLL GeoJSONStreamReader {
+public:
+
+    using FeatureHandler = std::function<void(GeoJSONFeature&&)>;
+    using GeometryHandler = std::function<void(std::unique_ptr<geom::Geometry>&&)>;
+
+    /**
+     * \brief Initialize parser with given GeometryFactory.
+     *
+     * The factory must outlive the reader and the geometries it creates.
+     */
+    GeoJSONStreamReader(const geom::GeometryFactory& gf);
+
+    /// Initialize parser with default GeometryFactory.
+    GeoJSONStreamReader();
+
+    /**
+     * Reads the features of a GeoJSON document.
+     *
+     * @param is the stream to read
+     * @param handler a function called with each feature, in document order
+     * @throws ParseException if the document is not valid GeoJSON
+     */
+    void readFeatures(std::istream& is, const FeatureHandler& handler) const;
+
+    /// Reads the features of a GeoJSON string.
+    void readFeatures(const std::string& geoJsonText, const FeatureHandler& handler) const;
+
+    /**
+     * Reads the geometries of the features of a GeoJSON document,
+     * or the geometry of a document which is a single geometry.
+     *
+     * @param is the stream to read
+     * @param handler a function called with each geometry, in document order
+     * @throws ParseException if the document is not valid GeoJSON
+     */
+    void readGeometries(std::istream& is, const GeometryHandler& handler) const;
+
+private:
+
+    const geom::GeometryFactory& geometryFactory;
+
+};
+
+} // namespace io
+} // namespace geos
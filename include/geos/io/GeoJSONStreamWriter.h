@@ -0,0 +1,192 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <geos/io/GeoJSON.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class Geometry;
+class Polygon;
+}
+namespace io {
+class Writer;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoJSONStreamWriter
+ * \brief Writes GeoJSON features incrementally to a stream.
+ *
+ * Unlike GeoJSONWriter, no JSON document tree is built: text is appended
+ * to an internal buffer as each feature is written, and the buffer is
+ * passed to the output whenever it is full. Writing a FeatureCollection
+ * of any size therefore uses memory bounded by the size of the largest
+ * feature.
+ *
+ * A FeatureCollection is written by calling beginFeatureCollection(),
+ * writeFeature() for each feature, and endFeatureCollection().
+ * Numbers are formatted in the same way as by WKTWriter.
+ *
+ * Buffered text is written to the output by flush(), which is
+ * called by the destructor.
+ */
+class GEOS_DLL GeoJSONStreamWriter {
+public:
+
+    /// The size of the buffer above which text is written to the output
+    static constexpr std::size_t BUFFER_SIZE = 64 * 1024;
+
+    /// Creates a writer to a stream.
+    explicit GeoJSONStreamWriter(std::ostream& os);
+
+    /// Creates a writer appending to a Writer.
+    explicit GeoJSONStreamWriter(Writer& writer);
+
+    ~GeoJSONStreamWriter();
+
+    GeoJSONStreamWriter(const GeoJSONStreamWriter&) = delete;
+    GeoJSONStreamWriter& operator=(const GeoJSONStreamWriter&) = delete;
+
+    /**
+     * Sets the number of decimal places of the coordinates written.
+     * A precision of -1, the default, uses the maximum significant
+     * digits of the precision model of each geometry.
+     *
+     * @param p the new precision to use
+     */
+    void setRoundingPrecision(int p)
+    {
+        roundingPrecision = p;
+    }
+
+    /**
+     * Sets the output dimension.
+     *
+     * @param newOutputDimension Supported values are 2 or 3.
+     *        Note that 3 indicates up to 3 dimensions will be
+     *        written but 2D GeoJSON is still produced for 2D geometries.
+     */
+    void setOutputDimension(uint8_t newOutputDimension);
+
+    /**
+     * Starts a FeatureCollection.
+     *
+     * @throws util::IllegalStateException if a collection has been started
+     */
+    void beginFeatureCollection();
+
+    /**
+     * Ends the FeatureCollection and flushes the buffer.
+     *
+     * @throws util::IllegalStateException if no collection has been started
+     */
+    void endFeatureCollection();
+
+    /**
+     * Writes a feature, as a member of the current FeatureCollection
+     * or on its own.
+     */
+    void writeFeature(const GeoJSONFeature& feature);
+
+    /**
+     * Writes a feature with the given geometry, properties and id.
+     * An empty id is not written.
+     */
+    void writeFeature(const geom::Geometry& geometry,
+                      const std::map<std::string, GeoJSONValue>& properties,
+                      const std::string& id = "");
+
+    /**
+     * Writes a GeoJSON geometry object.
+     *
+     * @throws util::IllegalStateException if a FeatureCollection has been started
+     */
+    void writeGeometry(const geom::Geometry& geometry);
+
+    /// Writes the buffered text to the output.
+    void flush();
+
+private:
+
+    std::ostream* os;
+    Writer* writer;
+    std::string buf;
+
+    int roundingPrecision;
+    uint8_t outputDimension;
+    uint32_t decimalPlaces;
+    bool isInCollection;
+    bool isFirstFeature;
+
+    void append(const char* s, std::size_t len)
+    {
+        buf.append(s, len);
+    }
+
+    void append(const char* s)
+    {
+        buf.append(s);
+    }
+
+    void append(const std::string& s)
+    {
+        buf.append(s);
+    }
+
+    void flushIfFull();
+
+    void appendNumber(double d, uint32_t precision);
+
+    void appendPropertyNumber(double d);
+
+    void appendString(const std::string& s);
+
+    void appendValue(const GeoJSONValue& value);
+
+    void appendGeometry(const geom::Geometry& geometry);
+
+    void appendPosition(const geom::CoordinateSequence& seq, std::size_t i);
+
+    void appendCoordinates(const geom::CoordinateSequence& seq);
+
+    void appendPolygonCoordinates(const geom::Polygon& polygon);
+
+};
+
+} // namespace geos::io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,212 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Geometry.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iosfwd>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class GeometryFactory;
+}
+namespace util {
+class ThreadPool;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \brief Reads a stream of WKT or hex-encoded WKB geometries, parsing
+ * them on a pool of threads.
+ *
+ * A reader thread splits the stream into records, in the same way as
+ * WKTStreamReader and WKBStreamReader, and the records are parsed
+ * concurrently. Parsed geometries are returned by next() in stream order.
+ * At most a fixed number of records are read ahead of the
+ * consumer, which bounds the memory used.
+ *
+ * A record which fails to parse throws its ParseException from the call
+ * to next() which would have returned it; reading may continue with the
+ * following record.
+ *
+ * The stream must not be used by the caller until the reader has
+ * been destroyed. Destroying the reader waits for the record being
+ * read from the stream, if any.
+ */
+class GEOS_DLL ParallelStreamReader {
+
+public:
+
+    enum class Format {
+        WKT,
+        WKB_HEX
+    };
+
+    /**
+     * Creates a reader and starts reading the stream.
+     *
+     * @param instr the stream to read
+     * @param format the format of the records
+     * @param numThreads the number of threads parsing records,
+     *        including the thread calling next() (0 for one per
+     *        hardware thread)
+     * @param queueSize the maximum number of records read ahead of
+     *        the consumer (0 for a default depending on numThreads)
+     * @param factory the factory used to create geometries, or
+     *        nullptr for the default factory
+     */
+    ParallelStreamReader(std::istream& instr, Format format,
+                         std::size_t numThreads = 0,
+                         std::size_t queueSize = 0,
+                         const geom::GeometryFactory* factory = nullptr);
+
+    ~ParallelStreamReader();
+
+    ParallelStreamReader(const ParallelStreamReader&) = delete;
+    ParallelStreamReader& operator=(const ParallelStreamReader&) = delete;
+
+    /**
+     * Returns the next geometry of the stream.
+     *
+     * @return the next geometry, or nullptr at the end of the stream
+     * @throws ParseException if the record cannot be parsed
+     */
+    std::unique_ptr<geom::Geometry> next();
+
+    /// The number of records read ahead for each thread by default
+    static constexpr std::size_t RECORDS_PER_THREAD = 64;
+
+    /**
+     * An input iterator over the geometries of a reader.
+     * Advancing the iterator may throw ParseException.
+     */
+    class GEOS_DLL Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::unique_ptr<geom::Geometry>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type*;
+        using reference = value_type&;
+
+        Iterator() : reader(nullptr) {}
+
+        explicit Iterator(ParallelStreamReader* p_reader)
+            : reader(p_reader)
+        {
+            ++(*this);
+        }
+
+        reference operator*() {
+            return current;
+        }
+
+        pointer operator->() {
+            return &current;
+        }
+
+        Iterator& operator++() {
+            current = reader->next();
+            if (current == nullptr) {
+                reader = nullptr;
+            }
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return reader == other.reader;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        ParallelStreamReader* reader;
+        value_type current;
+    };
+
+    /// Returns an iterator over the remaining geometries of the stream.
+    Iterator begin() {
+        return Iterator(this);
+    }
+
+    Iterator end() {
+        return Iterator();
+    }
+
+private:
+
+    // A record and its parse result, held in a ring buffer
+    struct Slot {
+        enum State { FREE, QUEUED, PARSED };
+
+        State state = FREE;
+        std::string record;
+        std::unique_ptr<geom::Geometry> geom;
+        std::exception_ptr error;
+    };
+
+    std::istream& instr;
+    Format format;
+    const geom::GeometryFactory* factory;
+
+    std::unique_ptr<util::ThreadPool> pool;
+    std::vector<Slot> slots;
+
+    std::mutex mtx;
+    std::condition_variable cond;
+    std::size_t numRead;     // guarded by mtx
+    std::size_t numTaken;    // guarded by mtx
+    std::size_t numRunning;  // parse tasks not yet finished, guarded by mtx
+    bool isEndOfStream;      // guarded by mtx
+    bool isStopping;         // guarded by mtx
+    std::exception_ptr readError; // guarded by mtx
+
+    std::thread readerThread;
+
+    void readRecords();
+
+    void parse(std::size_t index);
+
+    template<typename Predicate>
+    void waitHelping(std::unique_lock<std::mutex>& lock, Predicate&& isDone);
+
+};
+
+} // namespace geos::io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -46,12 +46,28 @@ public:
     int peekNextToken();
     double getNVal() const;
     std::string getSVal() const;
+
+    /**
+     * Parses a decimal number, including infinities and NaN.
+     * Where std::from_chars supports floating point numbers
+     * the result does not depend on the current locale.
+     *
+     * @param first the first character of the number
+     * @param last the end of the number, which must all be parsed
+     * @param result the parsed number
+     * @return false if the characters are not a number
+     */
+    static bool readDouble(const char* first, const char* last, double& result);
+
 private:
     const std::string& str;
     std::string stok;
     double ntok;
     std::string::const_iterator iter;
 
+    std::string::const_iterator skipWhitespace() const;
+    int readToken(std::string::const_iterator start, std::string::const_iterator& end);
+
     // Declare type as noncopyable
     StringTokenizer(const StringTokenizer& other) = delete;
     StringTokenizer& operator=(const StringTokenizer& rhs) = delete;
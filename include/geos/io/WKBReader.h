@@ -27,7 +27,6 @@
 #include <iosfwd> // ostream, istream
 #include <memory>
 // #include <vector>
-#include <array>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -144,8 +143,6 @@ private:
 
     ByteOrderDataInStream dis;
 
-    std::array<double, 4> ordValues;
-
     std::unique_ptr<geom::Geometry> readGeometry();
 
     std::unique_ptr<geom::Point> readPoint();
@@ -178,8 +175,6 @@ private:
 
     void minMemSize(geom::GeometryTypeId geomType, uint64_t size) const;
 
-    void readCoordinate(); // throws IOException
-
     template<typename T>
     std::unique_ptr<T> readChild()
     {
@@ -37,6 +37,13 @@ public:
 
     std::unique_ptr<geom::Geometry> next();
 
+    /**
+     * Reads the next record, a line of hex-encoded WKB, from a stream.
+     *
+     * @return false if at EOF
+     */
+    static bool nextRecord(std::istream& instr, std::string& record);
+
 private:
 
     std::istream& instr;
@@ -38,6 +38,14 @@ public:
 
     std::unique_ptr<geos::geom::Geometry> next();
 
+    /**
+     * Reads the next record, the lines of text holding one WKT
+     * geometry, from a stream.
+     *
+     * @return false if at EOF
+     */
+    static bool nextRecord(std::istream& instr, std::string& record);
+
 private:
 
     std::istream& instr;
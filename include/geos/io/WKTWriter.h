@@ -272,6 +272,9 @@ protected:
 
     std::string writeNumber(double d) const;
 
+    /// Writes a number as by writeNumber(double), without a temporary string when trimming
+    void appendNumber(double d, Writer& writer) const;
+
     void appendCurveText(
         const geom::Curve& lineString,
         OrdinateSet outputOrdinates,
@@ -21,6 +21,7 @@
 
 #include <geos/export.h>
 
+#include <cstddef>
 #include <string>
 
 #ifdef _MSC_VER
@@ -37,6 +38,8 @@ public:
     void reserve(std::size_t capacity);
     ~Writer() = default;
     void write(const std::string& txt);
+    void write(const char* txt);
+    void write(const char* txt, std::size_t len);
     const std::string& toString();
 private:
     std::string str;
@@ -45,12 +45,13 @@ namespace noding { // geos::noding
  * against a target set of lines.
  * Short-circuited to return as soon an intersection is found.
  *
+ * Once constructed, the finder may be used from several threads at once.
+ *
  * @version 1.7
  */
 class FastSegmentSetIntersectionFinder {
 private:
     std::unique_ptr<MCIndexSegmentSetMutualIntersector> segSetMutInt;
-    std::unique_ptr<geos::algorithm::LineIntersector> lineIntersector;
 
 protected:
 public:
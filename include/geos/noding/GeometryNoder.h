@@ -21,6 +21,7 @@
 #include <geos/export.h>
 #include <geos/noding/SegmentString.h> // for NonConstVect
 
+#include <cstddef>
 #include <memory> // for unique_ptr
 
 // Forward declarations
@@ -45,10 +46,24 @@ public:
 
     std::unique_ptr<geom::Geometry> getNoded();
 
+    /**
+     * Sets the number of threads used to node the geometry.
+     * The result does not depend on the number of threads.
+     *
+     * @param p_numThreads the number of threads, or 0 to use
+     *        the number of hardware threads. The default is 1.
+     */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
 private:
 
     const geom::Geometry& argGeom;
 
+    std::size_t numThreads;
+
     SegmentString::NonConstVect lineList;
 
     static void extractSegmentStrings(const geom::Geometry& g,
@@ -22,8 +22,10 @@
 
 #include <vector>
 #include <iostream>
+#include <memory>
 #include <cstdlib> // for abs()
 
+#include <geos/algorithm/LineIntersector.h> // for composition
 #include <geos/geom/Coordinate.h>
 #include <geos/noding/SegmentIntersector.h> // for inheritance
 
@@ -31,9 +33,7 @@
 namespace geos {
 namespace noding {
 class SegmentString;
-}
-namespace algorithm {
-class LineIntersector;
+class NodedSegmentString;
 }
 }
 
@@ -67,7 +67,23 @@ private:
     // the proper intersection point found
     geom::CoordinateXYZM properIntersectionPoint;
 
+    // the LineIntersector of a local intersector
+    std::unique_ptr<algorithm::LineIntersector> localLi;
     algorithm::LineIntersector& li;
+
+    // Nodes found by a local intersector, added to
+    // their segment strings by mergeLocal()
+    struct LocalNode {
+        NodedSegmentString* segStr;
+        geom::CoordinateXYZM pt;
+        std::size_t segIndex;
+    };
+    bool isLocal;
+    std::vector<LocalNode> localNodes;
+
+    IntersectionAdder(std::unique_ptr<algorithm::LineIntersector> p_li);
+
+    void addIntersections(NodedSegmentString* segStr, std::size_t segIndex);
     // bool isSelfIntersection;
     // bool intersectionFound;
 
@@ -101,6 +117,7 @@ public:
         hasInterior(false),
         properIntersectionPoint(),
         li(newLi),
+        isLocal(false),
         numIntersections(0),
         numInteriorIntersections(0),
         numProperIntersections(0),
@@ -178,6 +195,19 @@ public:
         SegmentString* e1,  std::size_t segIndex1) override;
 
 
+    /** \brief
+     * Creates an intersector using a copy of the LineIntersector of this
+     * intersector, which records the nodes it finds until they are added
+     * to their segment strings by mergeLocal().
+     */
+    std::unique_ptr<SegmentIntersector> createLocal() const override;
+
+    /** \brief
+     * Adds the nodes found by a local intersector to their segment
+     * strings, and combines its statistics with those of this intersector.
+     */
+    void mergeLocal(SegmentIntersector& local) override;
+
     static bool
     isAdjacentSegments(std::size_t i1, std::size_t i2)
     {
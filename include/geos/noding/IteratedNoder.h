@@ -59,6 +59,7 @@ private:
     algorithm::LineIntersector li;
     std::vector<SegmentString*>* nodedSegStrings;
     int maxIter;
+    std::size_t numThreads;
 
     /**
      * Node the input segment strings once
@@ -74,7 +75,8 @@ public:
         :
         pm(newPm),
         li(pm),
-        maxIter(MAX_ITER)
+        maxIter(MAX_ITER),
+        numThreads(1)
     {
     }
 
@@ -96,6 +98,19 @@ public:
         maxIter = n;
     }
 
+    /** \brief
+     * Sets the number of threads used by each noding iteration.
+     *
+     * @param n the number of threads, or 0 to use the number of
+     *          hardware threads
+     * @see MCIndexNoder::setNumThreads
+     */
+    void
+    setNumThreads(std::size_t n)
+    {
+        numThreads = n;
+    }
+
     std::vector<SegmentString*>*
     getNodedSubstrings() const override
     {
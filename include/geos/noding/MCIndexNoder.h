@@ -60,6 +60,11 @@ namespace noding { // geos.noding
  * envelope (range) queries efficiently (such as a [Quadtree](@ref index::quadtree::Quadtree)
  * or [STRtree](@ref index::strtree::STRtree)).
  *
+ * The overlap search can be distributed over several threads
+ * (see setNumThreads()), if the SegmentIntersector supports
+ * SegmentIntersector::createLocal(). The nodes computed are the
+ * same as those computed by a single thread.
+ *
  * Last port: noding/MCIndexNoder.java rev. 1.4 (JTS-1.7)
  */
 class GEOS_DLL MCIndexNoder : public SinglePassNoder {
@@ -72,9 +77,12 @@ private:
     int nOverlaps;
     double overlapTolerance;
     bool indexBuilt;
+    std::size_t numThreads;
 
     void intersectChains();
 
+    bool intersectChainsParallel();
+
     void add(SegmentString* segStr);
 
 public:
@@ -85,10 +93,28 @@ public:
         , nOverlaps(0)
         , overlapTolerance(p_overlapTolerance)
         , indexBuilt(false)
+        , numThreads(1)
     {}
 
     ~MCIndexNoder() override {};
 
+    /** \brief
+     * Sets the number of threads used to search for overlapping chains.
+     *
+     * Each thread processes the overlaps of a share of the chains with
+     * an intersector created by SegmentIntersector::createLocal(), and
+     * the results are merged in a fixed order. If the SegmentIntersector
+     * does not support local intersectors, or the input is small, a
+     * single thread is used.
+     *
+     * @param p_numThreads the number of threads to use, or 0 to use the
+     *        number of hardware threads. The default is 1.
+     */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
 
     /// \brief Return a reference to this instance's std::vector of MonotoneChains
     std::vector<index::chain::MonotoneChain>&
@@ -19,6 +19,8 @@
 #include <geos/index/chain/MonotoneChain.h> // inherited
 #include <geos/index/strtree/TemplateSTRtree.h> // inherited
 
+#include <mutex>
+
 namespace geos {
 namespace geom {
     class Envelope;
@@ -53,7 +55,6 @@ public:
         , processCounter(0)
         , nOverlaps(0)
         , overlapTolerance(p_tolerance)
-        , indexBuilt(false)
         , envelope(nullptr)
     {}
 
@@ -63,7 +64,6 @@ public:
         , processCounter(0)
         , nOverlaps(0)
         , overlapTolerance(0.0)
-        , indexBuilt(false)
         , envelope(p_envelope)
     {}
 
@@ -85,6 +85,20 @@ public:
     // NOTE: re-populates the MonotoneChain vector with newly created chains
     void process(SegmentString::ConstVect* segStrings) override;
 
+    /**
+     * Computes the intersections between the base segments and the given
+     * segment strings, reporting them to the given SegmentIntersector
+     * rather than the one set with setSegmentIntersector().
+     *
+     * The state of this object is not modified once its index has been
+     * built, so this may be called concurrently from several threads,
+     * each with its own SegmentIntersector.
+     *
+     * @param segStrings the segment strings to intersect with the base segments
+     * @param p_segInt the SegmentIntersector receiving the intersections
+     */
+    void process(SegmentString::ConstVect* segStrings, SegmentIntersector& p_segInt);
+
     class SegmentOverlapAction : public index::chain::MonotoneChainOverlapAction {
     private:
         SegmentIntersector& si;
@@ -129,15 +143,17 @@ private:
     /* memory management helper, holds MonotoneChain objects used
      * in the SpatialIndex. It's cleared when the SpatialIndex is
      */
-    bool indexBuilt;
+    std::once_flag indexBuilt;
     MonoChains indexChains;
     const geom::Envelope* envelope;
 
     void addToIndex(SegmentString* segStr);
 
-    void intersectChains();
+    void buildIndex();
+
+    void intersectChains(MonoChains& chains, SegmentIntersector& si, int& overlaps);
 
-    void addToMonoChains(SegmentString* segStr);
+    void addToMonoChains(SegmentString* segStr, MonoChains& chains) const;
 
 };
 
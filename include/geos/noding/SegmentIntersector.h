@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 #include <geos/export.h>
 
 // Forward declarations
@@ -71,6 +72,40 @@ public:
         return false;
     }
 
+    /**
+     * \brief
+     * Creates an intersector which processes a share of the segment
+     * pairs of an arrangement on another thread.
+     *
+     * The local intersector accumulates its results without modifying
+     * this intersector or the segment strings, until they are combined
+     * with mergeLocal().
+     *
+     * @return a new local intersector, or null if this intersector
+     *         does not support concurrent processing (the default)
+     */
+    virtual std::unique_ptr<SegmentIntersector>
+    createLocal() const
+    {
+        return nullptr;
+    }
+
+    /**
+     * \brief
+     * Combines the results accumulated by an intersector created
+     * with createLocal() into this intersector.
+     *
+     * Local intersectors are merged in a fixed order, so that the
+     * result does not depend on the scheduling of the threads.
+     *
+     * @param local an intersector created by createLocal() on this intersector
+     */
+    virtual void
+    mergeLocal(SegmentIntersector& local)
+    {
+        (void) local;
+    }
+
     virtual
     ~SegmentIntersector()
     { }
@@ -96,6 +96,7 @@ private:
     std::deque<Edge> edgeQue;
     bool inputHasZ;
     bool inputHasM;
+    std::size_t numThreads;
 
     /**
     * Gets a noder appropriate for the precision model supplied.
@@ -197,6 +198,7 @@ public:
         , intAdder(lineInt)
         , inputHasZ(false)
         , inputHasM(false)
+        , numThreads(1)
         {};
 
     ~EdgeNodingBuilder()
@@ -208,6 +210,14 @@ public:
 
     void setClipEnvelope(const Envelope* clipEnv);
 
+    /**
+    * Sets the number of threads used by the floating precision noder.
+    */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
     // returns newly allocated vector and segmentstrings
     // std::vector<noding::SegmentString*>* node();
 
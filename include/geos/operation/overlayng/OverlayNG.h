@@ -136,6 +136,7 @@ private:
     bool isOutputEdges;
     bool isOutputResultEdges;
     bool isOutputNodedEdges;
+    std::size_t numThreads;
 
     // Methods
     std::unique_ptr<geom::Geometry> computeEdgeOverlay();
@@ -194,6 +195,7 @@ public:
         , isOutputEdges(false)
         , isOutputResultEdges(false)
         , isOutputNodedEdges(false)
+        , numThreads(1)
     {}
 
     /**
@@ -213,6 +215,7 @@ public:
         , isOutputEdges(false)
         , isOutputResultEdges(false)
         , isOutputNodedEdges(false)
+        , numThreads(1)
     {}
 
     /**
@@ -251,6 +254,17 @@ public:
     void setOutputResultEdges(bool p_isOutputResultEdges) { isOutputResultEdges = p_isOutputResultEdges; }
     void setNoder(noding::Noder* p_noder) { noder = p_noder; }
 
+    /**
+    * Sets the number of threads used to node the input edges,
+    * when the overlay uses floating precision and no custom noder.
+    * The result does not depend on the number of threads.
+    * Default is 1.
+    *
+    * @param p_numThreads the number of threads, or 0 to use
+    *        the number of hardware threads
+    */
+    void setNumThreads(std::size_t p_numThreads) { numThreads = p_numThreads; }
+
     void setOutputNodedEdges(bool p_isOutputNodedEdges)
     {
         isOutputEdges = true;
@@ -151,6 +151,18 @@ public:
     static std::unique_ptr<Geometry> Union(
         const Geometry* a);
 
+    /**
+    * Computes the unary union of a geometry, unioning its polygonal
+    * components on the given number of threads.
+    * The result is identical to Union(const Geometry*).
+    *
+    * @param a the geometry to union
+    * @param numThreads the number of threads (0 for one per hardware thread)
+    * @return the union of the components of the geometry
+    */
+    static std::unique_ptr<Geometry> Union(
+        const Geometry* a, std::size_t numThreads);
+
     static std::unique_ptr<Geometry> Overlay(
         const Geometry* geom0, const Geometry* geom1, int opCode);
 
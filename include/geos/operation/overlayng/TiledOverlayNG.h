@@ -0,0 +1,162 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryFactory;
+class Polygon;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+/**
+ * Computes the overlay of two large polygonal geometries by
+ * partitioning the plane into a regular grid of cells.
+ *
+ * The polygons of each input are indexed once, and those intersecting
+ * a cell are clipped to it with a RingClipper. The
+ * clipped inputs are overlaid with OverlayNGRobust, which bounds the
+ * size of each overlay and allows the cells to be processed in parallel.
+ * Result polygons which lie in the interior of a cell are final;
+ * the polygons which touch a side shared with another cell are
+ * stitched together by a unary union.
+ *
+ * Since the set-theoretic overlay operations are local, the result is
+ * topologically equal to the untiled overlay of the inputs.
+ * It may contain additional vertices where polygon boundaries
+ * were split by cell sides and not re-merged.
+ * For polygonal inputs the result is always polygonal, as for OverlayNG
+ * in strict mode, whether or not the inputs are tiled.
+ *
+ * Only non-empty polygonal inputs without Z, M or curves are tiled.
+ * The inputs are assumed to be valid, as they are by OverlayNG:
+ * their validity is not checked, since that costs about as much as
+ * the overlay itself. For other inputs the overlay is computed by
+ * OverlayNGRobust without tiling, and non-polygonal inputs give the
+ * same (non-strict) result as OverlayNGRobust.
+ */
+class GEOS_DLL TiledOverlayNG {
+    using Envelope = geos::geom::Envelope;
+    using Geometry = geos::geom::Geometry;
+    using GeometryFactory = geos::geom::GeometryFactory;
+    using Polygon = geos::geom::Polygon;
+
+public:
+
+    /**
+     * Creates a tiled overlay operation on the given geometries.
+     *
+     * @param geom0 the A operand
+     * @param geom1 the B operand
+     * @param opCode the overlay opcode, as defined by OverlayNG
+     */
+    TiledOverlayNG(const Geometry* geom0, const Geometry* geom1, int opCode);
+
+    /**
+     * Sets the number of grid cells along each axis.
+     * By default (0, 0) the grid is sized from the number of input
+     * vertices, aiming at TARGET_VERTICES_PER_CELL vertices per cell.
+     */
+    void setGridSize(std::size_t p_numCellsX, std::size_t p_numCellsY)
+    {
+        numCellsX = p_numCellsX;
+        numCellsY = p_numCellsY;
+    }
+
+    /**
+     * Sets the number of threads used to overlay the cells and
+     * to stitch their results.
+     * The default is 1; 0 uses one thread per hardware thread.
+     */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
+    /**
+     * Computes the overlay.
+     *
+     * @return the result of the overlay operation
+     * @throws util::TopologyException if a robustness problem is encountered
+     */
+    std::unique_ptr<Geometry> getResult();
+
+    /**
+     * Computes the tiled overlay of two geometries, with an
+     * automatically sized grid.
+     *
+     * @param geom0 the A operand
+     * @param geom1 the B operand
+     * @param opCode the overlay opcode, as defined by OverlayNG
+     * @param numThreads the number of threads (0 for one per hardware thread)
+     * @return the result of the overlay operation
+     */
+    static std::unique_ptr<Geometry> overlay(const Geometry* geom0, const Geometry* geom1,
+                                             int opCode, std::size_t numThreads);
+
+    /// The number of input vertices per cell aimed at by the automatic grid
+    static constexpr std::size_t TARGET_VERTICES_PER_CELL = 20000;
+
+    /// The maximum number of cells along each axis of the automatic grid
+    static constexpr std::size_t MAX_CELLS_PER_AXIS = 64;
+
+private:
+
+    using PolygonIndex = index::strtree::TemplateSTRtree<const Polygon*>;
+
+    const Geometry* geom0;
+    const Geometry* geom1;
+    int opCode;
+    const GeometryFactory* geomFact;
+    std::size_t numCellsX;
+    std::size_t numCellsY;
+    std::size_t numThreads;
+
+    bool isTileable() const;
+
+    void computeGridSize(const Envelope& extent);
+
+    static void indexPolygons(const Geometry* geom, PolygonIndex& index);
+
+    std::unique_ptr<Geometry> clip(PolygonIndex& index, const Envelope& cell) const;
+
+    std::unique_ptr<Polygon> clip(const Polygon& poly, const Envelope& cell) const;
+
+    static double gridLine(double min, double max, std::size_t i, std::size_t n);
+
+    std::unique_ptr<Geometry> toPolygonal(std::vector<std::unique_ptr<Geometry>>& parts) const;
+
+    std::unique_ptr<Geometry> overlayPolygonal(const Geometry* g0, const Geometry* g1) const;
+
+};
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
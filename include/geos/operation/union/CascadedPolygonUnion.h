@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 #include <geos/export.h>
@@ -35,6 +36,9 @@ class Polygon;
 class MultiPolygon;
 class Envelope;
 }
+namespace util {
+class ThreadPool;
+}
 }
 
 namespace geos {
@@ -99,6 +103,11 @@ private:
  * many segments at each stage of processing.
  * The best case for buffer(0) is the trivial case where there is `no` overlap
  * between the input geometries. However, this case is likely rare in practice.
+ *
+ * The binary union tree can optionally be evaluated by several threads
+ * (see setNumThreads()). Independent subtrees are unioned concurrently on a
+ * work-stealing thread pool, following exactly the same pairing as the
+ * serial evaluation, so the result is identical to the single-threaded one.
  */
 class GEOS_DLL CascadedPolygonUnion {
 private:
@@ -140,7 +149,8 @@ public:
      *              ownership of elements *and* vector are left to caller.
      */
     static std::unique_ptr<geom::Geometry> Union(std::vector<geom::Polygon*>* polys);
-    static std::unique_ptr<geom::Geometry> Union(std::vector<geom::Polygon*>* polys, UnionStrategy* unionFun);
+    static std::unique_ptr<geom::Geometry> Union(std::vector<geom::Polygon*>* polys, UnionStrategy* unionFun,
+                                                 std::size_t numThreads = 1);
 
     /** \brief
      * Computes the union of a set of polygonal [Geometrys](@ref geom::Geometry).
@@ -149,17 +159,18 @@ public:
      * @param start start iterator
      * @param end end iterator
      * @param unionStrategy strategy to apply
+     * @param numThreads number of threads to use (0 for one per hardware thread)
      */
     template <class T>
     static std::unique_ptr<geom::Geometry>
-    Union(T start, T end, UnionStrategy *unionStrategy)
+    Union(T start, T end, UnionStrategy *unionStrategy, std::size_t numThreads = 1)
     {
         std::vector<geom::Polygon*> polys;
         for(T i = start; i != end; ++i) {
             const geom::Polygon* p = dynamic_cast<const geom::Polygon*>(*i);
             polys.push_back(const_cast<geom::Polygon*>(p));
         }
-        return Union(&polys, unionStrategy);
+        return Union(&polys, unionStrategy, numThreads);
     }
 
     /** \brief
@@ -181,14 +192,31 @@ public:
         : inputPolys(polys)
         , geomFactory(nullptr)
         , unionFunction(&defaultUnionFunction)
+        , numThreads(1)
     {}
 
     CascadedPolygonUnion(std::vector<geom::Polygon*>* polys, UnionStrategy* unionFun)
         : inputPolys(polys)
         , geomFactory(nullptr)
         , unionFunction(unionFun)
+        , numThreads(1)
     {}
 
+    /** \brief
+     * Sets the number of threads used to evaluate the union tree.
+     *
+     * The default of 1 computes the union on the calling thread.
+     * A value of 0 uses one thread per hardware thread.
+     * When more than one thread is used, the union strategy
+     * must be safe to call concurrently.
+     *
+     * @param p_numThreads the number of threads
+     */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
     /** \brief
      * Computes the union of the input geometries.
      *
@@ -201,6 +229,13 @@ private:
 
     UnionStrategy* unionFunction;
     ClassicUnionStrategy defaultUnionFunction;
+    std::size_t numThreads;
+
+    /**
+     * Sections with at most this many geometries are
+     * unioned serially by a single task.
+     */
+    static constexpr std::size_t PARALLEL_MIN_SECTION_SIZE = 8;
 
     /**
      * Unions a section of a list using a recursive binary union on each half
@@ -213,6 +248,19 @@ private:
      */
     std::unique_ptr<geom::Geometry> binaryUnion(const std::vector<const geom::Geometry*> & geoms, std::size_t start, std::size_t end);
 
+    /**
+     * Unions a section of a list in the same way as binaryUnion,
+     * computing the two halves of each section concurrently.
+     *
+     * @param pool the thread pool executing the subtree unions
+     * @param geoms the list of geometries containing the section to union
+     * @param start the start index of the section
+     * @param end the index after the end of the section
+     * @return the union of the list section
+     */
+    std::unique_ptr<geom::Geometry> parallelBinaryUnion(util::ThreadPool& pool,
+            const std::vector<const geom::Geometry*> & geoms, std::size_t start, std::size_t end);
+
     /**
      * Computes the union of two geometries,
      * either of both of which may be null.
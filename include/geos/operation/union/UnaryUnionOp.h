@@ -116,6 +116,7 @@ public:
     UnaryUnionOp(const T& geoms, geom::GeometryFactory& geomFactIn)
         : geomFact(&geomFactIn)
         , unionFunction(&defaultUnionFunction)
+        , numThreads(1)
     {
         extractGeoms(geoms);
     }
@@ -124,6 +125,7 @@ public:
     UnaryUnionOp(const T& geoms)
         : geomFact(nullptr)
         , unionFunction(&defaultUnionFunction)
+        , numThreads(1)
     {
         extractGeoms(geoms);
     }
@@ -131,6 +133,7 @@ public:
     UnaryUnionOp(const geom::Geometry& geom)
         : geomFact(geom.getFactory())
         , unionFunction(&defaultUnionFunction)
+        , numThreads(1)
     {
         extract(geom);
     }
@@ -140,6 +143,20 @@ public:
         unionFunction = unionFun;
     }
 
+    /**
+     * \brief
+     * Sets the number of threads used to union polygonal components.
+     *
+     * See CascadedPolygonUnion::setNumThreads(). The union function
+     * must be safe to call concurrently when more than one thread is used.
+     *
+     * @param p_numThreads the number of threads (0 for one per hardware thread)
+     */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
     /**
      * \brief
      * Gets the union of the input geometries.
@@ -229,6 +246,7 @@ private:
 
     UnionStrategy* unionFunction;
     ClassicUnionStrategy defaultUnionFunction;
+    std::size_t numThreads;
 
 };
 
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/TriangleMesh.h>
 #include <geos/geom/CoordinateSequence.h>
 
 #include <memory>
@@ -78,6 +79,22 @@ public:
      */
     static std::unique_ptr<geom::CoordinateSequence> unique(const geom::CoordinateSequence* seq);
 
+    /**
+     * Orders vertices for fast insertion by IncrementalDelaunayTriangulator,
+     * using a Biased Randomized Insertion Order (BRIO).
+     *
+     * The vertices are shuffled and split into rounds of doubling size,
+     * each of which is sorted along a Hilbert curve. Consecutive vertices
+     * are then close to each other, which keeps the point location walks
+     * short, while the randomization keeps the intermediate triangulations
+     * well-shaped. The shuffle is deterministic, so the order only
+     * depends on the input. Small inputs are sorted in lexicographic
+     * order instead.
+     *
+     * @param vertices the vertices to reorder
+     */
+    static void sortForInsertion(IncrementalDelaunayTriangulator::VertexList& vertices);
+
 private:
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
     double tolerance;
@@ -149,6 +166,15 @@ public:
      */
     std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
 
+    /**
+     * Gets the faces of the computed triangulation as a TriangleMesh
+     * of shared vertices and triangle indices, which is much more
+     * compact than the output of getTriangles().
+     *
+     * @return the faces of the triangulation
+     */
+    std::unique_ptr<TriangleMesh> getTriangleMesh();
+
     /**
      * Computes the {@link geom::Envelope} of a collection of
      * {@link geom::Coordinate}s.
@@ -0,0 +1,192 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class GeometryCollection;
+class GeometryFactory;
+}
+}
+
+namespace geos {
+namespace triangulate { // geos.triangulate
+
+/** \brief
+ * A compact, index-based representation of a triangulation.
+ *
+ * The mesh holds a shared array of vertices, and for each triangle the
+ * indices of its three vertices and of the triangles adjacent to its
+ * three edges. Edge `i` of a triangle runs from its vertex `i` to its
+ * vertex `(i + 1) % 3`, as in tri::Tri.
+ *
+ * This uses an order of magnitude less memory than a
+ * [GeometryCollection](@ref geom::GeometryCollection) of triangle
+ * polygons, and gives the topology of the triangulation directly.
+ * The mesh of a Delaunay triangulation also describes its Voronoi
+ * diagram: the circumcentres of the triangles are the Voronoi
+ * vertices, and each pair of neighbouring triangles gives a Voronoi
+ * edge.
+ *
+ * The producers of meshes share vertices with the same X and Y between
+ * the triangles which have them as corners. A mesh can be built from
+ * the coordinates of its triangles with a TriangleMeshBuilder.
+ */
+class GEOS_DLL TriangleMesh {
+
+public:
+
+    /// The neighbour index of an edge on the boundary of the mesh
+    static constexpr int32_t NO_NEIGHBOUR = -1;
+
+    /**
+     * Creates an empty mesh.
+     *
+     * @param hasZ whether the Z values of the vertices are kept
+     */
+    explicit TriangleMesh(bool hasZ = false);
+
+    TriangleMesh(const TriangleMesh&) = delete;
+    TriangleMesh& operator=(const TriangleMesh&) = delete;
+
+    /**
+     * Adds a vertex.
+     *
+     * @return the index of the vertex
+     */
+    int32_t addVertex(const geom::Coordinate& p);
+
+    /**
+     * Adds a triangle with the vertices of the given indices.
+     *
+     * @throws util::IllegalArgumentException if an index is not that of a vertex
+     */
+    void addTriangle(int32_t v0, int32_t v1, int32_t v2);
+
+    /// The vertices of the mesh
+    const geom::CoordinateSequence& getVertices() const
+    {
+        return vertices;
+    }
+
+    std::size_t getNumVertices() const
+    {
+        return vertices.size();
+    }
+
+    std::size_t getNumTriangles() const
+    {
+        return triangles.size() / 3;
+    }
+
+    /**
+     * The vertex indices of the triangles: the vertices of triangle
+     * `t` are at positions `3 * t` to `3 * t + 2`.
+     */
+    const std::vector<int32_t>& getTriangles() const
+    {
+        return triangles;
+    }
+
+    /**
+     * The indices of the triangles adjacent to each edge of the
+     * triangles, or NO_NEIGHBOUR: the neighbour across edge `i` of
+     * triangle `t` is at position `3 * t + i`.
+     *
+     * The neighbours are computed by the first call after triangles
+     * have been added, which is not thread-safe.
+     */
+    const std::vector<int32_t>& getNeighbours() const;
+
+    /// Gets vertex `i` (0 to 2) of triangle `tri`
+    geom::Coordinate getCoordinate(std::size_t tri, std::size_t i) const;
+
+    /**
+     * Creates a [GeometryCollection](@ref geom::GeometryCollection) of
+     * the triangles, as polygons.
+     */
+    std::unique_ptr<geom::GeometryCollection> toGeometry(const geom::GeometryFactory& geomFact) const;
+
+private:
+
+    geom::CoordinateSequence vertices;
+    std::vector<int32_t> triangles;
+    mutable std::vector<int32_t> neighbours;
+
+    void computeNeighbours() const;
+
+};
+
+/** \brief
+ * Builds a TriangleMesh from the coordinates of its triangles,
+ * sharing the vertices with the same X and Y.
+ *
+ * The index of the vertices is only held by the builder, and is
+ * released when the mesh is taken with getMesh().
+ */
+class GEOS_DLL TriangleMeshBuilder {
+
+public:
+
+    /**
+     * Creates a builder of an empty mesh.
+     *
+     * @param hasZ whether the Z values of the vertices are kept
+     */
+    explicit TriangleMeshBuilder(bool hasZ = false);
+
+    /**
+     * Adds a triangle with the given vertices.
+     */
+    void addTriangle(const geom::Coordinate& p0,
+                     const geom::Coordinate& p1,
+                     const geom::Coordinate& p2);
+
+    /**
+     * Gets the mesh built, after which no triangles may be added.
+     */
+    std::unique_ptr<TriangleMesh> getMesh();
+
+private:
+
+    std::unique_ptr<TriangleMesh> mesh;
+    std::unordered_map<geom::CoordinateXY, int32_t, geom::CoordinateXY::HashCode> vertexIndex;
+
+    int32_t addVertex(const geom::Coordinate& p);
+
+};
+
+} // namespace geos.triangulate
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -56,6 +56,8 @@ private:
 
     std::unique_ptr<Geometry> compute() const;
 
+    std::vector<std::unique_ptr<TriList<Tri>>> computeTris() const;
+
     static std::unique_ptr<Geometry> toGeometry(
         const geom::GeometryFactory* geomFact,
         const std::vector<std::unique_ptr<TriList<Tri>>>& allTriLists);
@@ -81,6 +83,15 @@ public:
     */
     static std::unique_ptr<Geometry> triangulate(const Geometry* geom);
 
+    /**
+    * Computes the Constrained Delaunay Triangulation of each polygon element
+    * in a geometry, as a compact TriangleMesh.
+    *
+    * @param geom the input geometry
+    * @return the triangles of all the polygons
+    */
+    static std::unique_ptr<TriangleMesh> triangulateToMesh(const Geometry* geom);
+
     /**
     * Computes the triangulation of a single polygon
     * and returns it as a list of {@link geos::triangulate::tri::Tri}s.
@@ -66,6 +66,8 @@ private:
 
     std::unique_ptr<Geometry> compute();
 
+    void computeTris(TriList<Tri>& triList);
+
     /**
     * Computes the triangulation of a single polygon
     *
@@ -94,6 +96,15 @@ public:
     */
     static std::unique_ptr<Geometry> triangulate(const Geometry* geom);
 
+    /**
+    * Computes a triangulation of each polygon in a geometry,
+    * as a compact TriangleMesh.
+    *
+    * @param geom a geometry containing polygons
+    * @return the triangles of all the polygons
+    */
+    static std::unique_ptr<TriangleMesh> triangulateToMesh(const Geometry* geom);
+
 };
 
 
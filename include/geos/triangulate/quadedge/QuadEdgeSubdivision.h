@@ -46,6 +46,9 @@ class Envelope;
 }
 
 namespace triangulate { //geos.triangulate
+
+class TriangleMesh;
+
 namespace quadedge { //geos.triangulate.quadedge
 
 class TriangleVisitor;
@@ -207,8 +210,8 @@ public:
      * or e is an edge of a triangle containing v.
      * The search starts from startEdge and proceeds on the general direction of v.
      *
-     * This locate algorithm relies on the subdivision being Delaunay. For
-     * non-Delaunay subdivisions, this may loop for ever.
+     * The search is a visibility walk, which also terminates in subdivisions
+     * which are not exactly Delaunay.
      *
      * @param v the location to search for
      * @param startEdge an edge of the subdivision to start searching at
@@ -389,6 +392,7 @@ private:
 private:
     class TriangleCoordinatesVisitor;
     class TriangleCircumcentreVisitor;
+    class TriangleMeshVisitor;
 
 public:
     /** \brief
@@ -413,6 +417,15 @@ public:
      */
     std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
 
+    /** \brief
+     * Adds the triangles of a triangulated subdivision to a
+     * [TriangleMesh](@ref triangulate::TriangleMesh), which is much
+     * more compact than the output of getTriangles().
+     *
+     * @param mesh the mesh to add the triangles to
+     */
+    void getTriangleMesh(TriangleMesh& mesh);
+
     /** \brief
      * Gets the cells in the Voronoi diagram for this triangulation.
      * The cells are returned as a [GeometryCollection](@ref geom::GeometryCollection)
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <geos/geom/GeometryFactory.h>
+#include <geos/triangulate/TriangleMesh.h>
 
 #include <geos/export.h>
 #include <iostream>
@@ -150,6 +151,15 @@ public:
         return geomFact->createGeometryCollection(std::move(geoms));
     }
 
+    void toMesh(TriangleMeshBuilder& mesh) const
+    {
+        for (const auto* tri: tris) {
+            mesh.addTriangle(tri->getCoordinate(0),
+                             tri->getCoordinate(1),
+                             tri->getCoordinate(2));
+        }
+    }
+
     friend std::ostream& operator << (std::ostream& os, TriList& triList)
     {
         os << "TRILIST ";
@@ -0,0 +1,248 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace geos {
+namespace util { // geos::util
+
+/** \brief
+ * A bump allocator for short-lived geometries.
+ *
+ * While an Arena is active on a thread (see Arena::Scope), every
+ * [Geometry](@ref geom::Geometry) and
+ * [CoordinateSequence](@ref geom::CoordinateSequence) created on that
+ * thread, along with its coordinate storage, is carved out of large
+ * chunks owned by the arena instead of being allocated individually
+ * on the heap. Freeing an object only updates a counter; the memory
+ * is reclaimed all at once by reset() or by destroying the arena.
+ *
+ * Objects allocated from an arena may be freed on any thread and at
+ * any time, including outside of the scope and after the arena has
+ * been destroyed: the chunks are kept until the last object is freed.
+ *
+ * Memory from an arena and memory from the heap are freed through the
+ * same Arena::deallocate function, which tells them apart without
+ * locking by looking up the page of the address in a map of the chunks
+ * of live arenas. While no arena is active on any thread,
+ * Arena::allocateCurrent is plain `::operator new`, and while no arena
+ * holds any memory, Arena::deallocate is plain `::operator delete`.
+ *
+ * An Arena may only be active on one thread at a time.
+ */
+class GEOS_DLL Arena {
+
+public:
+
+    /// Alignment of the memory allocated from an arena
+    static constexpr std::size_t ALIGNMENT = alignof(std::max_align_t);
+
+    /** \brief
+     * Activates an Arena on the current thread for the lifetime
+     * of the Scope, restoring the previously active arena when
+     * the Scope is destroyed.
+     */
+    class GEOS_DLL Scope {
+    public:
+        /// Activates `arena`, or the heap if `arena` is null
+        explicit Scope(Arena* arena);
+
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Arena* previous;
+    };
+
+    /** \brief
+     * Creates an empty arena.
+     *
+     * @param chunkSize size in bytes of the first chunk. Subsequent
+     *        chunks grow geometrically.
+     */
+    explicit Arena(std::size_t chunkSize = 64 * 1024);
+
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// The arena active on the current thread, or null
+    static Arena* current();
+
+    /** \brief
+     * Allocates memory from the arena active on the current thread,
+     * or from the heap if there is none.
+     *
+     * The memory must be freed with deallocate().
+     *
+     * @throws std::bad_alloc if memory cannot be allocated
+     */
+    static void* allocateCurrent(std::size_t size)
+    {
+        if (numScopes.load(std::memory_order_relaxed) == 0) {
+            return ::operator new(size);
+        }
+        return allocateScoped(size);
+    }
+
+    /// Allocates memory like allocateCurrent(), returning null on failure
+    static void* allocateCurrent(std::size_t size, const std::nothrow_t&) noexcept
+    {
+        try {
+            return allocateCurrent(size);
+        }
+        catch (const std::bad_alloc&) {
+            return nullptr;
+        }
+    }
+
+    /** \brief
+     * Allocates memory with the given alignment like allocateCurrent().
+     *
+     * Alignments stricter than ALIGNMENT are always allocated from the heap.
+     * The memory must be freed with the deallocate() taking the same alignment.
+     */
+    static void* allocateCurrent(std::size_t size, std::align_val_t alignment)
+    {
+        if (static_cast<std::size_t>(alignment) > ALIGNMENT) {
+            return ::operator new(size, alignment);
+        }
+        return allocateCurrent(size);
+    }
+
+    /// Allocates memory like allocateCurrent(), returning null on failure
+    static void* allocateCurrent(std::size_t size, std::align_val_t alignment,
+                                 const std::nothrow_t&) noexcept
+    {
+        try {
+            return allocateCurrent(size, alignment);
+        }
+        catch (const std::bad_alloc&) {
+            return nullptr;
+        }
+    }
+
+    /// Frees memory obtained from allocateCurrent()
+    static void deallocate(void* p) noexcept
+    {
+        if (numChunks.load(std::memory_order_acquire) == 0) {
+            ::operator delete(p);
+            return;
+        }
+        deallocateChunked(p);
+    }
+
+    /// Frees memory obtained from allocateCurrent() with an alignment
+    static void deallocate(void* p, std::align_val_t alignment) noexcept
+    {
+        if (static_cast<std::size_t>(alignment) > ALIGNMENT) {
+            ::operator delete(p, alignment);
+            return;
+        }
+        deallocate(p);
+    }
+
+    /**
+     * Releases all the memory of the arena for reuse, keeping only
+     * the largest chunk.
+     *
+     * @throws util::IllegalStateException if objects allocated from
+     *         the arena have not been freed
+     */
+    void reset();
+
+    /// Number of allocations from the arena which have not been freed
+    std::size_t getNumAllocations() const;
+
+    /// Number of bytes allocated from the arena since the last reset
+    std::size_t getBytesUsed() const;
+
+    /// Number of bytes held by the arena in its chunks
+    std::size_t getBytesReserved() const;
+
+private:
+
+    struct Chunk;
+    struct Pool;
+
+    Pool* pool;
+
+    // Number of scopes activating an arena, on any thread
+    static std::atomic<std::size_t> numScopes;
+
+    // Number of chunks held by arenas
+    static std::atomic<std::size_t> numChunks;
+
+    static void* allocateScoped(std::size_t size);
+
+    static void deallocateChunked(void* p) noexcept;
+
+    void* allocate(std::size_t size);
+
+};
+
+/** \brief
+ * A stateless allocator which obtains memory through
+ * Arena::allocateCurrent, for use in standard containers.
+ */
+template<typename T>
+class ArenaAllocator {
+
+public:
+
+    using value_type = T;
+
+    ArenaAllocator() noexcept = default;
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+        if (n > static_cast<std::size_t>(-1) / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(Arena::allocateCurrent(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        Arena::deallocate(p);
+    }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>&) const noexcept
+    {
+        return false;
+    }
+
+};
+
+} // namespace geos::util
+} // namespace geos
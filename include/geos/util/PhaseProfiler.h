@@ -0,0 +1,153 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace geos {
+namespace util { // geos::util
+
+/** \brief
+ * Counts the calls and accumulates the time spent in the main
+ * phases of expensive operations.
+ *
+ * Instrumented code declares a PhaseProfiler::Timer for the duration
+ * of each phase. The time is recorded in the profiler active on the
+ * current thread (see PhaseProfiler::Scope); when there is none, the
+ * Timer does nothing beyond a thread-local lookup.
+ *
+ * Phases may be nested, in which case the time is counted in each of
+ * them: for instance, the noding of an overlay retried with snapping
+ * is counted both in OVERLAY_SNAPPING and in OVERLAY_NODING. Work
+ * done on other threads, such as by a multi-threaded noder, is only
+ * counted in the enclosing phase.
+ *
+ * A PhaseProfiler may only be active on one thread at a time.
+ */
+class GEOS_DLL PhaseProfiler {
+
+public:
+
+    enum Phase {
+        /// Noding of the input edges of an OverlayNG operation
+        OVERLAY_NODING = 0,
+        /// Building of the OverlayNG topology graph
+        OVERLAY_GRAPH,
+        /// Labelling of the OverlayNG topology graph
+        OVERLAY_LABELLING,
+        /// Building of the result rings, lines and points of OverlayNG
+        OVERLAY_RESULT,
+        /// Overlay retries with snapping noding in OverlayNGRobust
+        OVERLAY_SNAPPING,
+        /// Overlay retries with snap-rounding in OverlayNGRobust
+        OVERLAY_SNAPROUNDING,
+        /// Building of STR-tree spatial indexes
+        INDEX_BUILD,
+        NUM_PHASES
+    };
+
+    /** \brief
+     * Activates a PhaseProfiler on the current thread for the lifetime
+     * of the Scope, restoring the previously active profiler when the
+     * Scope is destroyed.
+     */
+    class GEOS_DLL Scope {
+    public:
+        /// Activates `profiler`, or disables profiling if it is null
+        explicit Scope(PhaseProfiler* profiler);
+
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        PhaseProfiler* previous;
+    };
+
+    /** \brief
+     * Records a phase in the profiler active on the current thread
+     * when the Timer is destroyed.
+     */
+    class Timer {
+    public:
+        explicit Timer(Phase p_phase)
+            : profiler(current())
+            , phase(p_phase)
+        {
+            if (profiler) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~Timer()
+        {
+            if (profiler) {
+                profiler->record(phase, std::chrono::steady_clock::now() - start);
+            }
+        }
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+    private:
+        PhaseProfiler* profiler;
+        Phase phase;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    PhaseProfiler();
+
+    /// The profiler active on the current thread, or null
+    static PhaseProfiler* current();
+
+    /// Counts one execution of a phase lasting `elapsed`
+    void record(Phase phase, std::chrono::nanoseconds elapsed)
+    {
+        counts[phase]++;
+        times[phase] += elapsed;
+    }
+
+    /// Number of executions of a phase
+    std::uint64_t getCount(Phase phase) const
+    {
+        return counts[phase];
+    }
+
+    /// Total time spent in a phase
+    std::chrono::nanoseconds getTime(Phase phase) const
+    {
+        return times[phase];
+    }
+
+    /// Clears all the counters
+    void reset();
+
+    /// A short name identifying a phase, such as "overlay_noding"
+    static const char* getPhaseName(Phase phase);
+
+private:
+
+    std::array<std::uint64_t, NUM_PHASES> counts;
+    std::array<std::chrono::nanoseconds, NUM_PHASES> times;
+
+};
+
+} // namespace geos::util
+} // namespace geos
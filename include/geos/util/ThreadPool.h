@@ -0,0 +1,221 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace util { // geos::util
+
+/** \brief
+ * A fixed-size pool of worker threads with per-worker task queues
+ * and work stealing.
+ *
+ * Tasks submitted from a worker thread are pushed onto that worker's
+ * own queue and popped in LIFO order, which keeps recursive
+ * (fork/join) decompositions cache-friendly.
+ * Idle workers steal the oldest task from the other queues.
+ *
+ * A pool created with `numThreads` runs `numThreads - 1` background
+ * workers: the thread that waits on a TaskGroup also executes tasks,
+ * so the total concurrency equals `numThreads`. A pool of one thread
+ * has no workers at all and executes every task on the waiting thread.
+ *
+ * Tasks are usually submitted through a TaskGroup, which tracks
+ * completion and propagates exceptions to the waiting thread.
+ */
+class GEOS_DLL ThreadPool {
+
+public:
+
+    /** \brief
+     * Creates a pool with the given total concurrency.
+     *
+     * @param numThreads number of threads to use, including the
+     *        thread waiting for results. A value of 0 uses
+     *        defaultNumThreads().
+     */
+    explicit ThreadPool(std::size_t numThreads);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Total concurrency of the pool, including the waiting thread.
+    std::size_t getNumThreads() const
+    {
+        return queues.size();
+    }
+
+    /// Number of hardware threads, or 1 if it cannot be determined.
+    static std::size_t defaultNumThreads();
+
+    /** \brief
+     * Queues a task for execution.
+     *
+     * The task must not throw; use TaskGroup::run to
+     * execute tasks that may throw.
+     */
+    void submit(std::function<void()> task);
+
+    /** \brief
+     * Executes one queued task on the calling thread, if any is available.
+     *
+     * @return true if a task was executed
+     */
+    bool runPendingTask();
+
+    /** \brief
+     * Invokes `f(i)` for every `i` in `[0, count)`, distributing
+     * contiguous ranges of indices over the pool.
+     *
+     * Returns once all invocations have completed.
+     * If an invocation throws, remaining ranges are skipped and the
+     * first exception is rethrown on the calling thread.
+     */
+    template<typename F>
+    void parallelFor(std::size_t count, F&& f);
+
+private:
+
+    struct WorkQueue {
+        std::mutex mtx;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    /// Queue 0 receives tasks from threads outside the pool
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    std::atomic<std::size_t> queuedTasks;
+    bool stopping;
+
+    void workerLoop(std::size_t index);
+
+    bool popTask(std::size_t index, std::function<void()>& task);
+
+    std::size_t currentQueueIndex() const;
+
+};
+
+/** \brief
+ * A set of tasks executed on a ThreadPool which can be waited on
+ * as a unit.
+ *
+ * The first exception thrown by a task is captured and rethrown by
+ * wait(). Once a task has failed, tasks of the group which have not
+ * yet started are skipped.
+ *
+ * While waiting, the calling thread executes pending tasks of the pool,
+ * so groups may be nested (a task may create and wait on its own group)
+ * without exhausting the workers.
+ */
+class GEOS_DLL TaskGroup {
+
+public:
+
+    explicit TaskGroup(ThreadPool& p_pool)
+        : pool(p_pool)
+        , outstanding(0)
+        , cancelled(false)
+    {}
+
+    /// Waits for all tasks to finish. Exceptions are discarded.
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /// Queues a task belonging to this group.
+    void run(std::function<void()> task);
+
+    /** \brief
+     * Blocks until all tasks of the group have completed,
+     * helping to execute queued tasks in the meantime.
+     *
+     * Rethrows the first exception raised by a task of the group.
+     */
+    void wait();
+
+    /// Tests whether a task of the group has failed.
+    bool isCancelled() const
+    {
+        return cancelled.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    ThreadPool& pool;
+    std::size_t outstanding; // guarded by mtx
+    std::atomic<bool> cancelled;
+    std::exception_ptr error; // guarded by mtx
+    std::mutex mtx;
+    std::condition_variable done;
+
+    void waitNoThrow();
+
+};
+
+template<typename F>
+void
+ThreadPool::parallelFor(std::size_t count, F&& f)
+{
+    if (count == 0) {
+        return;
+    }
+
+    // A few ranges per thread evens out the load when
+    // the cost of individual items varies.
+    std::size_t numRanges = std::min(count, getNumThreads() * 4);
+    std::size_t rangeSize = (count + numRanges - 1) / numRanges;
+
+    TaskGroup group(*this);
+    for (std::size_t start = 0; start < count; start += rangeSize) {
+        std::size_t end = std::min(count, start + rangeSize);
+        group.run([&f, &group, start, end]() {
+            for (std::size_t i = start; i < end && !group.isCancelled(); i++) {
+                f(i);
+            }
+        });
+    }
+    group.wait();
+}
+
+} // namespace geos::util
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -80,21 +80,15 @@ Area::ofRingSigned(const geom::CoordinateSequence* ring)
      * Based on the Shoelace formula.
      * http://en.wikipedia.org/wiki/Shoelace_formula
      */
-    CoordinateXY p0, p1, p2;
-    p1 = ring->getAt<CoordinateXY>(0);
-    p2 = ring->getAt<CoordinateXY>(1);
-    double x0 = p1.x;
-    p2.x -= x0;
-    double sum = 0.0;
-    for(std::size_t i = 1; i < n - 1; i++) {
-        p0.y = p1.y;
-        p1.x = p2.x;
-        p1.y = p2.y;
-        p2 = ring->getAt<CoordinateXY>(i + 1);
-        p2.x -= x0;
-        sum += p1.x * (p0.y - p2.y);
-    }
-    return sum / 2.0;
+    return ring->withView([n](const auto& view) {
+        double x0 = view.x(0);
+        double sum = 0.0;
+        for(std::size_t i = 1; i < n - 1; i++) {
+            double x = view.x(i) - x0;
+            sum += x * (view.y(i - 1) - view.y(i + 1));
+        }
+        return sum / 2.0;
+    });
 }
 
 double
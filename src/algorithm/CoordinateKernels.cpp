@@ -0,0 +1,726 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/CoordinateKernels.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GEOS_X86_KERNELS
+#include <immintrin.h>
+#define GEOS_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+
+namespace geos {
+namespace algorithm { // geos.algorithm
+
+namespace {
+
+using InstructionSet = CoordinateKernels::InstructionSet;
+
+/*
+ * Number of partial sums. Term i of a sum computed in blocks
+ * starting at index b is accumulated into partial sum (i - b) % LANES.
+ */
+constexpr std::size_t LANES = 8;
+
+double
+combine(const double* s)
+{
+    return ((s[0] + s[4]) + (s[2] + s[6])) + ((s[1] + s[5]) + (s[3] + s[7]));
+}
+
+// Ordinates of point i of a sequence stored with stride S
+
+template<std::size_t S>
+double X(const double* d, std::size_t i)
+{
+    return d[i * S];
+}
+
+template<std::size_t S>
+double Y(const double* d, std::size_t i)
+{
+    return d[i * S + 1];
+}
+
+template<std::size_t S>
+double areaTerm(const double* d, double x0, std::size_t i)
+{
+    return (X<S>(d, i) - x0) * (Y<S>(d, i - 1) - Y<S>(d, i + 1));
+}
+
+template<std::size_t S>
+double lengthTerm(const double* d, std::size_t i)
+{
+    double dx = X<S>(d, i) - X<S>(d, i - 1);
+    double dy = Y<S>(d, i) - Y<S>(d, i - 1);
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+template<std::size_t S>
+bool isRayCandidate(const double* d, double px, double py, std::size_t i)
+{
+    double x1 = X<S>(d, i - 1);
+    double y1 = Y<S>(d, i - 1);
+    double x2 = X<S>(d, i);
+    double y2 = Y<S>(d, i);
+    return !((x1 < px && x2 < px) || (y1 > py && y2 > py) || (y1 < py && y2 < py));
+}
+
+/*
+ * Block kernels. Each processes whole blocks of points starting
+ * at index i and ending before end, and returns the index of the
+ * first point not processed.
+ */
+
+template<std::size_t S>
+std::size_t areaBlocksScalar(const double* d, std::size_t i, std::size_t end, double x0, double* s)
+{
+    for (; i + LANES <= end; i += LANES) {
+        for (std::size_t j = 0; j < LANES; j++) {
+            s[j] += areaTerm<S>(d, x0, i + j);
+        }
+    }
+    return i;
+}
+
+template<std::size_t S>
+std::size_t lengthBlocksScalar(const double* d, std::size_t i, std::size_t end, double* s)
+{
+    for (; i + LANES <= end; i += LANES) {
+        for (std::size_t j = 0; j < LANES; j++) {
+            s[j] += lengthTerm<S>(d, i + j);
+        }
+    }
+    return i;
+}
+
+#ifdef GEOS_X86_KERNELS
+
+// SSE2
+
+template<std::size_t S>
+GEOS_TARGET("sse2") inline
+__m128d load2(const double* p)
+{
+    return _mm_loadh_pd(_mm_load_sd(p), p + S);
+}
+
+template<std::size_t S>
+GEOS_TARGET("sse2")
+std::size_t areaBlocksSse2(const double* d, std::size_t i, std::size_t end, double x0, double* s)
+{
+    const __m128d vx0 = _mm_set1_pd(x0);
+    __m128d acc[4] = { _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd() };
+    for (; i + LANES <= end; i += LANES) {
+        for (std::size_t k = 0; k < 4; k++) {
+            const double* p = d + (i + 2 * k) * S;
+            __m128d x = _mm_sub_pd(load2<S>(p), vx0);
+            __m128d dy = _mm_sub_pd(load2<S>(p - S + 1), load2<S>(p + S + 1));
+            acc[k] = _mm_add_pd(acc[k], _mm_mul_pd(x, dy));
+        }
+    }
+    for (std::size_t k = 0; k < 4; k++) {
+        double lanes[2];
+        _mm_storeu_pd(lanes, acc[k]);
+        s[2 * k] += lanes[0];
+        s[2 * k + 1] += lanes[1];
+    }
+    return i;
+}
+
+template<std::size_t S>
+GEOS_TARGET("sse2")
+std::size_t lengthBlocksSse2(const double* d, std::size_t i, std::size_t end, double* s)
+{
+    __m128d acc[4] = { _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd() };
+    for (; i + LANES <= end; i += LANES) {
+        for (std::size_t k = 0; k < 4; k++) {
+            const double* p = d + (i + 2 * k) * S;
+            __m128d dx = _mm_sub_pd(load2<S>(p), load2<S>(p - S));
+            __m128d dy = _mm_sub_pd(load2<S>(p + 1), load2<S>(p - S + 1));
+            __m128d sq = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+            acc[k] = _mm_add_pd(acc[k], _mm_sqrt_pd(sq));
+        }
+    }
+    for (std::size_t k = 0; k < 4; k++) {
+        double lanes[2];
+        _mm_storeu_pd(lanes, acc[k]);
+        s[2 * k] += lanes[0];
+        s[2 * k + 1] += lanes[1];
+    }
+    return i;
+}
+
+template<std::size_t S>
+GEOS_TARGET("sse2")
+std::size_t minMaxBlocksSse2(const double* d, std::size_t i, std::size_t end, double* bounds)
+{
+    // The loaded values are the first operand of min/max,
+    // so that NaN values are ignored, as with std::min
+    __m128d minx = _mm_set1_pd(bounds[0]);
+    __m128d maxx = _mm_set1_pd(bounds[1]);
+    __m128d miny = _mm_set1_pd(bounds[2]);
+    __m128d maxy = _mm_set1_pd(bounds[3]);
+    for (; i + 2 <= end; i += 2) {
+        const double* p = d + i * S;
+        __m128d x = load2<S>(p);
+        __m128d y = load2<S>(p + 1);
+        minx = _mm_min_pd(x, minx);
+        maxx = _mm_max_pd(x, maxx);
+        miny = _mm_min_pd(y, miny);
+        maxy = _mm_max_pd(y, maxy);
+    }
+    double lanes[4][2];
+    _mm_storeu_pd(lanes[0], minx);
+    _mm_storeu_pd(lanes[1], maxx);
+    _mm_storeu_pd(lanes[2], miny);
+    _mm_storeu_pd(lanes[3], maxy);
+    bounds[0] = std::min(lanes[0][0], lanes[0][1]);
+    bounds[1] = std::max(lanes[1][0], lanes[1][1]);
+    bounds[2] = std::min(lanes[2][0], lanes[2][1]);
+    bounds[3] = std::max(lanes[3][0], lanes[3][1]);
+    return i;
+}
+
+template<std::size_t S>
+GEOS_TARGET("sse2")
+std::size_t rayBlocksSse2(const double* d, std::size_t i, std::size_t end, double px, double py)
+{
+    const __m128d vpx = _mm_set1_pd(px);
+    const __m128d vpy = _mm_set1_pd(py);
+    for (; i + 2 <= end; i += 2) {
+        const double* p = d + (i - 1) * S;
+        __m128d x1 = load2<S>(p);
+        __m128d y1 = load2<S>(p + 1);
+        __m128d x2 = load2<S>(p + S);
+        __m128d y2 = load2<S>(p + S + 1);
+        __m128d left = _mm_and_pd(_mm_cmplt_pd(x1, vpx), _mm_cmplt_pd(x2, vpx));
+        __m128d above = _mm_and_pd(_mm_cmpgt_pd(y1, vpy), _mm_cmpgt_pd(y2, vpy));
+        __m128d below = _mm_and_pd(_mm_cmplt_pd(y1, vpy), _mm_cmplt_pd(y2, vpy));
+        int skip = _mm_movemask_pd(_mm_or_pd(left, _mm_or_pd(above, below)));
+        if (skip != 0x3) {
+            return i + static_cast<std::size_t>(__builtin_ctz(~static_cast<unsigned int>(skip)));
+        }
+    }
+    return i;
+}
+
+// AVX2
+
+template<std::size_t S>
+GEOS_TARGET("avx2") inline
+void load4(const double* p, __m256d& x, __m256d& y)
+{
+    if (S == 2) {
+        __m256d a = _mm256_loadu_pd(p);      // x0 y0 x1 y1
+        __m256d b = _mm256_loadu_pd(p + 4);  // x2 y2 x3 y3
+        __m256d lo = _mm256_permute2f128_pd(a, b, 0x20);  // x0 y0 x2 y2
+        __m256d hi = _mm256_permute2f128_pd(a, b, 0x31);  // x1 y1 x3 y3
+        x = _mm256_unpacklo_pd(lo, hi);
+        y = _mm256_unpackhi_pd(lo, hi);
+    }
+    else if (S == 3) {
+        __m256d a = _mm256_loadu_pd(p);      // x0 y0 z0 x1
+        __m256d b = _mm256_loadu_pd(p + 4);  // y1 z1 x2 y2
+        __m256d c = _mm256_loadu_pd(p + 8);  // z2 x3 y3 z3
+        __m256d xs = _mm256_blend_pd(_mm256_blend_pd(a, b, 0x4), c, 0x2);  // x0 x3 x2 x1
+        __m256d ys = _mm256_blend_pd(_mm256_blend_pd(a, b, 0x9), c, 0x4);  // y1 y0 y3 y2
+        x = _mm256_permute4x64_pd(xs, _MM_SHUFFLE(1, 2, 3, 0));
+        y = _mm256_permute4x64_pd(ys, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    else {
+        __m256d a = _mm256_loadu_pd(p);
+        __m256d b = _mm256_loadu_pd(p + S);
+        __m256d c = _mm256_loadu_pd(p + 2 * S);
+        __m256d d = _mm256_loadu_pd(p + 3 * S);
+        __m256d lo = _mm256_unpacklo_pd(a, b);  // x0 x1 z0 z1
+        __m256d hi = _mm256_unpackhi_pd(a, b);  // y0 y1 m0 m1
+        __m256d lo2 = _mm256_unpacklo_pd(c, d);
+        __m256d hi2 = _mm256_unpackhi_pd(c, d);
+        x = _mm256_permute2f128_pd(lo, lo2, 0x20);
+        y = _mm256_permute2f128_pd(hi, hi2, 0x20);
+    }
+}
+
+template<std::size_t S>
+GEOS_TARGET("avx2")
+std::size_t areaBlocksAvx2(const double* d, std::size_t i, std::size_t end, double x0, double* s)
+{
+    const __m256d vx0 = _mm256_set1_pd(x0);
+    __m256d acc[2] = { _mm256_setzero_pd(), _mm256_setzero_pd() };
+    for (; i + LANES <= end; i += LANES) {
+        for (std::size_t k = 0; k < 2; k++) {
+            const double* p = d + (i + 4 * k) * S;
+            __m256d x, y, xPrev, yPrev, xNext, yNext;
+            load4<S>(p, x, y);
+            load4<S>(p - S, xPrev, yPrev);
+            load4<S>(p + S, xNext, yNext);
+            __m256d term = _mm256_mul_pd(_mm256_sub_pd(x, vx0), _mm256_sub_pd(yPrev, yNext));
+            acc[k] = _mm256_add_pd(acc[k], term);
+        }
+    }
+    for (std::size_t k = 0; k < 2; k++) {
+        double lanes[4];
+        _mm256_storeu_pd(lanes, acc[k]);
+        for (std::size_t j = 0; j < 4; j++) {
+            s[4 * k + j] += lanes[j];
+        }
+    }
+    return i;
+}
+
+template<std::size_t S>
+GEOS_TARGET("avx2")
+std::size_t lengthBlocksAvx2(const double* d, std::size_t i, std::size_t end, double* s)
+{
+    __m256d acc[2] = { _mm256_setzero_pd(), _mm256_setzero_pd() };
+    for (; i + LANES <= end; i += LANES) {
+        for (std::size_t k = 0; k < 2; k++) {
+            const double* p = d + (i + 4 * k) * S;
+            __m256d x, y, xPrev, yPrev;
+            load4<S>(p, x, y);
+            load4<S>(p - S, xPrev, yPrev);
+            __m256d dx = _mm256_sub_pd(x, xPrev);
+            __m256d dy = _mm256_sub_pd(y, yPrev);
+            __m256d sq = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+            acc[k] = _mm256_add_pd(acc[k], _mm256_sqrt_pd(sq));
+        }
+    }
+    for (std::size_t k = 0; k < 2; k++) {
+        double lanes[4];
+        _mm256_storeu_pd(lanes, acc[k]);
+        for (std::size_t j = 0; j < 4; j++) {
+            s[4 * k + j] += lanes[j];
+        }
+    }
+    return i;
+}
+
+template<std::size_t S>
+GEOS_TARGET("avx2")
+std::size_t minMaxBlocksAvx2(const double* d, std::size_t i, std::size_t end, double* bounds)
+{
+    __m256d minx = _mm256_set1_pd(bounds[0]);
+    __m256d maxx = _mm256_set1_pd(bounds[1]);
+    __m256d miny = _mm256_set1_pd(bounds[2]);
+    __m256d maxy = _mm256_set1_pd(bounds[3]);
+    for (; i + 4 <= end; i += 4) {
+        __m256d x, y;
+        load4<S>(d + i * S, x, y);
+        minx = _mm256_min_pd(x, minx);
+        maxx = _mm256_max_pd(x, maxx);
+        miny = _mm256_min_pd(y, miny);
+        maxy = _mm256_max_pd(y, maxy);
+    }
+    double lanes[4][4];
+    _mm256_storeu_pd(lanes[0], minx);
+    _mm256_storeu_pd(lanes[1], maxx);
+    _mm256_storeu_pd(lanes[2], miny);
+    _mm256_storeu_pd(lanes[3], maxy);
+    for (std::size_t j = 0; j < 4; j++) {
+        bounds[0] = std::min(bounds[0], lanes[0][j]);
+        bounds[1] = std::max(bounds[1], lanes[1][j]);
+        bounds[2] = std::min(bounds[2], lanes[2][j]);
+        bounds[3] = std::max(bounds[3], lanes[3][j]);
+    }
+    return i;
+}
+
+template<std::size_t S>
+GEOS_TARGET("avx2")
+std::size_t rayBlocksAvx2(const double* d, std::size_t i, std::size_t end, double px, double py)
+{
+    const __m256d vpx = _mm256_set1_pd(px);
+    const __m256d vpy = _mm256_set1_pd(py);
+    for (; i + 4 <= end; i += 4) {
+        const double* p = d + (i - 1) * S;
+        __m256d x1, y1, x2, y2;
+        load4<S>(p, x1, y1);
+        load4<S>(p + S, x2, y2);
+        __m256d left = _mm256_and_pd(_mm256_cmp_pd(x1, vpx, _CMP_LT_OQ), _mm256_cmp_pd(x2, vpx, _CMP_LT_OQ));
+        __m256d above = _mm256_and_pd(_mm256_cmp_pd(y1, vpy, _CMP_GT_OQ), _mm256_cmp_pd(y2, vpy, _CMP_GT_OQ));
+        __m256d below = _mm256_and_pd(_mm256_cmp_pd(y1, vpy, _CMP_LT_OQ), _mm256_cmp_pd(y2, vpy, _CMP_LT_OQ));
+        int skip = _mm256_movemask_pd(_mm256_or_pd(left, _mm256_or_pd(above, below)));
+        if (skip != 0xF) {
+            return i + static_cast<std::size_t>(__builtin_ctz(~static_cast<unsigned int>(skip)));
+        }
+    }
+    return i;
+}
+
+// AVX-512
+//
+// The masked forms of the intrinsics are used with a full mask where the
+// unmasked forms trigger spurious -Wmaybe-uninitialized warnings in GCC.
+
+template<std::size_t S>
+GEOS_TARGET("avx512f") inline
+void load8(const double* p, __m512d& x, __m512d& y)
+{
+    if (S == 2) {
+        __m512d a = _mm512_loadu_pd(p);
+        __m512d b = _mm512_loadu_pd(p + 8);
+        x = _mm512_permutex2var_pd(a, _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0), b);
+        y = _mm512_permutex2var_pd(a, _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1), b);
+    }
+    else if (S == 3) {
+        // Collect the first six values from a and b, then the last two from c
+        __m512d a = _mm512_loadu_pd(p);
+        __m512d b = _mm512_loadu_pd(p + 8);
+        __m512d c = _mm512_loadu_pd(p + 16);
+        __m512d xab = _mm512_permutex2var_pd(a, _mm512_set_epi64(0, 0, 15, 12, 9, 6, 3, 0), b);
+        __m512d yab = _mm512_permutex2var_pd(a, _mm512_set_epi64(0, 0, 0, 13, 10, 7, 4, 1), b);
+        x = _mm512_permutex2var_pd(xab, _mm512_set_epi64(13, 10, 5, 4, 3, 2, 1, 0), c);
+        y = _mm512_permutex2var_pd(yab, _mm512_set_epi64(14, 11, 8, 4, 3, 2, 1, 0), c);
+    }
+    else {
+        constexpr long long s = S;
+        __m512d a = _mm512_loadu_pd(p);
+        __m512d b = _mm512_loadu_pd(p + 8);
+        __m512d c = _mm512_loadu_pd(p + 16);
+        __m512d d = _mm512_loadu_pd(p + 24);
+        const __m512i ix = _mm512_set_epi64(0, 0, 0, 0, 3 * s, 2 * s, s, 0);
+        const __m512i iy = _mm512_set_epi64(0, 0, 0, 0, 3 * s + 1, 2 * s + 1, s + 1, 1);
+        const __m512i lohi = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+        x = _mm512_permutex2var_pd(_mm512_permutex2var_pd(a, ix, b), lohi, _mm512_permutex2var_pd(c, ix, d));
+        y = _mm512_permutex2var_pd(_mm512_permutex2var_pd(a, iy, b), lohi, _mm512_permutex2var_pd(c, iy, d));
+    }
+}
+
+template<std::size_t S>
+GEOS_TARGET("avx512f")
+std::size_t areaBlocksAvx512(const double* d, std::size_t i, std::size_t end, double x0, double* s)
+{
+    const __m512d vx0 = _mm512_set1_pd(x0);
+    __m512d acc = _mm512_setzero_pd();
+    for (; i + LANES <= end; i += LANES) {
+        const double* p = d + i * S;
+        __m512d x, y, xPrev, yPrev, xNext, yNext;
+        load8<S>(p, x, y);
+        load8<S>(p - S, xPrev, yPrev);
+        load8<S>(p + S, xNext, yNext);
+        __m512d term = _mm512_mul_pd(_mm512_sub_pd(x, vx0), _mm512_sub_pd(yPrev, yNext));
+        acc = _mm512_add_pd(acc, term);
+    }
+    double lanes[LANES];
+    _mm512_storeu_pd(lanes, acc);
+    for (std::size_t j = 0; j < LANES; j++) {
+        s[j] += lanes[j];
+    }
+    return i;
+}
+
+template<std::size_t S>
+GEOS_TARGET("avx512f")
+std::size_t lengthBlocksAvx512(const double* d, std::size_t i, std::size_t end, double* s)
+{
+    __m512d acc = _mm512_setzero_pd();
+    for (; i + LANES <= end; i += LANES) {
+        const double* p = d + i * S;
+        __m512d x, y, xPrev, yPrev;
+        load8<S>(p, x, y);
+        load8<S>(p - S, xPrev, yPrev);
+        __m512d dx = _mm512_sub_pd(x, xPrev);
+        __m512d dy = _mm512_sub_pd(y, yPrev);
+        __m512d sq = _mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy));
+        acc = _mm512_add_pd(acc, _mm512_mask_sqrt_pd(sq, 0xFF, sq));
+    }
+    double lanes[LANES];
+    _mm512_storeu_pd(lanes, acc);
+    for (std::size_t j = 0; j < LANES; j++) {
+        s[j] += lanes[j];
+    }
+    return i;
+}
+
+template<std::size_t S>
+GEOS_TARGET("avx512f")
+std::size_t minMaxBlocksAvx512(const double* d, std::size_t i, std::size_t end, double* bounds)
+{
+    __m512d minx = _mm512_set1_pd(bounds[0]);
+    __m512d maxx = _mm512_set1_pd(bounds[1]);
+    __m512d miny = _mm512_set1_pd(bounds[2]);
+    __m512d maxy = _mm512_set1_pd(bounds[3]);
+    for (; i + 8 <= end; i += 8) {
+        __m512d x, y;
+        load8<S>(d + i * S, x, y);
+        minx = _mm512_mask_min_pd(minx, 0xFF, x, minx);
+        maxx = _mm512_mask_max_pd(maxx, 0xFF, x, maxx);
+        miny = _mm512_mask_min_pd(miny, 0xFF, y, miny);
+        maxy = _mm512_mask_max_pd(maxy, 0xFF, y, maxy);
+    }
+    double lanes[4][8];
+    _mm512_storeu_pd(lanes[0], minx);
+    _mm512_storeu_pd(lanes[1], maxx);
+    _mm512_storeu_pd(lanes[2], miny);
+    _mm512_storeu_pd(lanes[3], maxy);
+    for (std::size_t j = 0; j < 8; j++) {
+        bounds[0] = std::min(bounds[0], lanes[0][j]);
+        bounds[1] = std::max(bounds[1], lanes[1][j]);
+        bounds[2] = std::min(bounds[2], lanes[2][j]);
+        bounds[3] = std::max(bounds[3], lanes[3][j]);
+    }
+    return i;
+}
+
+template<std::size_t S>
+GEOS_TARGET("avx512f")
+std::size_t rayBlocksAvx512(const double* d, std::size_t i, std::size_t end, double px, double py)
+{
+    const __m512d vpx = _mm512_set1_pd(px);
+    const __m512d vpy = _mm512_set1_pd(py);
+    for (; i + 8 <= end; i += 8) {
+        const double* p = d + (i - 1) * S;
+        __m512d x1, y1, x2, y2;
+        load8<S>(p, x1, y1);
+        load8<S>(p + S, x2, y2);
+        __mmask8 left = _mm512_cmp_pd_mask(x1, vpx, _CMP_LT_OQ) & _mm512_cmp_pd_mask(x2, vpx, _CMP_LT_OQ);
+        __mmask8 above = _mm512_cmp_pd_mask(y1, vpy, _CMP_GT_OQ) & _mm512_cmp_pd_mask(y2, vpy, _CMP_GT_OQ);
+        __mmask8 below = _mm512_cmp_pd_mask(y1, vpy, _CMP_LT_OQ) & _mm512_cmp_pd_mask(y2, vpy, _CMP_LT_OQ);
+        unsigned int skip = static_cast<unsigned int>(left | above | below);
+        if (skip != 0xFF) {
+            return i + static_cast<std::size_t>(__builtin_ctz(~static_cast<unsigned int>(skip)));
+        }
+    }
+    return i;
+}
+
+#endif // GEOS_X86_KERNELS
+
+// Dispatch to the block kernel of an instruction set
+
+template<std::size_t S>
+std::size_t areaBlocks(InstructionSet isa, const double* d, std::size_t i, std::size_t end, double x0, double* s)
+{
+    switch (isa) {
+#ifdef GEOS_X86_KERNELS
+        case InstructionSet::AVX512: return areaBlocksAvx512<S>(d, i, end, x0, s);
+        case InstructionSet::AVX2:   return areaBlocksAvx2<S>(d, i, end, x0, s);
+        case InstructionSet::SSE2:   return areaBlocksSse2<S>(d, i, end, x0, s);
+#endif
+        default:                     return areaBlocksScalar<S>(d, i, end, x0, s);
+    }
+}
+
+template<std::size_t S>
+std::size_t lengthBlocks(InstructionSet isa, const double* d, std::size_t i, std::size_t end, double* s)
+{
+    switch (isa) {
+#ifdef GEOS_X86_KERNELS
+        case InstructionSet::AVX512: return lengthBlocksAvx512<S>(d, i, end, s);
+        case InstructionSet::AVX2:   return lengthBlocksAvx2<S>(d, i, end, s);
+        case InstructionSet::SSE2:   return lengthBlocksSse2<S>(d, i, end, s);
+#endif
+        default:                     return lengthBlocksScalar<S>(d, i, end, s);
+    }
+}
+
+template<std::size_t S>
+std::size_t minMaxBlocks(InstructionSet isa, const double* d, std::size_t i, std::size_t end, double* bounds)
+{
+    switch (isa) {
+#ifdef GEOS_X86_KERNELS
+        case InstructionSet::AVX512: return minMaxBlocksAvx512<S>(d, i, end, bounds);
+        case InstructionSet::AVX2:   return minMaxBlocksAvx2<S>(d, i, end, bounds);
+        case InstructionSet::SSE2:   return minMaxBlocksSse2<S>(d, i, end, bounds);
+#endif
+        default:                     (void) d; (void) end; (void) bounds; return i;
+    }
+}
+
+template<std::size_t S>
+std::size_t rayBlocks(InstructionSet isa, const double* d, std::size_t i, std::size_t end, double px, double py)
+{
+    switch (isa) {
+#ifdef GEOS_X86_KERNELS
+        case InstructionSet::AVX512: return rayBlocksAvx512<S>(d, i, end, px, py);
+        case InstructionSet::AVX2:   return rayBlocksAvx2<S>(d, i, end, px, py);
+        case InstructionSet::SSE2:   return rayBlocksSse2<S>(d, i, end, px, py);
+#endif
+        default:                     (void) d; (void) end; (void) px; (void) py; return i;
+    }
+}
+
+InstructionSet
+detectInstructionSet()
+{
+#ifdef GEOS_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return InstructionSet::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return InstructionSet::AVX2;
+    }
+    return InstructionSet::SSE2;
+#else
+    return InstructionSet::SCALAR;
+#endif
+}
+
+std::atomic<InstructionSet>&
+activeInstructionSet()
+{
+    static std::atomic<InstructionSet> isa(detectInstructionSet());
+    return isa;
+}
+
+} // anonymous namespace
+
+/* public static */
+bool
+CoordinateKernels::isSupported(InstructionSet isa)
+{
+    static const InstructionSet best = detectInstructionSet();
+    return static_cast<int>(isa) <= static_cast<int>(best);
+}
+
+/* public static */
+CoordinateKernels::InstructionSet
+CoordinateKernels::getInstructionSet()
+{
+    return activeInstructionSet().load(std::memory_order_relaxed);
+}
+
+/* public static */
+void
+CoordinateKernels::setInstructionSet(InstructionSet isa)
+{
+    if (!isSupported(isa)) {
+        throw util::IllegalArgumentException("CoordinateKernels: instruction set is not supported");
+    }
+    activeInstructionSet().store(isa, std::memory_order_relaxed);
+}
+
+/* public static */
+void
+CoordinateKernels::minMax(const CoordinateSequence& seq, std::size_t start,
+                          double& minx, double& maxx, double& miny, double& maxy)
+{
+    double bounds[4] = {
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity()
+    };
+
+    std::size_t n = seq.size();
+    if (start < n) {
+        InstructionSet isa = getInstructionSet();
+        seq.withView([&bounds, start, n, isa](const auto& view) {
+            constexpr std::size_t S = std::decay_t<decltype(view)>::stride;
+            const double* d = view.data();
+            std::size_t i = minMaxBlocks<S>(isa, d, start, n, bounds);
+            for (; i < n; i++) {
+                bounds[0] = std::min(bounds[0], X<S>(d, i));
+                bounds[1] = std::max(bounds[1], X<S>(d, i));
+                bounds[2] = std::min(bounds[2], Y<S>(d, i));
+                bounds[3] = std::max(bounds[3], Y<S>(d, i));
+            }
+        });
+    }
+
+    minx = bounds[0];
+    maxx = bounds[1];
+    miny = bounds[2];
+    maxy = bounds[3];
+}
+
+/* public static */
+double
+CoordinateKernels::signedAreaOfRing(const CoordinateSequence& ring)
+{
+    std::size_t n = ring.size();
+    if (n < 3) {
+        return 0.0;
+    }
+
+    InstructionSet isa = getInstructionSet();
+    return ring.withView([n, isa](const auto& view) {
+        constexpr std::size_t S = std::decay_t<decltype(view)>::stride;
+        const double* d = view.data();
+        double x0 = X<S>(d, 0);
+        double s[LANES] = {};
+        std::size_t i = areaBlocks<S>(isa, d, 1, n - 1, x0, s);
+        double sum = combine(s);
+        for (; i < n - 1; i++) {
+            sum += areaTerm<S>(d, x0, i);
+        }
+        return sum / 2.0;
+    });
+}
+
+/* public static */
+double
+CoordinateKernels::lengthOfLine(const CoordinateSequence& pts)
+{
+    std::size_t n = pts.size();
+    if (n <= 1) {
+        return 0.0;
+    }
+
+    InstructionSet isa = getInstructionSet();
+    return pts.withView([n, isa](const auto& view) {
+        constexpr std::size_t S = std::decay_t<decltype(view)>::stride;
+        const double* d = view.data();
+        double s[LANES] = {};
+        std::size_t i = lengthBlocks<S>(isa, d, 1, n, s);
+        double len = combine(s);
+        for (; i < n; i++) {
+            len += lengthTerm<S>(d, i);
+        }
+        return len;
+    });
+}
+
+/* public static */
+std::size_t
+CoordinateKernels::nextRayCrossingCandidate(const CoordinateSequence& ring,
+                                            const CoordinateXY& p,
+                                            std::size_t start)
+{
+    std::size_t n = ring.size();
+    if (start >= n) {
+        return n;
+    }
+    start = std::max<std::size_t>(start, 1);
+
+    InstructionSet isa = getInstructionSet();
+    return ring.withView([n, isa, start, &p](const auto& view) {
+        constexpr std::size_t S = std::decay_t<decltype(view)>::stride;
+        const double* d = view.data();
+        std::size_t i = rayBlocks<S>(isa, d, start, n, p.x, p.y);
+        for (; i < n; i++) {
+            if (isRayCandidate<S>(d, p.x, p.y, i)) {
+                return i;
+            }
+        }
+        return n;
+    });
+}
+
+} // namespace geos.algorithm
+} // namespace geos
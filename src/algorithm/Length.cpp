@@ -34,28 +34,17 @@ Length::ofLine(const geom::CoordinateSequence* pts)
         return 0.0;
     }
 
-    double len = 0.0;
-
-    const geom::CoordinateXY& p = pts->getAt<geom::CoordinateXY>(0);
-    double x0 = p.x;
-    double y0 = p.y;
-
-    for(std::size_t i = 1; i < n; i++) {
-        const geom::CoordinateXY& pi = pts->getAt<geom::CoordinateXY>(i);
-        double x1 = pi.x;
-        double y1 = pi.y;
-        double dx = x1 - x0;
-        double dy = y1 - y0;
-
-        len += std::sqrt(dx * dx + dy * dy);
-
-        x0 = x1;
-        y0 = y1;
-    }
-    return len;
+    return pts->withView([n](const auto& view) {
+        double len = 0.0;
+        for(std::size_t i = 1; i < n; i++) {
+            double dx = view.x(i) - view.x(i - 1);
+            double dy = view.y(i) - view.y(i - 1);
+            len += std::sqrt(dx * dx + dy * dy);
+        }
+        return len;
+    });
 }
 
-
 } // namespace geos.algorithm
 } //namespace geos
 
@@ -17,6 +17,7 @@
  **********************************************************************/
 
 #include <geos/algorithm/CGAlgorithmsDD.h>
+#include <geos/algorithm/CoordinateKernels.h>
 #include <geos/algorithm/RayCrossingCounter.h>
 #include <geos/geom/CircularArc.h>
 #include <geos/geom/Coordinate.h>
@@ -47,8 +48,13 @@ RayCrossingCounter::locatePointInRing(const geom::CoordinateXY& point,
 {
     RayCrossingCounter rcc(point);
 
-    for(std::size_t i = 1, ni = ring.size(); i < ni; i++) {
-        const geom::CoordinateXY& p1 = ring.getAt<geom::CoordinateXY>(i-1);;
+    // Segments which cannot cross the ray or contain the point
+    // are skipped in bulk
+    const std::size_t ni = ring.size();
+    for(std::size_t i = CoordinateKernels::nextRayCrossingCandidate(ring, point, 1);
+            i < ni;
+            i = CoordinateKernels::nextRayCrossingCandidate(ring, point, i + 1)) {
+        const geom::CoordinateXY& p1 = ring.getAt<geom::CoordinateXY>(i-1);
         const geom::CoordinateXY& p2 = ring.getAt<geom::CoordinateXY>(i);
 
         rcc.countSegment(p1, p2);
@@ -30,6 +30,7 @@
 #include <geos/index/ItemVisitor.h>
 
 #include <algorithm>
+#include <mutex>
 
 using geos::geom::CoordinateXY;
 
@@ -68,6 +69,7 @@ IndexedPointInAreaLocator::IntervalIndexedGeometry::init(const geom::Geometry& g
 
         addLine(line->getCoordinatesRO());
     }
+    index.build();
 }
 
 void
@@ -104,9 +106,9 @@ IndexedPointInAreaLocator::IndexedPointInAreaLocator(const geom::Geometry& g)
 geom::Location
 IndexedPointInAreaLocator::locate(const geom::CoordinateXY* /*const*/ p)
 {
-    if (index == nullptr) {
+    std::call_once(indexBuilt, [this]() {
         buildIndex(areaGeom);
-    }
+    });
 
     algorithm::RayCrossingCounter rcc(*p);
 
@@ -84,6 +84,7 @@ CoverageSimplifier::simplifyInner(
 CoverageSimplifier::CoverageSimplifier(const std::vector<const Geometry*>& coverage)
     : m_input(coverage)
     , m_geomFactory(coverage.empty() ? nullptr : coverage[0]->getFactory())
+    , m_numThreads(1)
     {
         for (const Geometry* g: m_input) {
             if (!g->isPolygonal())
@@ -122,7 +123,7 @@ CoverageSimplifier::simplifyEdges(
 {
     std::unique_ptr<MultiLineString> lines = CoverageEdge::createLines(edges, m_geomFactory);
     std::vector<bool> freeRings = getFreeRings(edges);
-    std::unique_ptr<MultiLineString> linesSimp = TPVWSimplifier::simplify(lines.get(), freeRings, constraints, tolerance);
+    std::unique_ptr<MultiLineString> linesSimp = TPVWSimplifier::simplify(lines.get(), freeRings, constraints, tolerance, m_numThreads);
     //Assert: mlsSimp.getNumGeometries = edges.length
 
     setCoordinates(edges, linesSimp.get());
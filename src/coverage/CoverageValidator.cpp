@@ -18,6 +18,7 @@
 #include <geos/geom/Envelope.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/util/ThreadPool.h>
 
 
 using geos::geom::Envelope;
@@ -80,6 +81,17 @@ CoverageValidator::validate()
         invalidLines.emplace_back(nullptr);
     }
 
+    //-- build the index up front, so that it is only read by the threads
+    index.build();
+
+    if (m_numThreads != 1 && m_coverage.size() > 1) {
+        util::ThreadPool pool(m_numThreads);
+        pool.parallelFor(m_coverage.size(), [this, &index, &invalidLines](std::size_t i) {
+            invalidLines[i] = validate(m_coverage[i], index);
+        });
+        return invalidLines;
+    }
+
     for (std::size_t i = 0; i < m_coverage.size(); i++) {
         const Geometry* geom = m_coverage[i];
         std::unique_ptr<Geometry> result = validate(geom, index);
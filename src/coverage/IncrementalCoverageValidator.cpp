@@ -0,0 +1,227 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/coverage/IncrementalCoverageValidator.h>
+#include <geos/coverage/CoveragePolygonValidator.h>
+
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util.h>
+
+#include <cstdint>
+
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+
+
+namespace geos {     // geos
+namespace coverage { // geos.coverage
+
+namespace {
+
+// The index items are the ids of the polygons
+void*
+toItem(std::size_t id)
+{
+    return reinterpret_cast<void*>(static_cast<std::uintptr_t>(id));
+}
+
+std::size_t
+toId(void* item)
+{
+    return static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(item));
+}
+
+}
+
+/* public */
+std::size_t
+IncrementalCoverageValidator::add(const Geometry* geom)
+{
+    util::ensureNoCurvedComponents(geom);
+
+    std::size_t id = m_entries.size();
+    m_entries.push_back(Entry{ geom, *geom->getEnvelopeInternal(), false, false });
+    insert(id);
+    markNeighboursDirty(m_entries[id].env);
+    markDirty(id);
+    return id;
+}
+
+/* public */
+void
+IncrementalCoverageValidator::replace(std::size_t id, const Geometry* geom)
+{
+    util::ensureNoCurvedComponents(geom);
+
+    Entry& entry = getEntry(id);
+    //-- the former neighbours may have been invalid because of the polygon
+    markNeighboursDirty(entry.env);
+    removeFromIndex(id);
+
+    entry.geom = geom;
+    entry.env = *geom->getEnvelopeInternal();
+    insert(id);
+    markNeighboursDirty(entry.env);
+    markDirty(id);
+}
+
+/* public */
+void
+IncrementalCoverageValidator::remove(std::size_t id)
+{
+    Entry& entry = getEntry(id);
+    removeFromIndex(id);
+    markNeighboursDirty(entry.env);
+
+    if (entry.isInvalid) {
+        m_numInvalid--;
+    }
+    entry.geom = nullptr;
+    entry.isInvalid = false;
+}
+
+/* public */
+std::size_t
+IncrementalCoverageValidator::size() const
+{
+    std::size_t count = 0;
+    for (const Entry& entry : m_entries) {
+        if (entry.geom != nullptr)
+            count++;
+    }
+    return count;
+}
+
+/* public */
+std::map<std::size_t, std::unique_ptr<Geometry>>
+IncrementalCoverageValidator::validate()
+{
+    std::map<std::size_t, std::unique_ptr<Geometry>> results;
+    for (std::size_t id : m_dirty) {
+        Entry& entry = m_entries[id];
+        entry.isDirty = false;
+        //-- removed since it was marked
+        if (entry.geom == nullptr)
+            continue;
+
+        std::unique_ptr<Geometry> result = validate(id);
+        bool isInvalid = result != nullptr;
+        if (isInvalid != entry.isInvalid) {
+            if (isInvalid)
+                m_numInvalid++;
+            else
+                m_numInvalid--;
+            entry.isInvalid = isInvalid;
+        }
+        results[id] = std::move(result);
+    }
+    m_dirty.clear();
+    return results;
+}
+
+/* private */
+IncrementalCoverageValidator::Entry&
+IncrementalCoverageValidator::getEntry(std::size_t id)
+{
+    if (id >= m_entries.size() || m_entries[id].geom == nullptr) {
+        throw util::IllegalArgumentException("IncrementalCoverageValidator: no polygon with id " + std::to_string(id));
+    }
+    return m_entries[id];
+}
+
+/* private */
+void
+IncrementalCoverageValidator::insert(std::size_t id)
+{
+    //-- empty polygons have no neighbours
+    if (m_entries[id].env.isNull())
+        return;
+    m_index.insert(&m_entries[id].env, toItem(id));
+}
+
+/* private */
+void
+IncrementalCoverageValidator::removeFromIndex(std::size_t id)
+{
+    if (m_entries[id].env.isNull())
+        return;
+    m_index.remove(&m_entries[id].env, toItem(id));
+}
+
+/* private */
+void
+IncrementalCoverageValidator::markDirty(std::size_t id)
+{
+    Entry& entry = m_entries[id];
+    if (entry.isDirty)
+        return;
+    entry.isDirty = true;
+    m_dirty.push_back(id);
+}
+
+/* private */
+void
+IncrementalCoverageValidator::markNeighboursDirty(const Envelope& env)
+{
+    for (std::size_t id : queryNeighbours(env)) {
+        markDirty(id);
+    }
+}
+
+/* private */
+std::vector<std::size_t>
+IncrementalCoverageValidator::queryNeighbours(const Envelope& env)
+{
+    std::vector<std::size_t> ids;
+    if (env.isNull())
+        return ids;
+
+    Envelope queryEnv(env);
+    queryEnv.expandBy(m_gapWidth);
+
+    std::vector<void*> items;
+    m_index.query(&queryEnv, items);
+    //-- the quadtree returns all items of the overlapping nodes
+    for (void* item : items) {
+        std::size_t id = toId(item);
+        if (m_entries[id].env.intersects(queryEnv))
+            ids.push_back(id);
+    }
+    return ids;
+}
+
+/* private */
+std::unique_ptr<Geometry>
+IncrementalCoverageValidator::validate(std::size_t id)
+{
+    const Geometry* targetGeom = m_entries[id].geom;
+
+    std::vector<const Geometry*> nearGeoms;
+    for (std::size_t nearId : queryNeighbours(m_entries[id].env)) {
+        if (nearId != id)
+            nearGeoms.push_back(m_entries[nearId].geom);
+    }
+
+    std::unique_ptr<Geometry> result = CoveragePolygonValidator::validate(targetGeom, nearGeoms, m_gapWidth);
+    if (result->isEmpty())
+        return nullptr;
+    else
+        return result;
+}
+
+
+} // namespace geos.coverage
+} // namespace geos
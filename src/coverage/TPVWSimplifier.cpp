@@ -24,6 +24,10 @@
 #include <geos/geom/MultiLineString.h>
 
 #include <geos/simplify/LinkedLine.h>
+#include <geos/util/ThreadPool.h>
+
+#include <algorithm>
+#include <cmath>
 
 using geos::geom::Coordinate;
 using geos::geom::CoordinateSequence;
@@ -62,10 +66,24 @@ TPVWSimplifier::simplify(
     std::vector<bool>& p_freeRings,
     const MultiLineString* p_constraintLines,
     double distanceTolerance)
+{
+    return simplify(p_lines, p_freeRings, p_constraintLines, distanceTolerance, 1);
+}
+
+
+/* public static */
+std::unique_ptr<MultiLineString>
+TPVWSimplifier::simplify(
+    const MultiLineString* p_lines,
+    std::vector<bool>& p_freeRings,
+    const MultiLineString* p_constraintLines,
+    double distanceTolerance,
+    std::size_t p_numThreads)
 {
     TPVWSimplifier simp(p_lines, distanceTolerance);
     simp.setFreeRingIndices(p_freeRings);
     simp.setConstraints(p_constraintLines);
+    simp.setNumThreads(p_numThreads);
     std::unique_ptr<MultiLineString> result = simp.simplify();
     return result;
 }
@@ -79,6 +97,7 @@ TPVWSimplifier::TPVWSimplifier(
     , areaTolerance(distanceTolerance*distanceTolerance)
     , geomFactory(inputLines->getFactory())
     , constraintLines(nullptr)
+    , numThreads(1)
     {}
 
 
@@ -110,6 +129,13 @@ TPVWSimplifier::simplify()
     edgeIndex.add(constraintEdges);
 
     std::vector<std::unique_ptr<LineString>> result;
+    if (numThreads != 1 && edges.size() >= 4 * EDGES_PER_PARTITION) {
+        for (auto& ptsSimp : simplifyPartitioned(edges, edgeIndex)) {
+            result.push_back(geomFactory->createLineString(std::move(ptsSimp)));
+        }
+        return geomFactory->createMultiLineString(std::move(result));
+    }
+
     for (auto& edge : edges) {
         std::unique_ptr<CoordinateSequence> ptsSimp = edge.simplify(edgeIndex);
         auto ls = geomFactory->createLineString(std::move(ptsSimp));
@@ -118,6 +144,75 @@ TPVWSimplifier::simplify()
     return geomFactory->createMultiLineString(std::move(result));
 }
 
+/* private */
+std::vector<std::unique_ptr<CoordinateSequence>>
+TPVWSimplifier::simplifyPartitioned(std::vector<Edge>& edges, EdgeIndex& edgeIndex)
+{
+    //-- the grid depends only on the input, so that the result
+    //-- does not depend on the number of threads
+    Envelope extent;
+    for (const Edge& edge : edges) {
+        extent.expandToInclude(edge.getEnvelopeInternal());
+    }
+    auto numCellsPerAxis = static_cast<std::size_t>(
+        std::sqrt(static_cast<double>(edges.size()) / static_cast<double>(EDGES_PER_PARTITION)));
+    double cellWidth = extent.getWidth() / static_cast<double>(numCellsPerAxis);
+    double cellHeight = extent.getHeight() / static_cast<double>(numCellsPerAxis);
+
+    auto cellIndex = [&](double ord, double min, double size) {
+        if (size <= 0)
+            return std::size_t(0);
+        auto i = static_cast<std::size_t>((ord - min) / size);
+        return std::min(i, numCellsPerAxis - 1);
+    };
+
+    //-- assign each edge to the cell containing the centre of its envelope
+    std::vector<std::size_t> edgeCell(edges.size(), 0);
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        const Envelope* env = edges[i].getEnvelopeInternal();
+        if (env->isNull())
+            continue;
+        std::size_t ix = cellIndex((env->getMinX() + env->getMaxX()) / 2, extent.getMinX(), cellWidth);
+        std::size_t iy = cellIndex((env->getMinY() + env->getMaxY()) / 2, extent.getMinY(), cellHeight);
+        edgeCell[i] = iy * numCellsPerAxis + ix;
+    }
+
+    //-- an edge only reads the edges which intersect its envelope,
+    //-- so the edges which intersect only edges of their own cell
+    //-- can be simplified concurrently with those of other cells.
+    //-- Constraint edges are never modified, so are ignored.
+    std::vector<std::vector<std::size_t>> cellEdges(numCellsPerAxis * numCellsPerAxis);
+    std::vector<std::size_t> sharedEdges;
+    const Edge* edgesBegin = edges.data();
+    const Edge* edgesEnd = edges.data() + edges.size();
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        bool isShared = false;
+        for (const Edge* hit : edgeIndex.query(*edges[i].getEnvelopeInternal())) {
+            if (hit >= edgesBegin && hit < edgesEnd
+                    && edgeCell[static_cast<std::size_t>(hit - edgesBegin)] != edgeCell[i]) {
+                isShared = true;
+                break;
+            }
+        }
+        if (isShared)
+            sharedEdges.push_back(i);
+        else
+            cellEdges[edgeCell[i]].push_back(i);
+    }
+
+    std::vector<std::unique_ptr<CoordinateSequence>> ptsSimp(edges.size());
+    util::ThreadPool pool(numThreads);
+    pool.parallelFor(cellEdges.size(), [&](std::size_t cell) {
+        for (std::size_t i : cellEdges[cell]) {
+            ptsSimp[i] = edges[i].simplify(edgeIndex);
+        }
+    });
+    for (std::size_t i : sharedEdges) {
+        ptsSimp[i] = edges[i].simplify(edgeIndex);
+    }
+    return ptsSimp;
+}
+
 /* private */
 std::vector<Edge>
 TPVWSimplifier::createEdges(
@@ -14,6 +14,7 @@
  *
  **********************************************************************/
 
+#include <geos/algorithm/CoordinateKernels.h>
 #include <geos/constants.h>
 #include <geos/profiler.h>
 #include <geos/geom/CoordinateFilter.h>
@@ -128,8 +129,8 @@ CoordinateSequence::CoordinateSequence(const std::initializer_list<CoordinateXYZ
     add(list.begin(), list.end());
 }
 
-template<typename T>
-void fillVector(std::vector<double> & v)
+template<typename T, typename Vector>
+void fillVector(Vector& v)
 {
     const T c;
     T* from = reinterpret_cast<T*>(v.data());
@@ -509,7 +510,27 @@ void
 CoordinateSequence::expandEnvelope(Envelope& env) const
 {
     const std::size_t p_size = getSize();
-    for(std::size_t i = 0; i < p_size; i++) {
+
+    // A null envelope is initialized by the first point,
+    // even if its ordinates are NaN
+    std::size_t i = 0;
+    for(; i < p_size && env.isNull(); i++) {
+        env.expandToInclude(getAt<CoordinateXY>(i));
+    }
+    if(i == p_size) {
+        return;
+    }
+
+    // Otherwise, NaN ordinates are ignored
+    double xmin, xmax, ymin, ymax;
+    algorithm::CoordinateKernels::minMax(*this, i, xmin, xmax, ymin, ymax);
+    if(xmin <= xmax && ymin <= ymax) {
+        env.expandToInclude(xmin, ymin);
+        env.expandToInclude(xmax, ymax);
+        return;
+    }
+
+    for(; i < p_size; i++) {
         env.expandToInclude(getAt<CoordinateXY>(i));
     }
 }
@@ -520,17 +541,8 @@ CoordinateSequence::getEnvelope() const {
         return {};
     }
 
-    double xmin = std::numeric_limits<double>::infinity();
-    double ymin = std::numeric_limits<double>::infinity();
-    double xmax = -std::numeric_limits<double>::infinity();
-    double ymax = -std::numeric_limits<double>::infinity();
-
-    for (std::size_t i = 0; i < m_vect.size(); i += stride()) {
-        xmin = std::min(xmin, m_vect[i]);
-        xmax = std::max(xmax, m_vect[i]);
-        ymin = std::min(ymin, m_vect[i+1]);
-        ymax = std::max(ymax, m_vect[i+1]);
-    }
+    double xmin, xmax, ymin, ymax;
+    algorithm::CoordinateKernels::minMax(*this, 0, xmin, xmax, ymin, ymax);
 
     return {xmin, xmax, ymin, ymax};
 }
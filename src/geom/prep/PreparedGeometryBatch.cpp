@@ -0,0 +1,237 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/prep/PreparedGeometryBatch.h>
+
+#include <geos/algorithm/locate/PointOnGeometryLocator.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/prep/BasicPreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/prep/PreparedPolygon.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/ThreadPool.h>
+
+#include <memory>
+
+using geos::algorithm::locate::PointOnGeometryLocator;
+
+namespace geos {
+namespace geom { // geos.geom
+namespace prep { // geos.geom.prep
+
+namespace {
+
+/// Number of candidates evaluated between checks for interruption
+constexpr std::size_t INTERRUPT_CHECK_INTERVAL = 4096;
+
+enum class BatchPredicate {
+    CONTAINS,
+    INTERSECTS
+};
+
+class BatchEvaluator {
+
+public:
+
+    BatchEvaluator(const PreparedGeometry& p_prep, BatchPredicate p_pred)
+        : prep(p_prep)
+        , pred(p_pred)
+        , locator(nullptr)
+    {
+        const PreparedPolygon* prepPoly = dynamic_cast<const PreparedPolygon*>(&prep);
+        if (prepPoly && !prep.getGeometry().isEmpty()) {
+            env = *prep.getGeometry().getEnvelopeInternal();
+            locator = prepPoly->getIndexedPointLocator();
+        }
+    }
+
+    void evaluate(const Geometry* const* geoms, std::size_t n,
+                  unsigned char* results, std::size_t numThreads)
+    {
+        forEachRange(n, numThreads, [this, geoms, results](std::size_t start, std::size_t end, const PreparedGeometry& p) {
+            for (std::size_t i = start; i < end; i++) {
+                checkForInterrupts(i - start);
+
+                const Geometry* g = geoms[i];
+                if (g == nullptr) {
+                    throw util::IllegalArgumentException("PreparedGeometryBatch: null candidate geometry");
+                }
+
+                if (locator && g->getGeometryTypeId() == GEOS_POINT && !g->isEmpty()) {
+                    results[i] = locatePoint(*static_cast<const Point*>(g)->getCoordinate());
+                }
+                else {
+                    results[i] = evaluateGeometry(p, g);
+                }
+            }
+        });
+    }
+
+    void evaluate(const double* x, const double* y, std::size_t n,
+                  unsigned char* results, std::size_t numThreads)
+    {
+        forEachRange(n, numThreads, [this, x, y, results](std::size_t start, std::size_t end, const PreparedGeometry& p) {
+            if (locator) {
+                for (std::size_t i = start; i < end; i++) {
+                    checkForInterrupts(i - start);
+                    results[i] = locatePoint(CoordinateXY(x[i], y[i]));
+                }
+                return;
+            }
+
+            // Non-polygonal geometry: evaluate the predicate
+            // against a point that is updated for each candidate
+            auto pt = prep.getGeometry().getFactory()->createPoint(CoordinateXY(0, 0));
+            for (std::size_t i = start; i < end; i++) {
+                checkForInterrupts(i - start);
+                pt->setXY(x[i], y[i]);
+                results[i] = evaluateGeometry(p, pt.get());
+            }
+        });
+    }
+
+private:
+
+    const PreparedGeometry& prep;
+    BatchPredicate pred;
+    PointOnGeometryLocator* locator;
+    Envelope env;
+    std::unique_ptr<PreparedGeometry> sharedPrep;
+
+    static void checkForInterrupts(std::size_t count)
+    {
+        if (count % INTERRUPT_CHECK_INTERVAL == 0) {
+            GEOS_CHECK_FOR_INTERRUPTS();
+        }
+    }
+
+    /*
+     * Splits [0, n) into one range per thread and calls
+     * f(start, end, p) for each, where p is the prepared
+     * geometry that the range may use.
+     */
+    template<typename F>
+    void forEachRange(std::size_t n, std::size_t numThreads, F&& f)
+    {
+        if (n == 0) {
+            return;
+        }
+        if (numThreads == 1) {
+            f(0, n, prep);
+            return;
+        }
+
+        util::ThreadPool pool(numThreads);
+        std::size_t numRanges = std::min(n, pool.getNumThreads());
+        if (numRanges == 1) {
+            f(0, n, prep);
+            return;
+        }
+
+        const PreparedGeometry& p = concurrentPrep();
+        pool.parallelFor(numRanges, [n, numRanges, &f, &p](std::size_t r) {
+            f(n * r / numRanges, n * (r + 1) / numRanges, p);
+        });
+    }
+
+    /*
+     * A prepared geometry that may be queried from several threads
+     * at once: the input if it was prepared as shared, or otherwise
+     * a shared preparation of its geometry.
+     */
+    const PreparedGeometry& concurrentPrep()
+    {
+        const BasicPreparedGeometry* basic = dynamic_cast<const BasicPreparedGeometry*>(&prep);
+        if (basic && basic->isShared()) {
+            return prep;
+        }
+        if (!sharedPrep) {
+            sharedPrep = PreparedGeometryFactory::prepareShared(&prep.getGeometry());
+        }
+        return *sharedPrep;
+    }
+
+    unsigned char locatePoint(const CoordinateXY& p) const
+    {
+        if (!env.covers(p.x, p.y)) {
+            return 0;
+        }
+        Location loc = locator->locate(&p);
+        if (pred == BatchPredicate::CONTAINS) {
+            return loc == Location::INTERIOR;
+        }
+        return loc != Location::EXTERIOR;
+    }
+
+    unsigned char evaluateGeometry(const PreparedGeometry& p, const Geometry* g) const
+    {
+        if (pred == BatchPredicate::CONTAINS) {
+            return p.contains(g);
+        }
+        return p.intersects(g);
+    }
+
+};
+
+} // anonymous namespace
+
+/* public static */
+void
+PreparedGeometryBatch::contains(const PreparedGeometry& prep,
+                                const Geometry* const* geoms, std::size_t n,
+                                unsigned char* results, std::size_t numThreads)
+{
+    BatchEvaluator eval(prep, BatchPredicate::CONTAINS);
+    eval.evaluate(geoms, n, results, numThreads);
+}
+
+/* public static */
+void
+PreparedGeometryBatch::intersects(const PreparedGeometry& prep,
+                                  const Geometry* const* geoms, std::size_t n,
+                                  unsigned char* results, std::size_t numThreads)
+{
+    BatchEvaluator eval(prep, BatchPredicate::INTERSECTS);
+    eval.evaluate(geoms, n, results, numThreads);
+}
+
+/* public static */
+void
+PreparedGeometryBatch::containsXY(const PreparedGeometry& prep,
+                                  const double* x, const double* y, std::size_t n,
+                                  unsigned char* results, std::size_t numThreads)
+{
+    BatchEvaluator eval(prep, BatchPredicate::CONTAINS);
+    eval.evaluate(x, y, n, results, numThreads);
+}
+
+/* public static */
+void
+PreparedGeometryBatch::intersectsXY(const PreparedGeometry& prep,
+                                    const double* x, const double* y, std::size_t n,
+                                    unsigned char* results, std::size_t numThreads)
+{
+    BatchEvaluator eval(prep, BatchPredicate::INTERSECTS);
+    eval.evaluate(x, y, n, results, numThreads);
+}
+
+} // namespace geos.geom.prep
+} // namespace geos.geom
+} // namespace geos
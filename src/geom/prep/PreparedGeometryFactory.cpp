@@ -37,7 +37,7 @@ namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
 
 std::unique_ptr<PreparedGeometry>
-PreparedGeometryFactory::create(const geom::Geometry* g) const
+PreparedGeometryFactory::create(const geom::Geometry* g, bool shared) const
 {
     using geos::geom::GeometryTypeId;
 
@@ -52,22 +52,22 @@ PreparedGeometryFactory::create(const geom::Geometry* g) const
     switch(g->getGeometryTypeId()) {
     case GEOS_MULTIPOINT:
     case GEOS_POINT:
-        pg.reset(new PreparedPoint(g));
+        pg.reset(new PreparedPoint(g, shared));
         break;
 
     case GEOS_LINEARRING:
     case GEOS_LINESTRING:
     case GEOS_MULTILINESTRING:
-        pg.reset(new PreparedLineString(g));
+        pg.reset(new PreparedLineString(g, shared));
         break;
 
     case GEOS_POLYGON:
     case GEOS_MULTIPOLYGON:
-        pg.reset(new PreparedPolygon(g));
+        pg.reset(new PreparedPolygon(g, shared));
         break;
 
     default:
-        pg.reset(new BasicPreparedGeometry(g));
+        pg.reset(new BasicPreparedGeometry(g, shared));
     }
     return pg;
 }
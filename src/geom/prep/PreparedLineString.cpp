@@ -46,10 +46,10 @@ PreparedLineString::~PreparedLineString()
 noding::FastSegmentSetIntersectionFinder*
 PreparedLineString::getIntersectionFinder()
 {
-    if(! segIntFinder) {
+    std::call_once(segIntFinderBuilt, [this]() {
         noding::SegmentStringUtil::extractSegmentStrings(&getGeometry(), segStrings);
         segIntFinder.reset(new noding::FastSegmentSetIntersectionFinder(&segStrings));
-    }
+    });
 
     return segIntFinder.get();
 }
@@ -73,9 +73,9 @@ operation::distance::IndexedFacetDistance*
 PreparedLineString::
 getIndexedFacetDistance() const
 {
-    if(! indexedDistance ) {
+    std::call_once(indexedDistanceBuilt, [this]() {
         indexedDistance.reset(new operation::distance::IndexedFacetDistance(&getGeometry()));
-    }
+    });
     return indexedDistance.get();
 }
 
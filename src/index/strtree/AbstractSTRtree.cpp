@@ -18,6 +18,7 @@
 #include <geos/index/strtree/AbstractNode.h>
 #include <geos/index/strtree/ItemBoundable.h>
 #include <geos/index/ItemVisitor.h>
+#include <geos/util/PhaseProfiler.h>
 // std
 #include <algorithm>
 #include <vector>
@@ -58,6 +59,7 @@ AbstractSTRtree::build()
         return;
     }
 
+    util::PhaseProfiler::Timer timer(util::PhaseProfiler::INDEX_BUILD);
     root = (itemBoundables->empty() ? createNode(0) : createHigherLevels(itemBoundables, -1));
     built = true;
 }
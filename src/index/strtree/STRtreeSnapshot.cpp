@@ -0,0 +1,261 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/index/strtree/STRtreeSnapshot.h>
+#include <geos/util/GEOSException.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <cstring>
+#include <limits>
+#include <ostream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace geos {
+namespace index { // geos.index
+namespace strtree { // geos.index.strtree
+
+namespace {
+
+const char MAGIC[8] = { 'G', 'E', 'O', 'S', 'S', 'T', 'R', 'T' };
+const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint64_t numNodes;
+    std::uint64_t numItems;
+};
+
+static_assert(sizeof(Header) == 32, "unexpected snapshot header size");
+static_assert(sizeof(STRtreeSnapshot::Node) == 48, "unexpected snapshot node size");
+
+}
+
+/*
+ * A read-only memory mapping of a snapshot file.
+ */
+struct STRtreeSnapshot::Mapping {
+    const void* data = nullptr;
+    std::size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE map = nullptr;
+#endif
+
+    explicit Mapping(const std::string& path)
+    {
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw util::GEOSException("STRtreeSnapshot: cannot open " + path);
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize)) {
+            close();
+            throw util::GEOSException("STRtreeSnapshot: cannot read size of " + path);
+        }
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+        if (size == 0) {
+            return;
+        }
+        map = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (map != nullptr) {
+            data = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+        }
+        if (data == nullptr) {
+            close();
+            throw util::GEOSException("STRtreeSnapshot: cannot map " + path);
+        }
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw util::GEOSException("STRtreeSnapshot: cannot open " + path);
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw util::GEOSException("STRtreeSnapshot: cannot read size of " + path);
+        }
+        size = static_cast<std::size_t>(st.st_size);
+        if (size > 0) {
+            void* p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw util::GEOSException("STRtreeSnapshot: cannot map " + path);
+            }
+            data = p;
+        }
+        // The mapping remains valid once the descriptor is closed
+        ::close(fd);
+#endif
+    }
+
+    ~Mapping()
+    {
+        close();
+    }
+
+    void close()
+    {
+#ifdef _WIN32
+        if (data) {
+            UnmapViewOfFile(data);
+        }
+        if (map) {
+            CloseHandle(map);
+        }
+        if (file != INVALID_HANDLE_VALUE) {
+            CloseHandle(file);
+        }
+        map = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (data) {
+            munmap(const_cast<void*>(data), size);
+        }
+#endif
+        data = nullptr;
+    }
+};
+
+/* public */
+STRtreeSnapshot::STRtreeSnapshot(const void* data, std::size_t size)
+    : nodes(nullptr)
+    , numNodes(0)
+    , numItems(0)
+{
+    if (size < sizeof(Header)) {
+        throw util::IllegalArgumentException("STRtreeSnapshot: data is too short");
+    }
+    if (reinterpret_cast<std::uintptr_t>(data) % alignof(Node) != 0) {
+        throw util::IllegalArgumentException("STRtreeSnapshot: data is not aligned");
+    }
+
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw util::IllegalArgumentException("STRtreeSnapshot: data is not a snapshot");
+    }
+    if (header.byteOrderMark != BYTE_ORDER_MARK) {
+        throw util::IllegalArgumentException("STRtreeSnapshot: snapshot was written with a different byte order");
+    }
+    if (header.version != VERSION) {
+        throw util::IllegalArgumentException("STRtreeSnapshot: unsupported version " + std::to_string(header.version));
+    }
+    if (header.numNodes > (size - sizeof(Header)) / sizeof(Node) ||
+            size != sizeof(Header) + header.numNodes * sizeof(Node)) {
+        throw util::IllegalArgumentException("STRtreeSnapshot: size of data does not match number of nodes");
+    }
+
+    nodes = reinterpret_cast<const Node*>(static_cast<const char*>(data) + sizeof(Header));
+    numNodes = static_cast<std::size_t>(header.numNodes);
+    numItems = static_cast<std::size_t>(header.numItems);
+}
+
+/* public */
+STRtreeSnapshot::~STRtreeSnapshot() = default;
+
+/* public static */
+std::unique_ptr<STRtreeSnapshot>
+STRtreeSnapshot::open(const std::string& path)
+{
+    std::unique_ptr<Mapping> mapping(new Mapping(path));
+    std::unique_ptr<STRtreeSnapshot> snapshot(new STRtreeSnapshot(mapping->data, mapping->size));
+    snapshot->mapping = std::move(mapping);
+    return snapshot;
+}
+
+/* private static */
+void
+STRtreeSnapshot::write(std::ostream& os, const std::vector<Node>& flat, std::uint64_t p_numItems)
+{
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.numNodes = flat.size();
+    header.numItems = p_numItems;
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    os.write(reinterpret_cast<const char*>(flat.data()), static_cast<std::streamsize>(flat.size() * sizeof(Node)));
+    if (!os) {
+        throw util::GEOSException("STRtreeSnapshot: error writing snapshot");
+    }
+}
+
+/* public */
+void
+STRtreeSnapshot::validate() const
+{
+    for (std::size_t i = 0; i < numNodes; i++) {
+        const Node& n = nodes[i];
+        if (!n.isLeaf() && !hasValidChildren(n, i)) {
+            throwInvalidChildren(i);
+        }
+    }
+}
+
+/* private static */
+void
+STRtreeSnapshot::throwInvalidChildren(std::uint64_t index)
+{
+    throw util::IllegalArgumentException("STRtreeSnapshot: invalid children of node " + std::to_string(index));
+}
+
+/* private static */
+void
+STRtreeSnapshot::setEmpty(Node& n)
+{
+    // Bounds that intersect no envelope
+    n.minX = n.minY = std::numeric_limits<double>::infinity();
+    n.maxX = n.maxY = -std::numeric_limits<double>::infinity();
+}
+
+/* public */
+std::vector<std::uint64_t>
+STRtreeSnapshot::query(const geom::Envelope& queryEnv) const
+{
+    std::vector<std::uint64_t> ids;
+    query(queryEnv, [&ids](std::uint64_t id) {
+        ids.push_back(id);
+    });
+    return ids;
+}
+
+/* public */
+geom::Envelope
+STRtreeSnapshot::getBounds() const
+{
+    if (numNodes == 0 || nodes[0].minX > nodes[0].maxX) {
+        return geom::Envelope();
+    }
+    return geom::Envelope(nodes[0].minX, nodes[0].maxX, nodes[0].minY, nodes[0].maxY);
+}
+
+} // namespace geos.index.strtree
+} // namespace geos.index
+} // namespace geos
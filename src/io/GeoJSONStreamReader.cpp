@@ -0,0 +1,680 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util.h>
+
+#include "geos/vend/include_nlohmann_json.hpp"
+
+#include <istream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+using namespace geos::geom;
+using json = geos_nlohmann::json;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+using PropertyMap = std::map<std::string, GeoJSONValue>;
+
+using FeatureCallback = std::function<void(std::unique_ptr<Geometry>&&, PropertyMap&&, std::string&&)>;
+
+/*
+ * An array of the "coordinates" member of a geometry.
+ * An array of positions adds them to a coordinate sequence as they
+ * are parsed; an array of arrays holds them as children.
+ */
+struct CoordinateArray {
+    std::unique_ptr<CoordinateSequence> seq;
+    std::vector<CoordinateArray> children;
+    double ordinates[3];
+    std::size_t numOrdinates = 0;
+
+    bool isPosition() const
+    {
+        return numOrdinates > 0;
+    }
+
+    Coordinate getCoordinate() const
+    {
+        if (numOrdinates == 1) {
+            throw ParseException("Expected two or three coordinates found one");
+        }
+        if (numOrdinates > 3) {
+            throw ParseException("Expected two or three coordinates found more than three");
+        }
+        if (numOrdinates == 3) {
+            return Coordinate(ordinates[0], ordinates[1], ordinates[2]);
+        }
+        return Coordinate(ordinates[0], ordinates[1]);
+    }
+
+    void add(CoordinateArray&& child)
+    {
+        if (!child.isPosition()) {
+            children.push_back(std::move(child));
+            return;
+        }
+        bool hasZ = (child.numOrdinates == 3);
+        if (seq == nullptr) {
+            seq = detail::make_unique<CoordinateSequence>(0u, hasZ, false);
+        }
+        else if (hasZ && !seq->hasZ()) {
+            // The first position with a Z ordinate makes the sequence 3D
+            auto seqZ = detail::make_unique<CoordinateSequence>(0u, true, false);
+            seqZ->reserve(seq->size() + 1);
+            seqZ->add(*seq);
+            seq = std::move(seqZ);
+        }
+        seq->add(child.getCoordinate());
+    }
+
+    std::unique_ptr<CoordinateSequence> takeSequence()
+    {
+        if (isPosition() || !children.empty()) {
+            throw ParseException("Expected an array of positions");
+        }
+        if (seq == nullptr) {
+            return detail::make_unique<CoordinateSequence>(0u, false, false);
+        }
+        return std::move(seq);
+    }
+
+    std::vector<CoordinateArray>& getArrays()
+    {
+        if (isPosition() || seq != nullptr) {
+            throw ParseException("Expected an array of arrays of positions");
+        }
+        return children;
+    }
+};
+
+/*
+ * A JSON object being read, which may be the document, a feature or
+ * a geometry. Members are collected as they are read, since they may
+ * be in any order, and interpreted once the object ends.
+ */
+struct ObjectFrame {
+    enum Role { DOCUMENT, FEATURE, GEOMETRY, COLLECTION_MEMBER };
+
+    Role role;
+    std::string key;
+    std::string type;
+    std::string id;
+    std::unique_ptr<Geometry> geometry;
+    bool hasGeometry = false;
+    PropertyMap properties;
+    bool hasProperties = false;
+    CoordinateArray coordinates;
+    bool hasCoordinates = false;
+    std::vector<std::unique_ptr<Geometry>> geometries;
+    bool hasGeometries = false;
+    bool hasFeatures = false;
+
+    explicit ObjectFrame(Role p_role) : role(p_role) {}
+};
+
+// An object or array of a property value being read
+struct ValueFrame {
+    bool isObject;
+    std::string key;
+    PropertyMap object;
+    std::vector<GeoJSONValue> array;
+
+    explicit ValueFrame(bool p_isObject) : isObject(p_isObject) {}
+};
+
+class GeoJSONSaxHandler : public geos_nlohmann::json_sax<json> {
+
+public:
+
+    GeoJSONSaxHandler(const GeometryFactory& gf, bool p_isReadingProperties,
+                      const FeatureCallback& p_callback)
+        : geometryFactory(gf)
+        , isReadingProperties(p_isReadingProperties)
+        , callback(p_callback)
+    {}
+
+    bool null() override
+    {
+        switch (target()) {
+        case Target::SKIP:
+            break;
+        case Target::ID:
+            frames.back().id.clear();
+            break;
+        case Target::PROPERTIES:
+            frames.back().hasProperties = true;
+            break;
+        case Target::PROPERTY:
+            addValue(GeoJSONValue());
+            break;
+        default:
+            unexpected("null");
+        }
+        return true;
+    }
+
+    bool boolean(bool val) override
+    {
+        switch (target()) {
+        case Target::SKIP:
+            break;
+        case Target::PROPERTY:
+            addValue(GeoJSONValue(val));
+            break;
+        default:
+            unexpected("boolean");
+        }
+        return true;
+    }
+
+    bool number_integer(number_integer_t val) override
+    {
+        return number(static_cast<double>(val), [val]() {
+            return std::to_string(val);
+        });
+    }
+
+    bool number_unsigned(number_unsigned_t val) override
+    {
+        return number(static_cast<double>(val), [val]() {
+            return std::to_string(val);
+        });
+    }
+
+    bool number_float(number_float_t val, const string_t& text) override
+    {
+        return number(val, [&text]() {
+            return text;
+        });
+    }
+
+    bool string(string_t& val) override
+    {
+        switch (target()) {
+        case Target::SKIP:
+            break;
+        case Target::TYPE:
+            frames.back().type = val;
+            break;
+        case Target::ID:
+            frames.back().id = val;
+            break;
+        case Target::PROPERTY:
+            addValue(GeoJSONValue(val));
+            break;
+        default:
+            unexpected("string");
+        }
+        return true;
+    }
+
+    bool binary(binary_t&) override
+    {
+        unexpected("binary value");
+        return false;
+    }
+
+    bool start_object(std::size_t) override
+    {
+        switch (target()) {
+        case Target::SKIP:
+            contexts.push_back(Context::SKIP);
+            break;
+        case Target::DOCUMENT:
+            startFrame(ObjectFrame::DOCUMENT);
+            break;
+        case Target::FEATURE:
+            startFrame(ObjectFrame::FEATURE);
+            break;
+        case Target::GEOMETRY:
+            startFrame(ObjectFrame::GEOMETRY);
+            break;
+        case Target::COLLECTION_MEMBER:
+            startFrame(ObjectFrame::COLLECTION_MEMBER);
+            break;
+        case Target::PROPERTIES:
+            frames.back().hasProperties = true;
+            values.emplace_back(true);
+            contexts.push_back(Context::VALUE);
+            break;
+        case Target::PROPERTY:
+            values.emplace_back(true);
+            contexts.push_back(Context::VALUE);
+            break;
+        default:
+            unexpected("object");
+        }
+        return true;
+    }
+
+    bool key(string_t& val) override
+    {
+        switch (contexts.back()) {
+        case Context::OBJECT:
+            frames.back().key = val;
+            break;
+        case Context::VALUE:
+            values.back().key = val;
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool end_object() override
+    {
+        Context context = contexts.back();
+        contexts.pop_back();
+        if (context == Context::OBJECT) {
+            ObjectFrame frame = std::move(frames.back());
+            frames.pop_back();
+            endFrame(frame);
+        }
+        else if (context == Context::VALUE) {
+            endValue();
+        }
+        return true;
+    }
+
+    bool start_array(std::size_t) override
+    {
+        switch (target()) {
+        case Target::SKIP:
+            contexts.push_back(Context::SKIP);
+            break;
+        case Target::COORDINATES:
+            frames.back().hasCoordinates = true;
+            coordinates.emplace_back();
+            contexts.push_back(Context::COORDINATES);
+            break;
+        case Target::COORDINATE:
+            coordinates.emplace_back();
+            contexts.push_back(Context::COORDINATES);
+            break;
+        case Target::GEOMETRIES:
+            frames.back().hasGeometries = true;
+            contexts.push_back(Context::GEOMETRIES);
+            break;
+        case Target::FEATURES:
+            frames.back().hasFeatures = true;
+            contexts.push_back(Context::FEATURES);
+            break;
+        case Target::PROPERTY:
+            values.emplace_back(false);
+            contexts.push_back(Context::VALUE);
+            break;
+        default:
+            unexpected("array");
+        }
+        return true;
+    }
+
+    bool end_array() override
+    {
+        Context context = contexts.back();
+        contexts.pop_back();
+        if (context == Context::COORDINATES) {
+            CoordinateArray array = std::move(coordinates.back());
+            coordinates.pop_back();
+            if (coordinates.empty()) {
+                frames.back().coordinates = std::move(array);
+            }
+            else {
+                coordinates.back().add(std::move(array));
+            }
+        }
+        else if (context == Context::VALUE) {
+            endValue();
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const geos_nlohmann::detail::exception& ex) override
+    {
+        throw ParseException("Error parsing JSON", ex.what());
+    }
+
+private:
+
+    // The kind of JSON container being read
+    enum class Context { OBJECT, FEATURES, GEOMETRIES, COORDINATES, VALUE, SKIP };
+
+    // What the next JSON value read is
+    enum class Target {
+        DOCUMENT, FEATURE, GEOMETRY, COLLECTION_MEMBER,
+        TYPE, ID, PROPERTIES, PROPERTY,
+        COORDINATES, COORDINATE, GEOMETRIES, FEATURES, SKIP
+    };
+
+    const GeometryFactory& geometryFactory;
+    bool isReadingProperties;
+    const FeatureCallback& callback;
+
+    std::vector<Context> contexts;
+    std::vector<ObjectFrame> frames;
+    std::vector<ValueFrame> values;
+    std::vector<CoordinateArray> coordinates;
+
+    Target target() const
+    {
+        if (contexts.empty()) {
+            return Target::DOCUMENT;
+        }
+        switch (contexts.back()) {
+        case Context::FEATURES:
+            return Target::FEATURE;
+        case Context::GEOMETRIES:
+            return Target::COLLECTION_MEMBER;
+        case Context::COORDINATES:
+            return Target::COORDINATE;
+        case Context::VALUE:
+            return Target::PROPERTY;
+        case Context::SKIP:
+            return Target::SKIP;
+        case Context::OBJECT:
+            break;
+        }
+
+        // Other members, such as "bbox" or "crs", are skipped
+        const ObjectFrame& frame = frames.back();
+        const std::string& key = frame.key;
+        if (key == "type") {
+            return Target::TYPE;
+        }
+        if (key == "coordinates") {
+            return Target::COORDINATES;
+        }
+        if (key == "geometries") {
+            return Target::GEOMETRIES;
+        }
+        if (key == "geometry") {
+            return Target::GEOMETRY;
+        }
+        if (key == "id") {
+            return Target::ID;
+        }
+        if (key == "properties") {
+            return isReadingProperties ? Target::PROPERTIES : Target::SKIP;
+        }
+        if (key == "features" && frame.role == ObjectFrame::DOCUMENT) {
+            return Target::FEATURES;
+        }
+        return Target::SKIP;
+    }
+
+    [[noreturn]] void unexpected(const std::string& what) const
+    {
+        if (!contexts.empty() && contexts.back() == Context::OBJECT) {
+            throw ParseException("Unexpected " + what + " in member " + frames.back().key);
+        }
+        throw ParseException("Unexpected " + what);
+    }
+
+    // The text of the number is only produced for an id
+    template<typename TextFn>
+    bool number(double val, TextFn&& text)
+    {
+        switch (target()) {
+        case Target::SKIP:
+            break;
+        case Target::COORDINATE: {
+            CoordinateArray& position = coordinates.back();
+            if (!position.children.empty() || position.seq != nullptr) {
+                throw ParseException("Expected an array of positions");
+            }
+            if (position.numOrdinates < 3) {
+                position.ordinates[position.numOrdinates] = val;
+            }
+            position.numOrdinates++;
+            break;
+        }
+        case Target::ID:
+            frames.back().id = text();
+            break;
+        case Target::PROPERTY:
+            addValue(GeoJSONValue(val));
+            break;
+        default:
+            unexpected("number");
+        }
+        return true;
+    }
+
+    void addValue(const GeoJSONValue& val)
+    {
+        ValueFrame& parent = values.back();
+        if (parent.isObject) {
+            parent.object[parent.key] = val;
+        }
+        else {
+            parent.array.push_back(val);
+        }
+    }
+
+    void endValue()
+    {
+        ValueFrame value = std::move(values.back());
+        values.pop_back();
+        if (values.empty()) {
+            // The properties member of a feature
+            frames.back().properties = std::move(value.object);
+        }
+        else if (value.isObject) {
+            addValue(GeoJSONValue(value.object));
+        }
+        else {
+            addValue(GeoJSONValue(value.array));
+        }
+    }
+
+    void startFrame(ObjectFrame::Role role)
+    {
+        frames.emplace_back(role);
+        contexts.push_back(Context::OBJECT);
+    }
+
+    void endFrame(ObjectFrame& frame)
+    {
+        switch (frame.role) {
+        case ObjectFrame::DOCUMENT:
+            endDocument(frame);
+            break;
+        case ObjectFrame::FEATURE:
+            endFeature(frame);
+            break;
+        case ObjectFrame::GEOMETRY:
+            frames.back().geometry = readGeometry(frame);
+            frames.back().hasGeometry = true;
+            break;
+        case ObjectFrame::COLLECTION_MEMBER:
+            frames.back().geometries.push_back(readGeometry(frame));
+            break;
+        }
+    }
+
+    void endDocument(ObjectFrame& frame)
+    {
+        if (frame.type == "FeatureCollection") {
+            if (!frame.hasFeatures) {
+                throw ParseException("FeatureCollection has no features");
+            }
+        }
+        else if (frame.hasFeatures) {
+            throw ParseException("Document with features is not a FeatureCollection");
+        }
+        else if (frame.type == "Feature") {
+            endFeature(frame);
+        }
+        else {
+            callback(readGeometry(frame), PropertyMap(), std::string());
+        }
+    }
+
+    void endFeature(ObjectFrame& frame)
+    {
+        if (!frame.hasGeometry) {
+            throw ParseException("Feature has no geometry");
+        }
+        if (isReadingProperties && !frame.hasProperties) {
+            throw ParseException("Feature has no properties");
+        }
+        callback(std::move(frame.geometry), std::move(frame.properties), std::move(frame.id));
+    }
+
+    std::unique_ptr<Geometry> readGeometry(ObjectFrame& frame) const
+    {
+        const std::string& type = frame.type;
+        if (type == "GeometryCollection") {
+            if (!frame.hasGeometries) {
+                throw ParseException("GeometryCollection has no geometries");
+            }
+            return geometryFactory.createGeometryCollection(std::move(frame.geometries));
+        }
+
+        if (!frame.hasCoordinates) {
+            if (type.empty()) {
+                throw ParseException("Expected a GeoJSON type");
+            }
+            throw ParseException(type + " has no coordinates");
+        }
+        CoordinateArray& coords = frame.coordinates;
+
+        if (type == "Point") {
+            if (!coords.children.empty() || coords.seq != nullptr) {
+                throw ParseException("Expected a position");
+            }
+            if (coords.numOrdinates == 0) {
+                return geometryFactory.createPoint(2);
+            }
+            return geometryFactory.createPoint(coords.getCoordinate());
+        }
+        else if (type == "LineString") {
+            return geometryFactory.createLineString(coords.takeSequence());
+        }
+        else if (type == "Polygon") {
+            return readPolygon(coords);
+        }
+        else if (type == "MultiPoint") {
+            auto seq = coords.takeSequence();
+            std::vector<std::unique_ptr<Point>> points;
+            points.reserve(seq->size());
+            Coordinate c;
+            for (std::size_t i = 0; i < seq->size(); i++) {
+                seq->getAt(i, c);
+                points.push_back(geometryFactory.createPoint(c));
+            }
+            return geometryFactory.createMultiPoint(std::move(points));
+        }
+        else if (type == "MultiLineString") {
+            std::vector<std::unique_ptr<LineString>> lines;
+            for (auto& line : coords.getArrays()) {
+                lines.push_back(geometryFactory.createLineString(line.takeSequence()));
+            }
+            return geometryFactory.createMultiLineString(std::move(lines));
+        }
+        else if (type == "MultiPolygon") {
+            std::vector<std::unique_ptr<Polygon>> polygons;
+            for (auto& polygon : coords.getArrays()) {
+                polygons.push_back(readPolygon(polygon));
+            }
+            return geometryFactory.createMultiPolygon(std::move(polygons));
+        }
+        throw ParseException{"Unknown geometry type!"};
+    }
+
+    std::unique_ptr<Polygon> readPolygon(CoordinateArray& coords) const
+    {
+        std::unique_ptr<LinearRing> shell;
+        std::vector<std::unique_ptr<LinearRing>> holes;
+        for (auto& ring : coords.getArrays()) {
+            auto lr = geometryFactory.createLinearRing(ring.takeSequence());
+            if (!shell) {
+                shell = std::move(lr);
+            }
+            else {
+                holes.push_back(std::move(lr));
+            }
+        }
+        if (!shell) {
+            return geometryFactory.createPolygon(2);
+        }
+        return geometryFactory.createPolygon(std::move(shell), std::move(holes));
+    }
+
+};
+
+void
+parse(std::istream& is, const GeometryFactory& gf, bool isReadingProperties,
+      const FeatureCallback& callback)
+{
+    GeoJSONSaxHandler handler(gf, isReadingProperties, callback);
+    json::sax_parse(is, &handler);
+}
+
+} // anonymous namespace
+
+GeoJSONStreamReader::GeoJSONStreamReader()
+    : GeoJSONStreamReader(*(GeometryFactory::getDefaultInstance()))
+{}
+
+GeoJSONStreamReader::GeoJSONStreamReader(const geom::GeometryFactory& gf)
+    : geometryFactory(gf)
+{}
+
+void
+GeoJSONStreamReader::readFeatures(std::istream& is, const FeatureHandler& handler) const
+{
+    parse(is, geometryFactory, true,
+    [&handler](std::unique_ptr<Geometry>&& g, PropertyMap&& p, std::string&& id) {
+        handler(GeoJSONFeature(std::move(g), std::move(p), std::move(id)));
+    });
+}
+
+void
+GeoJSONStreamReader::readFeatures(const std::string& geoJsonText, const FeatureHandler& handler) const
+{
+    std::istringstream is(geoJsonText);
+    readFeatures(is, handler);
+}
+
+void
+GeoJSONStreamReader::readGeometries(std::istream& is, const GeometryHandler& handler) const
+{
+    parse(is, geometryFactory, false,
+    [&handler](std::unique_ptr<Geometry>&& g, PropertyMap&&, std::string&&) {
+        handler(std::move(g));
+    });
+}
+
+} // namespace geos.io
+} // namespace geos
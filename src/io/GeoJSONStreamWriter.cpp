@@ -0,0 +1,432 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/io/Writer.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/IllegalStateException.h>
+#include <geos/util.h>
+
+#include "geos/vend/include_nlohmann_json.hpp"
+
+#include <cmath>
+#include <ostream>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+/* public */
+GeoJSONStreamWriter::GeoJSONStreamWriter(std::ostream& p_os)
+    : os(&p_os)
+    , writer(nullptr)
+    , roundingPrecision(-1)
+    , outputDimension(3)
+    , decimalPlaces(0)
+    , isInCollection(false)
+    , isFirstFeature(false)
+{
+    buf.reserve(BUFFER_SIZE);
+}
+
+/* public */
+GeoJSONStreamWriter::GeoJSONStreamWriter(Writer& p_writer)
+    : os(nullptr)
+    , writer(&p_writer)
+    , roundingPrecision(-1)
+    , outputDimension(3)
+    , decimalPlaces(0)
+    , isInCollection(false)
+    , isFirstFeature(false)
+{
+    buf.reserve(BUFFER_SIZE);
+}
+
+/* public */
+GeoJSONStreamWriter::~GeoJSONStreamWriter()
+{
+    flush();
+}
+
+/* public */
+void
+GeoJSONStreamWriter::setOutputDimension(uint8_t dims)
+{
+    if(dims < 2 || dims > 3) {
+        throw util::IllegalArgumentException("GeoJSON output dimension must be 2 or 3");
+    }
+    outputDimension = dims;
+}
+
+/* public */
+void
+GeoJSONStreamWriter::flush()
+{
+    if (buf.empty()) {
+        return;
+    }
+    if (os) {
+        os->write(buf.data(), static_cast<std::streamsize>(buf.size()));
+    }
+    else {
+        writer->write(buf.data(), buf.size());
+    }
+    buf.clear();
+}
+
+/* private */
+void
+GeoJSONStreamWriter::flushIfFull()
+{
+    if (buf.size() >= BUFFER_SIZE) {
+        flush();
+    }
+}
+
+/* public */
+void
+GeoJSONStreamWriter::beginFeatureCollection()
+{
+    if (isInCollection) {
+        throw util::IllegalStateException("FeatureCollection has already been started");
+    }
+    append("{\"type\":\"FeatureCollection\",\"features\":[");
+    isInCollection = true;
+    isFirstFeature = true;
+}
+
+/* public */
+void
+GeoJSONStreamWriter::endFeatureCollection()
+{
+    if (!isInCollection) {
+        throw util::IllegalStateException("FeatureCollection has not been started");
+    }
+    append("]}");
+    isInCollection = false;
+    flush();
+}
+
+/* public */
+void
+GeoJSONStreamWriter::writeFeature(const GeoJSONFeature& feature)
+{
+    writeFeature(*feature.getGeometry(), feature.getProperties(), feature.getId());
+}
+
+/* public */
+void
+GeoJSONStreamWriter::writeFeature(const Geometry& geometry,
+                                  const std::map<std::string, GeoJSONValue>& properties,
+                                  const std::string& id)
+{
+    util::ensureNoCurvedComponents(geometry);
+
+    if (isInCollection && !isFirstFeature) {
+        append(",");
+    }
+    isFirstFeature = false;
+
+    append("{\"type\":\"Feature\"");
+    if (!id.empty()) {
+        append(",\"id\":");
+        appendString(id);
+    }
+    append(",\"geometry\":");
+    appendGeometry(geometry);
+    append(",\"properties\":{");
+    bool isFirst = true;
+    for (const auto& property : properties) {
+        if (!isFirst) {
+            append(",");
+        }
+        isFirst = false;
+        appendString(property.first);
+        append(":");
+        appendValue(property.second);
+    }
+    append("}}");
+    flushIfFull();
+}
+
+/* public */
+void
+GeoJSONStreamWriter::writeGeometry(const Geometry& geometry)
+{
+    if (isInCollection) {
+        throw util::IllegalStateException("A geometry cannot be written in a FeatureCollection");
+    }
+    util::ensureNoCurvedComponents(geometry);
+    appendGeometry(geometry);
+    flushIfFull();
+}
+
+/* private */
+void
+GeoJSONStreamWriter::appendNumber(double d, uint32_t precision)
+{
+    // JSON has no representation of non-finite numbers
+    if (!std::isfinite(d)) {
+        append("null");
+        return;
+    }
+    char numBuf[28];
+    int len = WKTWriter::writeTrimmedNumber(d, precision, numBuf);
+    append(numBuf, static_cast<std::size_t>(len));
+}
+
+/* private */
+void
+GeoJSONStreamWriter::appendPropertyNumber(double d)
+{
+    if (!std::isfinite(d)) {
+        append("null");
+        return;
+    }
+    // The shortest representation which reads back as the same
+    // double, as written by GeoJSONWriter
+    char numBuf[32];
+    char* end = geos_nlohmann::detail::to_chars(numBuf, numBuf + sizeof(numBuf), d);
+    append(numBuf, static_cast<std::size_t>(end - numBuf));
+}
+
+/* private */
+void
+GeoJSONStreamWriter::appendString(const std::string& s)
+{
+    static const char* hexDigits = "0123456789abcdef";
+
+    buf.push_back('"');
+    for (char ch : s) {
+        switch (ch) {
+        case '"':
+            append("\\\"");
+            break;
+        case '\\':
+            append("\\\\");
+            break;
+        case '\b':
+            append("\\b");
+            break;
+        case '\f':
+            append("\\f");
+            break;
+        case '\n':
+            append("\\n");
+            break;
+        case '\r':
+            append("\\r");
+            break;
+        case '\t':
+            append("\\t");
+            break;
+        default:
+            if (static_cast<unsigned char>(ch) < 0x20) {
+                char escaped[] = { '\\', 'u', '0', '0',
+                                   hexDigits[(ch >> 4) & 0xf], hexDigits[ch & 0xf]
+                                 };
+                append(escaped, sizeof(escaped));
+            }
+            else {
+                buf.push_back(ch);
+            }
+        }
+    }
+    buf.push_back('"');
+}
+
+/* private */
+void
+GeoJSONStreamWriter::appendValue(const GeoJSONValue& value)
+{
+    if (value.isNumber()) {
+        appendPropertyNumber(value.getNumber());
+    }
+    else if (value.isString()) {
+        appendString(value.getString());
+    }
+    else if (value.isBoolean()) {
+        append(value.getBoolean() ? "true" : "false");
+    }
+    else if (value.isNull()) {
+        append("null");
+    }
+    else if (value.isArray()) {
+        append("[");
+        bool isFirst = true;
+        for (const GeoJSONValue& v : value.getArray()) {
+            if (!isFirst) {
+                append(",");
+            }
+            isFirst = false;
+            appendValue(v);
+        }
+        append("]");
+    }
+    else if (value.isObject()) {
+        append("{");
+        bool isFirst = true;
+        for (const auto& entry : value.getObject()) {
+            if (!isFirst) {
+                append(",");
+            }
+            isFirst = false;
+            appendString(entry.first);
+            append(":");
+            appendValue(entry.second);
+        }
+        append("}");
+    }
+}
+
+/* private */
+void
+GeoJSONStreamWriter::appendGeometry(const Geometry& geometry)
+{
+    int places = roundingPrecision == -1
+                 ? geometry.getPrecisionModel()->getMaximumSignificantDigits()
+                 : roundingPrecision;
+    decimalPlaces = places >= 0 ? static_cast<uint32_t>(places) : 0;
+
+    switch (geometry.getGeometryTypeId()) {
+    case GEOS_POINT: {
+        const auto& point = static_cast<const Point&>(geometry);
+        append("{\"type\":\"Point\",\"coordinates\":");
+        if (point.isEmpty()) {
+            append("[]");
+        }
+        else {
+            appendPosition(*point.getCoordinatesRO(), 0);
+        }
+        break;
+    }
+    case GEOS_LINESTRING:
+    case GEOS_LINEARRING:
+        append("{\"type\":\"LineString\",\"coordinates\":");
+        appendCoordinates(*static_cast<const LineString&>(geometry).getCoordinatesRO());
+        break;
+    case GEOS_POLYGON:
+        append("{\"type\":\"Polygon\",\"coordinates\":");
+        appendPolygonCoordinates(static_cast<const Polygon&>(geometry));
+        break;
+    case GEOS_MULTIPOINT: {
+        append("{\"type\":\"MultiPoint\",\"coordinates\":[");
+        bool isFirst = true;
+        for (std::size_t i = 0; i < geometry.getNumGeometries(); i++) {
+            const auto* point = static_cast<const Point*>(geometry.getGeometryN(i));
+            if (point->isEmpty()) {
+                continue;
+            }
+            if (!isFirst) {
+                append(",");
+            }
+            isFirst = false;
+            appendPosition(*point->getCoordinatesRO(), 0);
+        }
+        append("]");
+        break;
+    }
+    case GEOS_MULTILINESTRING:
+        append("{\"type\":\"MultiLineString\",\"coordinates\":[");
+        for (std::size_t i = 0; i < geometry.getNumGeometries(); i++) {
+            if (i > 0) {
+                append(",");
+            }
+            appendCoordinates(*static_cast<const LineString*>(geometry.getGeometryN(i))->getCoordinatesRO());
+        }
+        append("]");
+        break;
+    case GEOS_MULTIPOLYGON:
+        append("{\"type\":\"MultiPolygon\",\"coordinates\":[");
+        for (std::size_t i = 0; i < geometry.getNumGeometries(); i++) {
+            if (i > 0) {
+                append(",");
+            }
+            appendPolygonCoordinates(*static_cast<const Polygon*>(geometry.getGeometryN(i)));
+        }
+        append("]");
+        break;
+    case GEOS_GEOMETRYCOLLECTION:
+        append("{\"type\":\"GeometryCollection\",\"geometries\":[");
+        for (std::size_t i = 0; i < geometry.getNumGeometries(); i++) {
+            if (i > 0) {
+                append(",");
+            }
+            appendGeometry(*geometry.getGeometryN(i));
+        }
+        append("]");
+        break;
+    default:
+        throw util::IllegalArgumentException("Unsupported geometry type " + geometry.getGeometryType());
+    }
+    append("}");
+}
+
+/* private */
+void
+GeoJSONStreamWriter::appendPosition(const CoordinateSequence& seq, std::size_t i)
+{
+    append("[");
+    appendNumber(seq.getX(i), decimalPlaces);
+    append(",");
+    appendNumber(seq.getY(i), decimalPlaces);
+    if (outputDimension == 3 && seq.hasZ()) {
+        double z = seq.getOrdinate(i, CoordinateSequence::Z);
+        if (!std::isnan(z)) {
+            append(",");
+            appendNumber(z, decimalPlaces);
+        }
+    }
+    append("]");
+}
+
+/* private */
+void
+GeoJSONStreamWriter::appendCoordinates(const CoordinateSequence& seq)
+{
+    append("[");
+    for (std::size_t i = 0; i < seq.size(); i++) {
+        if (i > 0) {
+            append(",");
+        }
+        appendPosition(seq, i);
+    }
+    append("]");
+}
+
+/* private */
+void
+GeoJSONStreamWriter::appendPolygonCoordinates(const Polygon& polygon)
+{
+    append("[");
+    appendCoordinates(*polygon.getExteriorRing()->getCoordinatesRO());
+    for (std::size_t i = 0; i < polygon.getNumInteriorRing(); i++) {
+        append(",");
+        appendCoordinates(*polygon.getInteriorRingN(i)->getCoordinatesRO());
+    }
+    append("]");
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -0,0 +1,203 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/ParallelStreamReader.h>
+
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKBReader.h>
+#include <geos/io/WKBStreamReader.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTStreamReader.h>
+#include <geos/util/ThreadPool.h>
+
+#include <chrono>
+#include <sstream>
+
+using geos::geom::Geometry;
+
+namespace geos {
+namespace io {
+
+/* public */
+ParallelStreamReader::ParallelStreamReader(std::istream& p_instr, Format p_format,
+        std::size_t numThreads, std::size_t queueSize,
+        const geom::GeometryFactory* p_factory)
+    : instr(p_instr)
+    , format(p_format)
+    , factory(p_factory ? p_factory : geom::GeometryFactory::getDefaultInstance())
+    , pool(new util::ThreadPool(numThreads))
+    , numRead(0)
+    , numTaken(0)
+    , numRunning(0)
+    , isEndOfStream(false)
+    , isStopping(false)
+{
+    if (queueSize == 0) {
+        queueSize = pool->getNumThreads() * RECORDS_PER_THREAD;
+    }
+    slots.resize(queueSize);
+
+    readerThread = std::thread(&ParallelStreamReader::readRecords, this);
+}
+
+/* private */
+template<typename Predicate>
+void
+ParallelStreamReader::waitHelping(std::unique_lock<std::mutex>& lock, Predicate&& isDone)
+{
+    while (!isDone()) {
+        // A pool of one thread has no workers, so the waiting
+        // thread parses queued records itself.
+        lock.unlock();
+        bool ran = pool->runPendingTask();
+        lock.lock();
+        if (!ran) {
+            cond.wait_for(lock, std::chrono::microseconds(100), isDone);
+        }
+    }
+}
+
+/* public */
+ParallelStreamReader::~ParallelStreamReader()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        isStopping = true;
+    }
+    cond.notify_all();
+    readerThread.join();
+
+    // Parse tasks refer to the slots, so they must complete
+    // before the slots and the pool are destroyed.
+    std::unique_lock<std::mutex> lock(mtx);
+    waitHelping(lock, [this]() {
+        return numRunning == 0;
+    });
+}
+
+/* private */
+void
+ParallelStreamReader::readRecords()
+{
+    std::string record;
+    try {
+        while (true) {
+            bool hasRecord = (format == Format::WKT)
+                             ? WKTStreamReader::nextRecord(instr, record)
+                             : WKBStreamReader::nextRecord(instr, record);
+            if (!hasRecord) {
+                break;
+            }
+
+            std::unique_lock<std::mutex> lock(mtx);
+            cond.wait(lock, [this]() {
+                return isStopping || slots[numRead % slots.size()].state == Slot::FREE;
+            });
+            if (isStopping) {
+                break;
+            }
+
+            std::size_t index = numRead % slots.size();
+            Slot& slot = slots[index];
+            slot.record.swap(record);
+            slot.state = Slot::QUEUED;
+            numRead++;
+            numRunning++;
+            lock.unlock();
+
+            pool->submit([this, index]() {
+                parse(index);
+            });
+            cond.notify_all();
+        }
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(mtx);
+        readError = std::current_exception();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        isEndOfStream = true;
+    }
+    cond.notify_all();
+}
+
+/* private */
+void
+ParallelStreamReader::parse(std::size_t index)
+{
+    // The slot is owned by this task until it is marked as parsed
+    Slot& slot = slots[index];
+    try {
+        if (format == Format::WKT) {
+            WKTReader rdr(factory);
+            slot.geom = rdr.read(slot.record);
+        }
+        else {
+            WKBReader rdr(*factory);
+            std::istringstream hex(slot.record);
+            slot.geom = rdr.readHEX(hex);
+        }
+    }
+    catch (...) {
+        slot.error = std::current_exception();
+    }
+
+    // Notify under the lock, since the reader may be destroyed
+    // as soon as the last task has finished
+    std::lock_guard<std::mutex> lock(mtx);
+    slot.state = Slot::PARSED;
+    numRunning--;
+    cond.notify_all();
+}
+
+/* public */
+std::unique_ptr<Geometry>
+ParallelStreamReader::next()
+{
+    std::unique_lock<std::mutex> lock(mtx);
+    auto isReady = [this]() {
+        return (numTaken < numRead && slots[numTaken % slots.size()].state == Slot::PARSED)
+               || (numTaken == numRead && isEndOfStream);
+    };
+    waitHelping(lock, isReady);
+
+    if (numTaken == numRead) {
+        if (readError) {
+            std::exception_ptr error = readError;
+            readError = nullptr;
+            std::rethrow_exception(error);
+        }
+        return nullptr;
+    }
+
+    Slot& slot = slots[numTaken % slots.size()];
+    std::unique_ptr<Geometry> geom = std::move(slot.geom);
+    std::exception_ptr error = slot.error;
+    slot.error = nullptr;
+    slot.record.clear();
+    slot.state = Slot::FREE;
+    numTaken++;
+    lock.unlock();
+    cond.notify_all();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return geom;
+}
+
+} // namespace geos::io
+} // namespace geos
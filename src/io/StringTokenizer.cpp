@@ -20,9 +20,13 @@
 #include <geos/io/StringTokenizer.h>
 #include <geos/constants.h>
 
-#include <string>
+#include <charconv>
+#include <cfloat>
+#include <cstdint>
 #include <cstdlib>
 #include <limits>
+#include <string>
+#include <system_error>
 
 using std::string;
 
@@ -75,112 +79,220 @@ strtod_with_vc_fix(const char* str, char** str_end)
     return dbl;
 }
 
-/*public*/
-int
-StringTokenizer::nextToken()
+namespace {
+
+const char* const WHITESPACE = " \n\r\t";
+const char* const DELIMITERS = "\n\r\t() ,";
+
+// Powers of ten which are exactly representable as doubles
+const double EXACT_POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+bool
+isDigit(char c)
 {
-    string tok = "";
-    if(iter == str.end()) {
-        return StringTokenizer::TT_EOF;
+    return c >= '0' && c <= '9';
+}
+
+/*
+ * Parses a decimal number using Clinger's fast path.
+ * If the significand is exactly representable as a double and
+ * the power of ten is one of EXACT_POWERS_OF_TEN, a single correctly
+ * rounded multiplication or division gives the correctly rounded
+ * result, as computed by strtod.
+ * Returns false if the fast path does not apply.
+ */
+bool
+readDoubleFast(const char* p, const char* last, double& result)
+{
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    bool isNegative = false;
+    if (p != last && (*p == '-' || *p == '+')) {
+        isNegative = (*p == '-');
+        ++p;
     }
-    switch(*iter) {
-    case '(':
-    case ')':
-    case ',':
-        return *iter++;
-    case '\n':
-    case '\r':
-    case '\t':
-    case ' ':
-        string::size_type pos = str.find_first_not_of(" \n\r\t",
-                                static_cast<string::size_type>(iter - str.begin()));
-        if(pos == string::npos) {
-            return StringTokenizer::TT_EOF;
+
+    std::uint64_t significand = 0;
+    int numDigits = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+
+    auto addDigit = [&significand, &numDigits](char c) {
+        // Leading zeros are not significant
+        if (significand == 0 && c == '0') {
+            return true;
+        }
+        if (++numDigits > 19) {
+            return false;
+        }
+        significand = significand * 10 + static_cast<std::uint64_t>(c - '0');
+        return true;
+    };
+
+    for (; p != last && isDigit(*p); ++p) {
+        hasDigits = true;
+        if (!addDigit(*p)) {
+            return false;
         }
-        else {
-            iter = str.begin() + static_cast<string::difference_type>(pos);
-            return nextToken();
+    }
+    if (p != last && *p == '.') {
+        for (++p; p != last && isDigit(*p); ++p) {
+            hasDigits = true;
+            exponent--;
+            if (!addDigit(*p)) {
+                return false;
+            }
         }
     }
-    string::size_type pos = str.find_first_of("\n\r\t() ,",
-                            static_cast<string::size_type>(iter - str.begin()));
-    if(pos == string::npos) {
-        if(iter != str.end()) {
-            tok.assign(iter, str.end());
-            iter = str.end();
+    if (!hasDigits) {
+        return false;
+    }
+
+    if (p != last && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool isNegativeExp = false;
+        if (p != last && (*p == '-' || *p == '+')) {
+            isNegativeExp = (*p == '-');
+            ++p;
+        }
+        if (p == last || !isDigit(*p)) {
+            return false;
         }
-        else {
-            return StringTokenizer::TT_EOF;
+        int exp = 0;
+        for (; p != last && isDigit(*p); ++p) {
+            if (exp < 10000) {
+                exp = exp * 10 + (*p - '0');
+            }
         }
+        exponent += isNegativeExp ? -exp : exp;
     }
-    else {
-        tok.assign(iter, str.begin() + static_cast<string::difference_type>(pos));
-        iter = str.begin() + static_cast<string::difference_type>(pos);
+
+    if (p != last || significand > (std::uint64_t(1) << 53) ||
+            exponent < -22 || exponent > 22) {
+        return false;
     }
-    char* stopstring;
-    double dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
-    if(*stopstring == '\0') {
-        ntok = dbl;
-        stok = "";
-        return StringTokenizer::TT_NUMBER;
+
+    double d = static_cast<double>(significand);
+    if (exponent < 0) {
+        d /= EXACT_POWERS_OF_TEN[-exponent];
     }
     else {
-        ntok = 0.0;
-        stok = tok;
-        return StringTokenizer::TT_WORD;
+        d *= EXACT_POWERS_OF_TEN[exponent];
     }
+    result = isNegative ? -d : d;
+    return true;
+#else
+    // Extended precision intermediates would round twice
+    (void) p;
+    (void) last;
+    (void) result;
+    return false;
+#endif
 }
 
-/*public*/
-int
-StringTokenizer::peekNextToken()
+bool
+readDoubleStrtod(const char* first, const char* last, double& result)
 {
-
-    string::size_type pos;
-    string tok = "";
-    if(iter == str.end()) {
-        return StringTokenizer::TT_EOF;
+    // strtod requires a terminated string
+    std::string tok(first, last);
+    char* stopstring;
+    double dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
+    if (tok.empty() || *stopstring != '\0') {
+        return false;
     }
+    result = dbl;
+    return true;
+}
 
-    pos = str.find_first_not_of(" \r\n\t", static_cast<string::size_type>(iter - str.begin()));
+} // anonymous namespace
 
-    if(pos == string::npos) {
-        return StringTokenizer::TT_EOF;
+/*public static*/
+bool
+StringTokenizer::readDouble(const char* first, const char* last, double& result)
+{
+    if (readDoubleFast(first, last, result)) {
+        return true;
+    }
+#if defined(__cpp_lib_to_chars)
+    const char* p = first;
+    if (p != last && *p == '+') {
+        ++p;
+    }
+    auto r = std::from_chars(p, last, result);
+    if (r.ptr == last && r.ec == std::errc()) {
+        return true;
     }
-    switch(str[pos]) {
+    if (r.ptr != last || r.ec != std::errc::result_out_of_range) {
+        return false;
+    }
+    // strtod returns infinity or zero for out of range values
+#endif
+    return readDoubleStrtod(first, last, result);
+}
+
+/*private*/
+int
+StringTokenizer::readToken(string::const_iterator start, string::const_iterator& end)
+{
+    switch(*start) {
     case '(':
     case ')':
     case ',':
-        return str[pos];
+        end = start + 1;
+        return *start;
     }
 
     // It's either a Number or a Word, let's see when it ends
-    pos = str.find_first_of("\n\r\t() ,", pos + 1);
+    string::size_type pos = str.find_first_of(DELIMITERS,
+                            static_cast<string::size_type>(start - str.begin()));
+    end = (pos == string::npos) ? str.end() : str.begin() + static_cast<string::difference_type>(pos);
 
-    if(pos == string::npos) {
-        if(iter != str.end()) {
-            tok.assign(iter, str.end());
-        }
-        else {
-            return StringTokenizer::TT_EOF;
-        }
+    const char* first = str.data() + (start - str.begin());
+    const char* last = str.data() + (end - str.begin());
+    if (readDouble(first, last, ntok)) {
+        stok.clear();
+        return StringTokenizer::TT_NUMBER;
     }
-    else {
-        tok.assign(iter, str.begin() + static_cast<string::difference_type>(pos)); //str.end());
+    ntok = 0.0;
+    stok.assign(start, end);
+    return StringTokenizer::TT_WORD;
+}
+
+/*private*/
+string::const_iterator
+StringTokenizer::skipWhitespace() const
+{
+    if (iter == str.end()) {
+        return iter;
     }
+    string::size_type pos = str.find_first_not_of(WHITESPACE,
+                            static_cast<string::size_type>(iter - str.begin()));
+    return (pos == string::npos) ? str.end() : str.begin() + static_cast<string::difference_type>(pos);
+}
 
-    char* stopstring;
-    double dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
-    if(*stopstring == '\0') {
-        ntok = dbl;
-        stok = "";
-        return StringTokenizer::TT_NUMBER;
+/*public*/
+int
+StringTokenizer::nextToken()
+{
+    iter = skipWhitespace();
+    if(iter == str.end()) {
+        return StringTokenizer::TT_EOF;
     }
-    else {
-        ntok = 0.0;
-        stok = tok;
-        return StringTokenizer::TT_WORD;
+    return readToken(iter, iter);
+}
+
+/*public*/
+int
+StringTokenizer::peekNextToken()
+{
+    string::const_iterator start = skipWhitespace();
+    if(start == str.end()) {
+        return StringTokenizer::TT_EOF;
     }
+    string::const_iterator end;
+    return readToken(start, end);
 }
 
 /*public*/
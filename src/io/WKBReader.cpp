@@ -39,6 +39,8 @@
 #include <geos/geom/PrecisionModel.h>
 #include <geos/util.h>
 
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <ostream>
 #include <sstream>
@@ -52,6 +54,64 @@ using namespace geos::geom;
 namespace geos {
 namespace io { // geos.io
 
+namespace {
+
+/*
+ * Decodes n points of WKB ordinates into the storage of a sequence
+ * with stride S. The storage may hold an unused Z ordinate, which
+ * is set to NaN.
+ */
+template<std::size_t S>
+void
+readOrdinates(const unsigned char* bytes, std::size_t n, std::size_t dim,
+              bool hasZ, bool hasM, int order, double* out)
+{
+    const bool swap = order != getMachineByteOrder();
+
+    // The input layout matches the sequence: copy it as is
+    if (S == dim && !swap) {
+        std::memcpy(out, bytes, n * S * sizeof(double));
+        return;
+    }
+
+    auto get = [swap](const unsigned char* p) {
+        std::uint64_t u;
+        std::memcpy(&u, p, sizeof(u));
+        if (swap) {
+            u = ((u & 0x00000000000000FFull) << 56) | ((u & 0x000000000000FF00ull) << 40) |
+                ((u & 0x0000000000FF0000ull) << 24) | ((u & 0x00000000FF000000ull) << 8) |
+                ((u & 0x000000FF00000000ull) >> 8) | ((u & 0x0000FF0000000000ull) >> 24) |
+                ((u & 0x00FF000000000000ull) >> 40) | ((u & 0xFF00000000000000ull) >> 56);
+        }
+        double d;
+        std::memcpy(&d, &u, sizeof(d));
+        return d;
+    };
+
+    const std::size_t mIndex = hasZ ? 3 : S - 1;
+    const bool padZ = !hasZ && S > 2 && !(hasM && S == 3);
+
+    for (std::size_t i = 0; i < n; i++) {
+        double* c = out + i * S;
+        c[0] = get(bytes);
+        c[1] = get(bytes + 8);
+        bytes += 16;
+        if (hasZ) {
+            c[2] = get(bytes);
+            bytes += 8;
+        }
+        else if (padZ) {
+            c[2] = DoubleNotANumber;
+        }
+        if (hasM) {
+            c[mIndex] = get(bytes);
+            bytes += 8;
+        }
+    }
+}
+
+}
+
 WKBReader::WKBReader(geom::GeometryFactory const& f)
     : factory(f)
     , inputDimension(2)
@@ -576,40 +636,26 @@ WKBReader::readCoordinateSequence(uint32_t size)
     minMemSize(GEOS_LINESTRING, size);
     auto seq = detail::make_unique<CoordinateSequence>(size, hasZ, hasM, false);
 
-    CoordinateXYZM coord(0, 0, DoubleNotANumber, DoubleNotANumber);
-    for(uint32_t i = 0; i < size; i++) {
-        readCoordinate();
-
-        unsigned int j = 0;
-        coord.x = ordValues[j++];
-        coord.y = ordValues[j++];
-        if (hasZ) {
-            coord.z = ordValues[j++];
-        }
-        if (hasM) {
-            coord.m = ordValues[j++];
-        }
-
-        seq->setAt(coord, i);
+    if (size > dis.size() / (inputDimension * sizeof(double))) {
+        throw ParseException("Unexpected EOF parsing WKB");
     }
-    return seq;
-}
+    const unsigned char* bytes = dis.readBytes(static_cast<std::size_t>(size) * inputDimension * sizeof(double));
 
-void
-WKBReader::readCoordinate()
-{
-    const PrecisionModel& pm = *factory.getPrecisionModel();
+    // Decode the ordinates in bulk, directly into the storage of the sequence
+    double* out = seq->data();
+    seq->withView([&](auto view) {
+        constexpr std::size_t S = std::decay_t<decltype(view)>::stride;
+        readOrdinates<S>(bytes, size, inputDimension, hasZ, hasM, dis.getOrder(), out);
+    });
 
-    for(std::size_t i = 0; i < inputDimension; ++i) {
-        if (i < 2) {
-            ordValues[i] = pm.makePrecise(dis.readDouble());
-        } else {
-            ordValues[i] = dis.readDouble();
+    const PrecisionModel& pm = *factory.getPrecisionModel();
+    if (pm.getType() != PrecisionModel::FLOATING) {
+        for (auto& c : seq->items<CoordinateXY>()) {
+            pm.makePrecise(c);
         }
     }
-#if DEBUG_WKB_READER
-    std::size_t << "WKB coordinate: " << ordValues[0] << "," << ordValues[1] << std::endl;
-#endif
+
+    return seq;
 }
 
 } // namespace geos.io
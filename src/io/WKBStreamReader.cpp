@@ -45,8 +45,7 @@ std::unique_ptr<Geometry>
 WKBStreamReader::next()
 {
     std::string line;
-    std::getline(instr, line);
-    if (! instr) {
+    if (! nextRecord(instr, line)) {
         return nullptr;
     }
     std::istringstream hex(line);
@@ -54,5 +53,13 @@ WKBStreamReader::next()
     return g;
 }
 
+/*public static*/
+bool
+WKBStreamReader::nextRecord(std::istream& p_instr, std::string& record)
+{
+    std::getline(p_instr, record);
+    return static_cast<bool>(p_instr);
+}
+
 }
 }
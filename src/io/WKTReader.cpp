@@ -39,6 +39,7 @@
 #include <geos/util.h>
 #include <geos/util/string.h>
 
+#include <charconv>
 #include <sstream>
 #include <string>
 #include <cassert>
@@ -52,7 +53,10 @@ namespace io { // geos.io
 std::unique_ptr<Geometry>
 WKTReader::read(const std::string& wellKnownText) const
 {
+#if !defined(__cpp_lib_to_chars)
+    // Numbers are parsed with strtod, which depends on the locale
     CLocalizer clocale;
+#endif
     StringTokenizer tokenizer(wellKnownText);
     OrdinateSet ordinateFlags = OrdinateSet::createXY();
     auto ret = readGeometryTaggedText(&tokenizer, ordinateFlags);
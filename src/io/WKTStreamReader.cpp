@@ -45,15 +45,28 @@ Return: nullptr if at EOF
 std::unique_ptr<Geometry>
 WKTStreamReader::next()
 {
-    std::string wkt = "";
+    std::string wkt;
+    if (! nextRecord(instr, wkt)) {
+        return nullptr;
+    }
+
+    auto g = rdr.read( wkt.c_str() );
+    return g;
+}
+
+/*public static*/
+bool
+WKTStreamReader::nextRecord(std::istream& p_instr, std::string& wkt)
+{
+    wkt.clear();
 
     std::string::difference_type lParen = 0;
     std::string::difference_type rParen = 0;
     do {
         std::string line;
-        std::getline(instr, line);
-        if (! instr) {
-            return nullptr;
+        std::getline(p_instr, line);
+        if (! p_instr) {
+            return false;
         }
 
         lParen += std::count(line.begin(), line.end(), '(');
@@ -62,8 +75,7 @@ WKTStreamReader::next()
         wkt += line;
     } while (lParen == 0 || lParen != rParen);
 
-    auto g = rdr.read( wkt.c_str() );
-    return g;
+    return true;
 }
 
 
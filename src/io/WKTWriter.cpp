@@ -401,18 +401,18 @@ WKTWriter::appendCoordinate(const CoordinateXYZM& coordinate,
                             OrdinateSet outputOrdinates,
                             Writer& writer) const
 {
-    writer.write(writeNumber(coordinate.x));
+    appendNumber(coordinate.x, writer);
     writer.write(" ");
-    writer.write(writeNumber(coordinate.y));
+    appendNumber(coordinate.y, writer);
 
     if(outputOrdinates.hasZ()) {
         writer.write(" ");
-        writer.write(writeNumber(coordinate.z));
+        appendNumber(coordinate.z, writer);
     }
 
     if(outputOrdinates.hasM()) {
         writer.write(" ");
-        writer.write(writeNumber(coordinate.m));
+        appendNumber(coordinate.m, writer);
     }
 }
 
@@ -503,6 +503,20 @@ WKTWriter::writeNumber(double d) const
     return writeNumber(d, trim, precision);
 }
 
+/* protected */
+void
+WKTWriter::appendNumber(double d, Writer& writer) const
+{
+    if (!trim) {
+        writer.write(writeNumber(d));
+        return;
+    }
+    uint32_t precision = decimalPlaces >= 0 ? static_cast<std::uint32_t>(decimalPlaces) : 0;
+    char buf[28];
+    int len = writeTrimmedNumber(d, precision, buf);
+    writer.write(buf, static_cast<std::size_t>(len));
+}
+
 void
 WKTWriter::appendSurfaceText(const Surface& polygon, OrdinateSet outputOrdinates, int level,
                              bool indentFirst, Writer& writer) const
@@ -39,8 +39,7 @@ namespace noding { // geos::noding
  */
 FastSegmentSetIntersectionFinder::
 FastSegmentSetIntersectionFinder(noding::SegmentString::ConstVect* baseSegStrings)
-    :	segSetMutInt(new MCIndexSegmentSetMutualIntersector()),
-      lineIntersector(new algorithm::LineIntersector())
+    :	segSetMutInt(new MCIndexSegmentSetMutualIntersector())
 {
     segSetMutInt->setBaseSegments(baseSegStrings);
 }
@@ -49,7 +48,8 @@ bool
 FastSegmentSetIntersectionFinder::
 intersects(noding::SegmentString::ConstVect* segStrings)
 {
-    SegmentIntersectionDetector intFinder(lineIntersector.get());
+    algorithm::LineIntersector li;
+    SegmentIntersectionDetector intFinder(&li);
 
     return this->intersects(segStrings, &intFinder);
 }
@@ -59,8 +59,7 @@ FastSegmentSetIntersectionFinder::
 intersects(noding::SegmentString::ConstVect* segStrings,
            SegmentIntersectionDetector* intDetector)
 {
-    segSetMutInt->setSegmentIntersector(intDetector);
-    segSetMutInt->process(segStrings);
+    segSetMutInt->process(segStrings, *intDetector);
 
     return intDetector->hasIntersection();
 }
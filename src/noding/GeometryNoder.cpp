@@ -90,7 +90,8 @@ GeometryNoder::node(const geom::Geometry& geom)
 /* public */
 GeometryNoder::GeometryNoder(const geom::Geometry& g)
     :
-    argGeom(g)
+    argGeom(g),
+    numThreads(1)
 {
     util::ensureNoCurvedComponents(argGeom);
 }
@@ -173,6 +174,7 @@ GeometryNoder::getNoder()
     if(! noder.get()) {
         const geom::PrecisionModel* pm = argGeom.getFactory()->getPrecisionModel();
         IteratedNoder* in = new IteratedNoder(pm);
+        in->setNumThreads(numThreads);
         noder.reset(in);
     }
     return *noder;
@@ -28,6 +28,36 @@ using namespace geos::geom;
 namespace geos {
 namespace noding { // geos.noding
 
+/*private*/
+IntersectionAdder::IntersectionAdder(std::unique_ptr<algorithm::LineIntersector> p_li)
+    :
+    hasIntersectionVar(false),
+    hasProper(false),
+    hasProperInterior(false),
+    hasInterior(false),
+    properIntersectionPoint(),
+    localLi(std::move(p_li)),
+    li(*localLi),
+    isLocal(true),
+    numIntersections(0),
+    numInteriorIntersections(0),
+    numProperIntersections(0),
+    numTests(0)
+{}
+
+/*private*/
+void
+IntersectionAdder::addIntersections(NodedSegmentString* segStr, std::size_t segIndex)
+{
+    if (!isLocal) {
+        segStr->addIntersections(&li, segIndex, 0);
+        return;
+    }
+    for (std::size_t i = 0, n = li.getIntersectionNum(); i < n; ++i) {
+        localNodes.push_back(LocalNode{ segStr, li.getIntersection(i), segIndex });
+    }
+}
+
 /*private*/
 bool
 IntersectionAdder::isTrivialIntersection(const SegmentString* e0,
@@ -96,10 +126,8 @@ IntersectionAdder::processIntersections(
     if(! isTrivialIntersection(e0, segIndex0, e1, segIndex1)) {
         hasIntersectionVar = true;
 
-        NodedSegmentString* ee0 = detail::down_cast<NodedSegmentString*>(e0);
-        NodedSegmentString* ee1 = detail::down_cast<NodedSegmentString*>(e1);
-        ee0->addIntersections(&li, segIndex0, 0);
-        ee1->addIntersections(&li, segIndex1, 1);
+        addIntersections(detail::down_cast<NodedSegmentString*>(e0), segIndex0);
+        addIntersections(detail::down_cast<NodedSegmentString*>(e1), segIndex1);
 
         if(li.isProper()) {
             numProperIntersections++;
@@ -112,5 +140,37 @@ IntersectionAdder::processIntersections(
     }
 }
 
+/*public*/
+std::unique_ptr<SegmentIntersector>
+IntersectionAdder::createLocal() const
+{
+    std::unique_ptr<algorithm::LineIntersector> p_li(new algorithm::LineIntersector(li));
+    return std::unique_ptr<SegmentIntersector>(new IntersectionAdder(std::move(p_li)));
+}
+
+/*public*/
+void
+IntersectionAdder::mergeLocal(SegmentIntersector& local)
+{
+    IntersectionAdder& other = *detail::down_cast<IntersectionAdder*>(&local);
+
+    for (const LocalNode& node : other.localNodes) {
+        node.segStr->addIntersection(node.pt, node.segIndex);
+    }
+    other.localNodes.clear();
+
+    hasIntersectionVar |= other.hasIntersectionVar;
+    hasInterior |= other.hasInterior;
+    if (other.hasProper) {
+        hasProper = true;
+        hasProperInterior = true;
+        properIntersectionPoint = other.properIntersectionPoint;
+    }
+    numIntersections += other.numIntersections;
+    numInteriorIntersections += other.numInteriorIntersections;
+    numProperIntersections += other.numProperIntersections;
+    numTests += other.numTests;
+}
+
 } // namespace geos.noding
 } // namespace geos
@@ -45,6 +45,7 @@ IteratedNoder::node(std::vector<SegmentString*>* segStrings,
     IntersectionAdder si(li);
     MCIndexNoder noder;
     noder.setSegmentIntersector(&si);
+    noder.setNumThreads(numThreads);
     noder.computeNodes(segStrings);
     nodedSegStrings = noder.getNodedSubstrings();
     numInteriorIntersections = si.numInteriorIntersections;
@@ -23,10 +23,13 @@
 #include <geos/index/chain/MonotoneChainBuilder.h>
 #include <geos/geom/Envelope.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/ThreadPool.h>
 
 #include <cassert>
 #include <functional>
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 #ifndef GEOS_DEBUG
 #define GEOS_DEBUG 0
@@ -38,6 +41,13 @@ using geos::index::chain::MonotoneChainBuilder;
 namespace geos {
 namespace noding { // geos.noding
 
+namespace {
+
+/// Minimum number of chains for the overlap search to be distributed over threads
+constexpr std::size_t PARALLEL_MIN_CHAINS = 1000;
+
+}
+
 /*public*/
 void
 MCIndexNoder::computeNodes(SegmentString::NonConstVect* inputSegStrings)
@@ -66,6 +76,10 @@ MCIndexNoder::intersectChains()
 {
     assert(segInt);
 
+    if (numThreads != 1 && intersectChainsParallel()) {
+        return;
+    }
+
     SegmentOverlapAction overlapAction(*segInt);
 
     index.queryPairs([this, &overlapAction](const MonotoneChain* queryChain, const MonotoneChain* testChain) {
@@ -77,6 +91,62 @@ MCIndexNoder::intersectChains()
     });
 }
 
+/*private*/
+bool
+MCIndexNoder::intersectChainsParallel()
+{
+    if (monoChains.size() < PARALLEL_MIN_CHAINS) {
+        return false;
+    }
+
+    std::vector<std::unique_ptr<SegmentIntersector>> locals;
+    locals.push_back(segInt->createLocal());
+    if (!locals.back()) {
+        return false;
+    }
+
+    util::ThreadPool pool(numThreads);
+    if (pool.getNumThreads() == 1) {
+        return false;
+    }
+
+    // A few ranges of chains per thread evens out the load,
+    // since the number of overlaps of a chain varies widely.
+    std::size_t numChains = monoChains.size();
+    std::size_t numRanges = std::min(numChains, pool.getNumThreads() * 4);
+    while (locals.size() < numRanges) {
+        locals.push_back(segInt->createLocal());
+    }
+
+    // Build the index before querying it from several threads
+    index.build();
+
+    std::vector<int> rangeOverlaps(numRanges, 0);
+    pool.parallelFor(numRanges, [this, numChains, numRanges, &locals, &rangeOverlaps](std::size_t r) {
+        SegmentIntersector& localSegInt = *locals[r];
+        SegmentOverlapAction overlapAction(localSegInt);
+        int& overlaps = rangeOverlaps[r];
+
+        index.queryPairs(numChains * r / numRanges, numChains * (r + 1) / numRanges,
+                         [this, &overlapAction, &localSegInt, &overlaps](const MonotoneChain* queryChain, const MonotoneChain* testChain) {
+            queryChain->computeOverlaps(testChain, overlapTolerance, &overlapAction);
+            overlaps++;
+            if ( overlaps % 100000 == 0 ) GEOS_CHECK_FOR_INTERRUPTS();
+
+            return !localSegInt.isDone();
+        });
+    });
+
+    // Merge in the order of the ranges, which is the order
+    // in which a single thread processes the overlaps
+    for (std::size_t r = 0; r < numRanges; r++) {
+        segInt->mergeLocal(*locals[r]);
+        nOverlaps += rangeOverlaps[r];
+    }
+
+    return true;
+}
+
 /*private*/
 void
 MCIndexNoder::add(SegmentString* segStr)
@@ -25,6 +25,7 @@
 
 // std
 #include <cstddef>
+#include <mutex>
 
 using namespace geos::index::chain;
 
@@ -44,7 +45,7 @@ MCIndexSegmentSetMutualIntersector::addToIndex(SegmentString* segStr)
 
 /*private*/
 void
-MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr)
+MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr, MonoChains& chains) const
 {
     if (segStr->size() == 0)
         return;
@@ -53,7 +54,7 @@ MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr)
                                     segStr, segChains);
     for (auto& mc : segChains) {
         if (envelope == nullptr || envelope->intersects(mc.getEnvelope())) {
-            monoChains.push_back(mc);
+            chains.push_back(mc);
         }
     }
 }
@@ -61,16 +62,16 @@ MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr)
 
 /*private*/
 void
-MCIndexSegmentSetMutualIntersector::intersectChains()
+MCIndexSegmentSetMutualIntersector::intersectChains(MonoChains& chains, SegmentIntersector& si, int& overlaps)
 {
-    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(*segInt);
+    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(si);
 
-    for(auto& queryChain : monoChains) {
-        index.query(queryChain.getEnvelope(overlapTolerance), [&queryChain, &overlapAction, this](const MonotoneChain* testChain) -> bool {
+    for(auto& queryChain : chains) {
+        index.query(queryChain.getEnvelope(overlapTolerance), [&queryChain, &overlapAction, &si, &overlaps, this](const MonotoneChain* testChain) -> bool {
             queryChain.computeOverlaps(testChain, overlapTolerance, &overlapAction);
-            nOverlaps++;
+            overlaps++;
 
-            return !segInt->isDone(); // abort early if segInt->isDone()
+            return !si.isDone(); // abort early if si.isDone()
         });
     }
 }
@@ -90,18 +91,25 @@ MCIndexSegmentSetMutualIntersector::setBaseSegments(SegmentString::ConstVect* se
     }
 }
 
-/*public*/
+/*private*/
 void
-MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings)
+MCIndexSegmentSetMutualIntersector::buildIndex()
 {
-    if (!indexBuilt) {
+    std::call_once(indexBuilt, [this]() {
         for (auto& mc: indexChains) {
             if (envelope == nullptr || envelope->intersects(mc.getEnvelope())) {
                 index.insert(&(mc.getEnvelope(overlapTolerance)), &mc);
             }
         }
-        indexBuilt = true;
-    }
+        index.build();
+    });
+}
+
+/*public*/
+void
+MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings)
+{
+    buildIndex();
 
     // Reset counters for new inputs
     monoChains.clear();
@@ -110,9 +118,25 @@ MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings
 
     for(const SegmentString* css: *segStrings) {
         SegmentString* ss = const_cast<SegmentString*>(css);
-        addToMonoChains(ss);
+        addToMonoChains(ss, monoChains);
     }
-    intersectChains();
+    intersectChains(monoChains, *segInt, nOverlaps);
+}
+
+/*public*/
+void
+MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings, SegmentIntersector& p_segInt)
+{
+    buildIndex();
+
+    MonoChains chains;
+    for(const SegmentString* css: *segStrings) {
+        SegmentString* ss = const_cast<SegmentString*>(css);
+        addToMonoChains(ss, chains);
+    }
+
+    int overlaps = 0;
+    intersectChains(chains, p_segInt, overlaps);
 }
 
 
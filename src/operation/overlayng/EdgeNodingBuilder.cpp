@@ -73,6 +73,7 @@ EdgeNodingBuilder::createFloatingPrecisionNoder(bool doValidation)
 {
     std::unique_ptr<MCIndexNoder> mcNoder(new MCIndexNoder());
     mcNoder->setSegmentIntersector(&intAdder);
+    mcNoder->setNumThreads(numThreads);
 
     if (doValidation) {
         spareInternalNoder = std::move(mcNoder);
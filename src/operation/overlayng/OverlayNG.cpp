@@ -36,6 +36,7 @@
 #include <geos/geom/Location.h>
 #include <geos/geom/Geometry.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/PhaseProfiler.h>
 #include <geos/util/TopologyException.h>
 
 #include <algorithm>
@@ -211,6 +212,7 @@ OverlayNG::computeEdgeOverlay()
      * Formerly in nodeEdges())
      */
     EdgeNodingBuilder nodingBuilder(pm, noder);
+    nodingBuilder.setNumThreads(numThreads);
     // clipEnv not always used, but needs to remain in scope
     // as long as nodingBuilder when it is.
     Envelope clipEnv;
@@ -224,9 +226,13 @@ OverlayNG::computeEdgeOverlay()
         }
     }
 
-    std::vector<Edge*> edges = nodingBuilder.build(
-        inputGeom.getGeometry(0),
-        inputGeom.getGeometry(1));
+    std::vector<Edge*> edges;
+    {
+        util::PhaseProfiler::Timer timer(util::PhaseProfiler::OVERLAY_NODING);
+        edges = nodingBuilder.build(
+            inputGeom.getGeometry(0),
+            inputGeom.getGeometry(1));
+    }
 
     GEOS_CHECK_FOR_INTERRUPTS();
 
@@ -246,10 +252,13 @@ OverlayNG::computeEdgeOverlay()
     // Sort the edges first, for comparison with JTS results
     // std::sort(edges.begin(), edges.end(), EdgeComparator);
     OverlayGraph graph;
-    for (Edge* e : edges) {
-        // Write out edge coordinates
-        // std::cout << *e->getCoordinatesRO() << std::endl;
-        graph.addEdge(e);
+    {
+        util::PhaseProfiler::Timer timer(util::PhaseProfiler::OVERLAY_GRAPH);
+        for (Edge* e : edges) {
+            // Write out edge coordinates
+            // std::cout << *e->getCoordinatesRO() << std::endl;
+            graph.addEdge(e);
+        }
     }
 
     if (isOutputNodedEdges) {
@@ -288,6 +297,7 @@ OverlayNG::computeEdgeOverlay()
 void
 OverlayNG::labelGraph(OverlayGraph* graph)
 {
+    util::PhaseProfiler::Timer timer(util::PhaseProfiler::OVERLAY_LABELLING);
     OverlayLabeller labeller(graph, &inputGeom);
     labeller.computeLabelling();
     labeller.markResultAreaEdges(opCode);
@@ -304,6 +314,8 @@ OverlayNG::extractResult(int p_opCode, OverlayGraph* graph)
     std::cerr << "OverlayNG::extractResult: graph: " << *graph << std::endl;
 #endif
 
+    util::PhaseProfiler::Timer timer(util::PhaseProfiler::OVERLAY_RESULT);
+
     bool isAllowMixedIntResult = ! isStrictMode;
 
     //--- Build polygons
@@ -26,6 +26,7 @@
 #include <geos/noding/snap/SnappingNoder.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/PrecisionModel.h>
+#include <geos/util/PhaseProfiler.h>
 #include <geos/util/TopologyException.h>
 
 #include <stdexcept>
@@ -79,6 +80,17 @@ OverlayNGRobust::Union(const Geometry* a)
     return op.Union();
 }
 
+/*public static*/
+std::unique_ptr<Geometry>
+OverlayNGRobust::Union(const Geometry* a, std::size_t numThreads)
+{
+    geounion::UnaryUnionOp op(*a);
+    SRUnionStrategy unionSRFun;
+    op.setUnionFunction(&unionSRFun);
+    op.setNumThreads(numThreads);
+    return op.Union();
+}
+
 /*public static*/
 std::unique_ptr<Geometry>
 OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCode)
@@ -137,14 +149,20 @@ OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCod
      * if this throws an exception just let it go,
      * since it is something that is not a TopologyException
      */
-    result = overlaySnapTries(geom0, geom1, opCode);
+    {
+        geos::util::PhaseProfiler::Timer timer(geos::util::PhaseProfiler::OVERLAY_SNAPPING);
+        result = overlaySnapTries(geom0, geom1, opCode);
+    }
     if (result != nullptr)
         return result;
 
     /**
      * On failure retry using snap-rounding with a heuristic scale factor (grid size).
      */
-    result = overlaySR(geom0, geom1, opCode);
+    {
+        geos::util::PhaseProfiler::Timer timer(geos::util::PhaseProfiler::OVERLAY_SNAPROUNDING);
+        result = overlaySR(geom0, geom1, opCode);
+    }
     if (result != nullptr)
         return result;
 
@@ -0,0 +1,292 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/overlayng/TiledOverlayNG.h>
+
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+#include <geos/operation/overlayng/RingClipper.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/ThreadPool.h>
+
+#include <algorithm>
+#include <cmath>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::LinearRing;
+using geos::geom::Polygon;
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+/* public */
+TiledOverlayNG::TiledOverlayNG(const Geometry* p_geom0, const Geometry* p_geom1, int p_opCode)
+    : geom0(p_geom0)
+    , geom1(p_geom1)
+    , opCode(p_opCode)
+    , geomFact(p_geom0->getFactory())
+    , numCellsX(0)
+    , numCellsY(0)
+    , numThreads(1)
+{}
+
+/* public static */
+std::unique_ptr<Geometry>
+TiledOverlayNG::overlay(const Geometry* geom0, const Geometry* geom1, int opCode, std::size_t numThreads)
+{
+    TiledOverlayNG ov(geom0, geom1, opCode);
+    ov.setNumThreads(numThreads);
+    return ov.getResult();
+}
+
+/* private */
+bool
+TiledOverlayNG::isTileable() const
+{
+    for (const Geometry* g : { geom0, geom1 }) {
+        // Clipping does not preserve Z or M, nor curves
+        if (g->isEmpty() || !g->isPolygonal() ||
+                g->hasZ() || g->hasM() || g->hasCurvedComponents()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* private */
+void
+TiledOverlayNG::computeGridSize(const Envelope& extent)
+{
+    if (numCellsX > 0 && numCellsY > 0) {
+        return;
+    }
+
+    std::size_t numPts = geom0->getNumPoints() + geom1->getNumPoints();
+    double numCells = static_cast<double>(numPts) / static_cast<double>(TARGET_VERTICES_PER_CELL);
+
+    // Cells are made roughly square
+    double aspect = extent.getHeight() > 0 ? extent.getWidth() / extent.getHeight() : 1.0;
+    double nx = std::sqrt(numCells * aspect);
+    double ny = aspect > 0 ? nx / aspect : nx;
+
+    auto clamp = [](double n) {
+        return static_cast<std::size_t>(std::min(std::max(std::ceil(n), 1.0),
+                                                 static_cast<double>(MAX_CELLS_PER_AXIS)));
+    };
+    numCellsX = clamp(nx);
+    numCellsY = clamp(ny);
+}
+
+/* private static */
+double
+TiledOverlayNG::gridLine(double min, double max, std::size_t i, std::size_t n)
+{
+    // Neighbouring cells compute their shared side identically
+    if (i == n) {
+        return max;
+    }
+    return min + (max - min) * static_cast<double>(i) / static_cast<double>(n);
+}
+
+/* private static */
+void
+TiledOverlayNG::indexPolygons(const Geometry* geom, PolygonIndex& index)
+{
+    // The index is built once per input, before the per-cell tasks
+    // share it; build() must not run concurrently with queries.
+    // Empty polygons have a null envelope and are not indexed.
+    for (std::size_t i = 0; i < geom->getNumGeometries(); i++) {
+        index.insert(static_cast<const Polygon*>(geom->getGeometryN(i)));
+    }
+    index.build();
+}
+
+/* private */
+std::unique_ptr<Polygon>
+TiledOverlayNG::clip(const Polygon& poly, const Envelope& cell) const
+{
+    RingClipper clipper(&cell);
+
+    auto clipRing = [&clipper, &cell, this](const LinearRing* ring) -> std::unique_ptr<LinearRing> {
+        const Envelope* env = ring->getEnvelopeInternal();
+        if (!cell.intersects(env)) {
+            return nullptr;
+        }
+        if (cell.covers(env)) {
+            return geomFact->createLinearRing(*ring->getCoordinatesRO());
+        }
+        auto pts = clipper.clip(ring->getCoordinatesRO());
+        if (pts->size() < 4) {
+            return nullptr;
+        }
+        return geomFact->createLinearRing(std::move(pts));
+    };
+
+    auto shell = clipRing(poly.getExteriorRing());
+    if (shell == nullptr) {
+        return nullptr;
+    }
+
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    for (std::size_t i = 0; i < poly.getNumInteriorRing(); i++) {
+        auto hole = clipRing(poly.getInteriorRingN(i));
+        if (hole != nullptr) {
+            holes.push_back(std::move(hole));
+        }
+    }
+    return geomFact->createPolygon(std::move(shell), std::move(holes));
+}
+
+/* private */
+std::unique_ptr<Geometry>
+TiledOverlayNG::clip(PolygonIndex& index, const Envelope& cell) const
+{
+    std::vector<std::unique_ptr<Polygon>> clipped;
+    index.query(cell, [&clipped, &cell, this](const Polygon* p) {
+        auto poly = clip(*p, cell);
+        if (poly != nullptr) {
+            clipped.push_back(std::move(poly));
+        }
+    });
+    return geomFact->createMultiPolygon(std::move(clipped));
+}
+
+/* private */
+std::unique_ptr<Geometry>
+TiledOverlayNG::toPolygonal(std::vector<std::unique_ptr<Geometry>>& parts) const
+{
+    if (parts.empty()) {
+        return geomFact->createPolygon();
+    }
+    if (parts.size() == 1) {
+        return std::move(parts[0]);
+    }
+    return geomFact->createMultiPolygon(std::move(parts));
+}
+
+/* private */
+std::unique_ptr<Geometry>
+TiledOverlayNG::overlayPolygonal(const Geometry* g0, const Geometry* g1) const
+{
+    // Drops the lines and points of the result, as strict mode does
+    auto result = OverlayNGRobust::Overlay(g0, g1, opCode);
+    std::vector<std::unique_ptr<Geometry>> parts;
+    for (std::size_t i = 0; i < result->getNumGeometries(); i++) {
+        const Geometry* part = result->getGeometryN(i);
+        if (part->getGeometryTypeId() == geom::GEOS_POLYGON && !part->isEmpty()) {
+            parts.push_back(part->clone());
+        }
+    }
+    return toPolygonal(parts);
+}
+
+/* public */
+std::unique_ptr<Geometry>
+TiledOverlayNG::getResult()
+{
+    if (!isTileable()) {
+        if (geom0->isPolygonal() && geom1->isPolygonal()) {
+            return overlayPolygonal(geom0, geom1);
+        }
+        return OverlayNGRobust::Overlay(geom0, geom1, opCode);
+    }
+
+    Envelope extent(*geom0->getEnvelopeInternal());
+    extent.expandToInclude(geom1->getEnvelopeInternal());
+    computeGridSize(extent);
+
+    std::size_t numCells = numCellsX * numCellsY;
+    if (numCells <= 1) {
+        return overlayPolygonal(geom0, geom1);
+    }
+
+    PolygonIndex index0;
+    PolygonIndex index1;
+    indexPolygons(geom0, index0);
+    indexPolygons(geom1, index1);
+
+    // Polygons in the interior of their cell, and polygons
+    // touching a side shared with another cell
+    std::vector<std::vector<std::unique_ptr<Geometry>>> interior(numCells);
+    std::vector<std::vector<std::unique_ptr<Geometry>>> border(numCells);
+
+    util::ThreadPool pool(numThreads);
+    pool.parallelFor(numCells, [&](std::size_t i) {
+        std::size_t ix = i % numCellsX;
+        std::size_t iy = i / numCellsX;
+        double minX = gridLine(extent.getMinX(), extent.getMaxX(), ix, numCellsX);
+        double maxX = gridLine(extent.getMinX(), extent.getMaxX(), ix + 1, numCellsX);
+        double minY = gridLine(extent.getMinY(), extent.getMaxY(), iy, numCellsY);
+        double maxY = gridLine(extent.getMinY(), extent.getMaxY(), iy + 1, numCellsY);
+        Envelope cell(minX, maxX, minY, maxY);
+
+        auto clip0 = clip(index0, cell);
+        auto clip1 = clip(index1, cell);
+        if (clip0->isEmpty() && clip1->isEmpty()) {
+            return;
+        }
+        auto result = OverlayNGRobust::Overlay(clip0.get(), clip1.get(), opCode);
+
+        for (std::size_t j = 0; j < result->getNumGeometries(); j++) {
+            const Geometry* part = result->getGeometryN(j);
+            if (part->getGeometryTypeId() != geom::GEOS_POLYGON || part->isEmpty()) {
+                continue;
+            }
+            const Envelope* env = part->getEnvelopeInternal();
+            bool isBorder = (ix > 0 && env->getMinX() <= minX) ||
+                            (ix + 1 < numCellsX && env->getMaxX() >= maxX) ||
+                            (iy > 0 && env->getMinY() <= minY) ||
+                            (iy + 1 < numCellsY && env->getMaxY() >= maxY);
+            (isBorder ? border : interior)[i].push_back(part->clone());
+        }
+    });
+
+    std::vector<std::unique_ptr<Geometry>> parts;
+    std::vector<std::unique_ptr<Geometry>> borderParts;
+    for (std::size_t i = 0; i < numCells; i++) {
+        for (auto& g : interior[i]) {
+            parts.push_back(std::move(g));
+        }
+        for (auto& g : border[i]) {
+            borderParts.push_back(std::move(g));
+        }
+    }
+
+    // Stitch the polygons split by cell sides
+    if (!borderParts.empty()) {
+        auto borderColl = geomFact->createMultiPolygon(std::move(borderParts));
+        auto stitched = OverlayNGRobust::Union(borderColl.get(), numThreads);
+        for (std::size_t i = 0; i < stitched->getNumGeometries(); i++) {
+            const Geometry* g = stitched->getGeometryN(i);
+            if (g->getGeometryTypeId() == geom::GEOS_POLYGON && !g->isEmpty()) {
+                parts.push_back(g->clone());
+            }
+        }
+    }
+
+    return toPolygonal(parts);
+}
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
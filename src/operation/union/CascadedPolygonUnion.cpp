@@ -28,6 +28,8 @@
 #include <geos/operation/union/CascadedPolygonUnion.h>
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/valid/IsSimpleOp.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/ThreadPool.h>
 #include <geos/util/TopologyException.h>
 
 // std
@@ -51,9 +53,11 @@ CascadedPolygonUnion::Union(std::vector<geom::Polygon*>* polys)
 }
 
 std::unique_ptr<geom::Geometry>
-CascadedPolygonUnion::Union(std::vector<geom::Polygon*>* polys, UnionStrategy* unionFun)
+CascadedPolygonUnion::Union(std::vector<geom::Polygon*>* polys, UnionStrategy* unionFun,
+                            std::size_t numThreads)
 {
     CascadedPolygonUnion op(polys, unionFun);
+    op.setNumThreads(numThreads);
     return op.Union();
 }
 
@@ -94,6 +98,11 @@ CascadedPolygonUnion::Union()
     // TODO avoid creating this vector and run binaryUnion off the iterators directly
     std::vector<const geom::Geometry*> geoms(index.items().begin(), index.items().end());
 
+    if(numThreads != 1 && geoms.size() > PARALLEL_MIN_SECTION_SIZE) {
+        util::ThreadPool pool(numThreads);
+        return parallelBinaryUnion(pool, geoms, 0, geoms.size());
+    }
+
     return binaryUnion(geoms, 0, geoms.size());
 }
 
@@ -120,6 +129,36 @@ CascadedPolygonUnion::binaryUnion(const std::vector<const geom::Geometry*> & geo
     }
 }
 
+std::unique_ptr<geom::Geometry>
+CascadedPolygonUnion::parallelBinaryUnion(util::ThreadPool& pool,
+        const std::vector<const geom::Geometry*> & geoms,
+        std::size_t start, std::size_t end)
+{
+    if(end - start <= PARALLEL_MIN_SECTION_SIZE) {
+        return binaryUnion(geoms, start, end);
+    }
+
+    // Split exactly as binaryUnion does, so that the
+    // result does not depend on the number of threads.
+    std::size_t mid = (end + start) / 2;
+    std::unique_ptr<geom::Geometry> g0;
+    std::unique_ptr<geom::Geometry> g1;
+    {
+        // The first half may be stolen by another thread
+        // while this one computes the second half.
+        util::TaskGroup group(pool);
+        group.run([&]() {
+            GEOS_CHECK_FOR_INTERRUPTS();
+            g0 = parallelBinaryUnion(pool, geoms, start, mid);
+        });
+        GEOS_CHECK_FOR_INTERRUPTS();
+        g1 = parallelBinaryUnion(pool, geoms, mid, end);
+        group.wait();
+    }
+
+    return unionSafe(std::move(g0), std::move(g1));
+}
+
 std::unique_ptr<geom::Geometry>
 CascadedPolygonUnion::unionSafe(const geom::Geometry* g0, const geom::Geometry* g1) const
 {
@@ -19,6 +19,8 @@
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <numeric>
 
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Coordinate.h>
@@ -28,6 +30,7 @@
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/operation/valid/RepeatedPointTester.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
 #include <geos/util.h>
 
 namespace geos {
@@ -69,6 +72,91 @@ DelaunayTriangulationBuilder::toVertices(
     return vertexList;
 }
 
+namespace {
+
+// Maximum size of the first round of the BRIO
+constexpr std::size_t BRIO_MIN_ROUND_SIZE = 64;
+
+// Level of the Hilbert curve ordering each round
+constexpr uint32_t BRIO_HILBERT_LEVEL = 16;
+
+// A small PRNG (SplitMix64), used instead of the standard library
+// engines and distributions so that the insertion order, and hence
+// the triangulation of cocircular points, is the same on all platforms.
+class SplitMix64 {
+public:
+    explicit SplitMix64(uint64_t seed) : state(seed) {}
+
+    uint64_t next()
+    {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    uint64_t state;
+};
+
+}
+
+void
+DelaunayTriangulationBuilder::sortForInsertion(IncrementalDelaunayTriangulator::VertexList& vertices)
+{
+    std::size_t n = vertices.size();
+    // Small inputs are inserted in lexicographic order, as by earlier
+    // versions, so that their triangulation is unchanged when it is
+    // not unique (e.g. for cocircular or snapped points)
+    if (n <= BRIO_MIN_ROUND_SIZE) {
+        std::sort(vertices.begin(), vertices.end());
+        return;
+    }
+
+    Envelope extent;
+    for (const auto& v : vertices) {
+        extent.expandToInclude(v.getCoordinate());
+    }
+    shape::fractal::HilbertEncoder encoder(BRIO_HILBERT_LEVEL, extent);
+
+    std::vector<uint32_t> codes(n);
+    for (std::size_t i = 0; i < n; i++) {
+        Envelope env(vertices[i].getCoordinate());
+        codes[i] = encoder.encode(&env);
+    }
+
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+
+    SplitMix64 random(n);
+    for (std::size_t i = n - 1; i > 0; i--) {
+        auto j = static_cast<std::size_t>(random.next() % (i + 1));
+        std::swap(order[i], order[j]);
+    }
+
+    // Each round holds half of the vertices not inserted by the
+    // previous rounds: the last round is order[n/2, n), the one before
+    // it order[n/4, n/2), and so on.
+    auto byCode = [&codes](std::size_t a, std::size_t b) {
+        return codes[a] < codes[b];
+    };
+    std::size_t end = n;
+    while (end > BRIO_MIN_ROUND_SIZE) {
+        std::size_t start = end / 2;
+        std::sort(order.begin() + static_cast<std::ptrdiff_t>(start),
+                  order.begin() + static_cast<std::ptrdiff_t>(end), byCode);
+        end = start;
+    }
+    std::sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(end), byCode);
+
+    IncrementalDelaunayTriangulator::VertexList sorted;
+    sorted.reserve(n);
+    for (std::size_t i : order) {
+        sorted.push_back(vertices[i]);
+    }
+    vertices.swap(sorted);
+}
+
 DelaunayTriangulationBuilder::DelaunayTriangulationBuilder() :
     siteCoords(nullptr), tolerance(0.0), subdiv(nullptr)
 {
@@ -104,8 +192,7 @@ DelaunayTriangulationBuilder::create()
 
     Envelope siteEnv = siteCoords->getEnvelope();
     auto vertices = toVertices(*siteCoords);
-    std::sort(vertices.begin(),
-              vertices.end()); // Best performance from locator when inserting points near each other
+    sortForInsertion(vertices); // Best performance from locator when inserting points near each other
 
     subdiv.reset(new quadedge::QuadEdgeSubdivision(siteEnv, tolerance));
     IncrementalDelaunayTriangulator triangulator = IncrementalDelaunayTriangulator(subdiv.get());
@@ -143,6 +230,17 @@ DelaunayTriangulationBuilder::getTriangles(
     return subdiv->getTriangles(geomFact);
 }
 
+std::unique_ptr<TriangleMesh>
+DelaunayTriangulationBuilder::getTriangleMesh()
+{
+    create();
+    auto mesh = detail::make_unique<TriangleMesh>(siteCoords && siteCoords->hasZ());
+    if (subdiv) {
+        subdiv->getTriangleMesh(*mesh);
+    }
+    return mesh;
+}
+
 geom::Envelope
 DelaunayTriangulationBuilder::envelope(const geom::CoordinateSequence& coords)
 {
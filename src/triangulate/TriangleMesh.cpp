@@ -0,0 +1,188 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/TriangleMesh.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/IllegalStateException.h>
+#include <geos/util.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace triangulate { // geos.triangulate
+
+/* public */
+TriangleMesh::TriangleMesh(bool hasZ)
+    : vertices(0u, hasZ, false)
+{}
+
+/* public */
+int32_t
+TriangleMesh::addVertex(const Coordinate& p)
+{
+    if (vertices.size() >= static_cast<std::size_t>(std::numeric_limits<int32_t>::max())) {
+        throw util::IllegalStateException("TriangleMesh vertex count exceeds index range");
+    }
+    auto index = static_cast<int32_t>(vertices.size());
+    vertices.add(p);
+    return index;
+}
+
+/* public */
+void
+TriangleMesh::addTriangle(int32_t v0, int32_t v1, int32_t v2)
+{
+    for (int32_t v : { v0, v1, v2 }) {
+        if (v < 0 || static_cast<std::size_t>(v) >= vertices.size()) {
+            throw util::IllegalArgumentException("TriangleMesh::addTriangle - invalid vertex index");
+        }
+    }
+    if (triangles.size() / 3 >= static_cast<std::size_t>(std::numeric_limits<int32_t>::max())) {
+        throw util::IllegalStateException("TriangleMesh triangle count exceeds index range");
+    }
+    triangles.push_back(v0);
+    triangles.push_back(v1);
+    triangles.push_back(v2);
+    neighbours.clear();
+}
+
+/* public */
+const std::vector<int32_t>&
+TriangleMesh::getNeighbours() const
+{
+    if (neighbours.size() != triangles.size()) {
+        computeNeighbours();
+    }
+    return neighbours;
+}
+
+/* public */
+Coordinate
+TriangleMesh::getCoordinate(std::size_t tri, std::size_t i) const
+{
+    if (tri >= getNumTriangles() || i > 2) {
+        throw util::IllegalArgumentException("TriangleMesh::getCoordinate - invalid index");
+    }
+    Coordinate c;
+    vertices.getAt(static_cast<std::size_t>(triangles[3 * tri + i]), c);
+    return c;
+}
+
+/* private */
+void
+TriangleMesh::computeNeighbours() const
+{
+    // Sort the edges by their vertices, so that the two
+    // sides of each interior edge are consecutive
+    std::vector<std::pair<uint64_t, std::size_t>> edges;
+    edges.reserve(triangles.size());
+    for (std::size_t t = 0; t < triangles.size(); t += 3) {
+        for (std::size_t i = 0; i < 3; i++) {
+            auto v0 = static_cast<uint32_t>(triangles[t + i]);
+            auto v1 = static_cast<uint32_t>(triangles[t + (i + 1) % 3]);
+            uint64_t key = (static_cast<uint64_t>(std::min(v0, v1)) << 32) | std::max(v0, v1);
+            edges.emplace_back(key, t + i);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    neighbours.assign(triangles.size(), NO_NEIGHBOUR);
+    for (std::size_t i = 0; i + 1 < edges.size(); i++) {
+        if (edges[i].first != edges[i + 1].first) {
+            continue;
+        }
+        // an edge shared by more than two triangles has no neighbours
+        bool isManifold = (i + 2 == edges.size() || edges[i + 2].first != edges[i].first)
+                          && (i == 0 || edges[i - 1].first != edges[i].first);
+        if (isManifold) {
+            std::size_t slot0 = edges[i].second;
+            std::size_t slot1 = edges[i + 1].second;
+            neighbours[slot0] = static_cast<int32_t>(slot1 / 3);
+            neighbours[slot1] = static_cast<int32_t>(slot0 / 3);
+            i++;
+        }
+    }
+}
+
+/* public */
+std::unique_ptr<GeometryCollection>
+TriangleMesh::toGeometry(const GeometryFactory& geomFact) const
+{
+    std::vector<std::unique_ptr<Geometry>> polys;
+    polys.reserve(getNumTriangles());
+    for (std::size_t t = 0; t < getNumTriangles(); t++) {
+        auto ring = detail::make_unique<CoordinateSequence>(4u, vertices.hasZ(), false);
+        for (std::size_t i = 0; i < 3; i++) {
+            ring->setAt(getCoordinate(t, i), i);
+        }
+        ring->setAt(getCoordinate(t, 0), 3);
+        polys.push_back(geomFact.createPolygon(geomFact.createLinearRing(std::move(ring))));
+    }
+    return geomFact.createGeometryCollection(std::move(polys));
+}
+
+/* public */
+TriangleMeshBuilder::TriangleMeshBuilder(bool hasZ)
+    : mesh(detail::make_unique<TriangleMesh>(hasZ))
+{}
+
+/* public */
+void
+TriangleMeshBuilder::addTriangle(const Coordinate& p0, const Coordinate& p1, const Coordinate& p2)
+{
+    if (!mesh) {
+        throw util::IllegalStateException("TriangleMeshBuilder: mesh has already been taken");
+    }
+    // Vertices are numbered in the order of their first use
+    int32_t v0 = addVertex(p0);
+    int32_t v1 = addVertex(p1);
+    int32_t v2 = addVertex(p2);
+    mesh->addTriangle(v0, v1, v2);
+}
+
+/* public */
+std::unique_ptr<TriangleMesh>
+TriangleMeshBuilder::getMesh()
+{
+    if (!mesh) {
+        throw util::IllegalStateException("TriangleMeshBuilder: mesh has already been taken");
+    }
+    // Release the memory of the index
+    decltype(vertexIndex)().swap(vertexIndex);
+    return std::move(mesh);
+}
+
+/* private */
+int32_t
+TriangleMeshBuilder::addVertex(const Coordinate& p)
+{
+    auto it = vertexIndex.find(p);
+    if (it != vertexIndex.end()) {
+        return it->second;
+    }
+    int32_t index = mesh->addVertex(p);
+    vertexIndex.emplace(p, index);
+    return index;
+}
+
+} // namespace geos.triangulate
+} // namespace geos
@@ -21,6 +21,7 @@
 #include <geos/triangulate/polygon/PolygonHoleJoiner.h>
 #include <geos/triangulate/polygon/PolygonEarClipper.h>
 #include <geos/triangulate/polygon/TriDelaunayImprover.h>
+#include <geos/util.h>
 
 using namespace geos::geom;
 
@@ -38,6 +39,20 @@ ConstrainedDelaunayTriangulator::triangulate(const Geometry* geom)
 }
 
 
+/* public static */
+std::unique_ptr<TriangleMesh>
+ConstrainedDelaunayTriangulator::triangulateToMesh(const Geometry* geom)
+{
+    util::ensureNoCurvedComponents(geom);
+
+    ConstrainedDelaunayTriangulator cdt(geom);
+    TriangleMeshBuilder builder(geom->hasZ());
+    for (const auto& triList : cdt.computeTris()) {
+        triList->toMesh(builder);
+    }
+    return builder.getMesh();
+}
+
 /* private */
 std::unique_ptr<Geometry>
 ConstrainedDelaunayTriangulator::compute() const
@@ -50,6 +65,13 @@ ConstrainedDelaunayTriangulator::compute() const
         return gf->createGeometryCollection();
     }
 
+    return toGeometry(geomFact, computeTris());
+}
+
+/* private */
+std::vector<std::unique_ptr<tri::TriList<tri::Tri>>>
+ConstrainedDelaunayTriangulator::computeTris() const
+{
     std::vector<const Polygon*> polys;
     geom::util::PolygonExtracter::getPolygons(*inputGeom, polys);
 
@@ -62,7 +84,7 @@ ConstrainedDelaunayTriangulator::compute() const
         triangulatePolygon(poly, *triList);
         allTriLists.emplace_back(triList.release());
     }
-    return toGeometry(geomFact, allTriLists);
+    return allTriLists;
 }
 
 /* private static */
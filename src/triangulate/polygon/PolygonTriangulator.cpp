@@ -19,6 +19,7 @@
 #include <geos/triangulate/polygon/PolygonTriangulator.h>
 #include <geos/triangulate/polygon/PolygonHoleJoiner.h>
 #include <geos/triangulate/polygon/PolygonEarClipper.h>
+#include <geos/util.h>
 
 using geos::geom::Geometry;
 
@@ -35,6 +36,19 @@ PolygonTriangulator::triangulate(const Geometry* geom)
     return clipper.compute();
 }
 
+/* public static */
+std::unique_ptr<TriangleMesh>
+PolygonTriangulator::triangulateToMesh(const Geometry* geom)
+{
+    PolygonTriangulator clipper(geom);
+    TriList<Tri> triList;
+    clipper.computeTris(triList);
+
+    TriangleMeshBuilder builder(geom->hasZ());
+    triList.toMesh(builder);
+    return builder.getMesh();
+}
+
 /* private */
 std::unique_ptr<Geometry>
 PolygonTriangulator::compute()
@@ -45,17 +59,24 @@ PolygonTriangulator::compute()
         return gf->createGeometryCollection();
     }
 
+    TriList<Tri> triList;
+    computeTris(triList);
+    return triList.toGeometry(geomFact);
+}
+
+/* private */
+void
+PolygonTriangulator::computeTris(TriList<Tri>& triList)
+{
     std::vector<const Polygon*> polys;
     geom::util::PolygonExtracter::getPolygons(*inputGeom, polys);
 
-    TriList<Tri> triList;
     for (const Polygon* poly : polys) {
         // Skip empty component polygons
         if (poly->isEmpty())
             continue;
         triangulatePolygon(poly, triList);
     }
-    return triList.toGeometry(geomFact);
 }
 
 /* private */
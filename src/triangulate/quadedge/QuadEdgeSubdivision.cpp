@@ -17,12 +17,15 @@
  *
  **********************************************************************/
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/TriangleMesh.h>
 
 #include <algorithm>
 #include <vector>
 #include <set>
 #include <iostream>
 
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/Envelope.h>
 #include <geos/geom/Polygon.h>
 #include <geos/geom/LineSegment.h>
 #include <geos/geom/LineString.h>
@@ -139,12 +142,10 @@ QuadEdge*
 QuadEdgeSubdivision::locateFromEdge(const Vertex& v,
                                     const QuadEdge& startEdge) const
 {
-    ::geos::ignore_unused_variable_warning(startEdge);
-
     std::size_t iter = 0;
     auto maxIter = quadEdges.size();
 
-    QuadEdge* e = startingEdges[0];
+    QuadEdge* e = const_cast<QuadEdge*>(&startEdge);
 
     for(;;) {
         ++iter;
@@ -164,19 +165,36 @@ QuadEdgeSubdivision::locateFromEdge(const Vertex& v,
         if((v.equals(e->orig())) || (v.equals(e->dest()))) {
             break;
         }
-        else if(v.rightOf(*e)) {
-            e = &e->sym();
+
+        /*
+         * Visibility walk: cross an edge of the triangle to the left of e
+         * which has v on its other side. The edges are tested starting from
+         * a different one at each step, which prevents the walk from cycling
+         * in triangulations which are not exactly Delaunay (because of
+         * round-off in the in-circle test, or near the frame).
+         */
+        QuadEdge* edges[3] = { e, &e->lNext(), &e->lPrev() };
+        QuadEdge* crossed = nullptr;
+        for(std::size_t i = 0; i < 3; i++) {
+            QuadEdge* edge = edges[(i + iter) % 3];
+            if(v.rightOf(*edge)) {
+                crossed = edge;
+                break;
+            }
         }
-        else if(!v.rightOf(e->oNext())) {
-            e = &e->oNext();
+        if(crossed) {
+            e = &crossed->sym();
+            continue;
         }
-        else if(!v.rightOf(e->dPrev())) {
-            e = &e->dPrev();
+
+        // v is in the triangle: return the edge it lies on, if any
+        if(!v.leftOf(*edges[1])) {
+            e = edges[1];
         }
-        else {
-            // on edge or in triangle containing edge
-            break;
+        else if(!v.leftOf(*edges[2])) {
+            e = edges[2];
         }
+        break;
     }
     return e;
 }
@@ -275,11 +293,20 @@ QuadEdgeSubdivision::isFrameVertex(const Vertex& v) const
 bool
 QuadEdgeSubdivision::isOnEdge(const QuadEdge& e, const Coordinate& p) const
 {
+    const Coordinate& p0 = e.orig().getCoordinate();
+    const Coordinate& p1 = e.dest().getCoordinate();
     geom::LineSegment seg;
-    seg.setCoordinates(e.orig().getCoordinate(), e.dest().getCoordinate());
+    seg.setCoordinates(p0, p1);
     double dist = seg.distance(p);
     // heuristic (hack?)
-    return dist < edgeCoincidenceTolerance;
+    if(dist < edgeCoincidenceTolerance) {
+        return true;
+    }
+    // a point exactly in the interior of the edge, which would
+    // otherwise be connected to it by a zero-width triangle
+    return !p.equals2D(p0) && !p.equals2D(p1)
+           && geom::Envelope::intersects(p0, p1, p)
+           && algorithm::Orientation::index(p0, p1, p) == algorithm::Orientation::COLLINEAR;
 }
 
 bool
@@ -408,6 +435,68 @@ QuadEdgeSubdivision::getTriangleCoordinates(QuadEdgeSubdivision::TriList* triLis
     visitTriangles(&visitor, includeFrame);
 }
 
+class
+    QuadEdgeSubdivision::TriangleMeshVisitor : public TriangleVisitor {
+private:
+    TriangleMesh& mesh;
+    // the vertices of the subdivision, in coordinate order
+    const std::vector<Vertex>& vertices;
+    int32_t firstVertex;
+
+    int32_t
+    vertexIndex(const QuadEdge* e) const
+    {
+        auto it = std::lower_bound(vertices.begin(), vertices.end(), e->orig());
+        return firstVertex + static_cast<int32_t>(it - vertices.begin());
+    }
+
+public:
+    TriangleMeshVisitor(TriangleMesh& p_mesh, const std::vector<Vertex>& p_vertices)
+        : mesh(p_mesh)
+        , vertices(p_vertices)
+        , firstVertex(static_cast<int32_t>(p_mesh.getNumVertices()))
+    {
+        for (const Vertex& v : vertices) {
+            mesh.addVertex(v.getCoordinate());
+        }
+    }
+
+    void
+    visit(std::array<QuadEdge*, 3>& triEdges) override
+    {
+        mesh.addTriangle(vertexIndex(triEdges[0]),
+                         vertexIndex(triEdges[1]),
+                         vertexIndex(triEdges[2]));
+    }
+};
+
+void
+QuadEdgeSubdivision::getTriangleMesh(TriangleMesh& mesh)
+{
+    // The vertices are indexed by their position in coordinate order,
+    // found by binary search, rather than through a hash map
+    std::vector<Vertex> vertices;
+    vertices.reserve(quadEdges.size());
+    for (auto& quartet : quadEdges) {
+        const QuadEdge& qe = quartet.base();
+        if (!qe.isLive()) {
+            continue;
+        }
+        for (const Vertex* v : { &qe.orig(), &qe.dest() }) {
+            if (!isFrameVertex(*v)) {
+                vertices.push_back(*v);
+            }
+        }
+    }
+    std::sort(vertices.begin(), vertices.end());
+    vertices.erase(std::unique(vertices.begin(), vertices.end(), [](const Vertex& a, const Vertex& b) {
+        return a.getCoordinate().equals2D(b.getCoordinate());
+    }), vertices.end());
+
+    TriangleMeshVisitor visitor(mesh, vertices);
+    visitTriangles(&visitor, false);
+}
+
 void
 QuadEdgeSubdivision::prepareVisit() {
     if (!visit_state_clean) {
@@ -0,0 +1,398 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/Arena.h>
+#include <geos/util/IllegalStateException.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace geos {
+namespace util { // geos::util
+
+struct Arena::Chunk {
+    char* data;
+    std::size_t size;
+};
+
+/*
+ * The chunks of an arena. The pool is reference counted, with one
+ * reference held by the Arena and one by each live allocation, so
+ * that it outlives the Arena if objects allocated from it are freed
+ * after the Arena is destroyed.
+ */
+struct Arena::Pool {
+    std::vector<Chunk> chunks; // recorded in the page map
+    char* top = nullptr;
+    char* end = nullptr;
+    std::size_t nextChunkSize;
+    std::size_t used = 0;
+    std::atomic<std::size_t> refs{1};
+
+    explicit Pool(std::size_t chunkSize)
+        : nextChunkSize(chunkSize)
+    {}
+
+    ~Pool();
+
+    void release()
+    {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+};
+
+namespace {
+
+constexpr std::size_t ALIGNMENT = Arena::ALIGNMENT;
+
+// Chunks are aligned to PAGE_SIZE and made of whole pages, so that
+// every page of the address space belongs to one chunk at most
+constexpr unsigned PAGE_BITS = 16;
+constexpr std::size_t PAGE_SIZE = std::size_t(1) << PAGE_BITS;
+
+constexpr std::size_t MAX_CHUNK_SIZE = 16 * 1024 * 1024;
+
+thread_local Arena* currentArena = nullptr;
+
+std::size_t
+allocationSize(std::size_t size)
+{
+    if (size > static_cast<std::size_t>(-1) - ALIGNMENT) {
+        throw std::bad_alloc();
+    }
+    // Round up so that the next allocation is aligned as well,
+    // and so that every allocation has a distinct address
+    return std::max((size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT, ALIGNMENT);
+}
+
+std::size_t
+roundToPages(std::size_t size)
+{
+    if (size > static_cast<std::size_t>(-1) - PAGE_SIZE) {
+        throw std::bad_alloc();
+    }
+    return std::max((size + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE, PAGE_SIZE);
+}
+
+char*
+newChunk(std::size_t size)
+{
+    return static_cast<char*>(::operator new(size, std::align_val_t(PAGE_SIZE)));
+}
+
+void
+deleteChunk(char* data)
+{
+    ::operator delete(data, std::align_val_t(PAGE_SIZE));
+}
+
+/*
+ * The pool owning each page of the chunks of all arenas, so that
+ * deallocate() can tell memory from an arena from memory from the
+ * heap without taking a lock.
+ *
+ * This is a three-level radix tree over the pages of a 48-bit address
+ * space. Nodes are only added, under pageMapMutex, and never freed.
+ */
+constexpr unsigned ADDRESS_BITS = 48;
+constexpr unsigned LEAF_BITS = 11;
+constexpr unsigned MID_BITS = 11;
+constexpr unsigned ROOT_BITS = ADDRESS_BITS - PAGE_BITS - MID_BITS - LEAF_BITS;
+
+struct PageMapLeaf {
+    std::atomic<void*> pools[std::size_t(1) << LEAF_BITS] {};
+};
+
+struct PageMapMid {
+    std::atomic<PageMapLeaf*> leaves[std::size_t(1) << MID_BITS] {};
+};
+
+std::atomic<PageMapMid*> pageMap[std::size_t(1) << ROOT_BITS] {};
+std::mutex pageMapMutex;
+
+std::uint64_t
+pageOf(const void* p)
+{
+    return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(p)) >> PAGE_BITS;
+}
+
+bool
+isMapped(std::uint64_t page)
+{
+    return (page >> (ROOT_BITS + MID_BITS + LEAF_BITS)) == 0;
+}
+
+std::size_t
+rootIndex(std::uint64_t page)
+{
+    return static_cast<std::size_t>(page >> (MID_BITS + LEAF_BITS));
+}
+
+std::size_t
+midIndex(std::uint64_t page)
+{
+    return static_cast<std::size_t>(page >> LEAF_BITS) & ((std::size_t(1) << MID_BITS) - 1);
+}
+
+std::size_t
+leafIndex(std::uint64_t page)
+{
+    return static_cast<std::size_t>(page) & ((std::size_t(1) << LEAF_BITS) - 1);
+}
+
+// The pool owning the page holding p, or null
+void*
+findPool(const void* p)
+{
+    std::uint64_t page = pageOf(p);
+    if (!isMapped(page)) {
+        return nullptr;
+    }
+    PageMapMid* mid = pageMap[rootIndex(page)].load(std::memory_order_acquire);
+    if (mid == nullptr) {
+        return nullptr;
+    }
+    PageMapLeaf* leaf = mid->leaves[midIndex(page)].load(std::memory_order_acquire);
+    if (leaf == nullptr) {
+        return nullptr;
+    }
+    return leaf->pools[leafIndex(page)].load(std::memory_order_acquire);
+}
+
+// The entry of a page, creating the nodes leading to it.
+// Requires pageMapMutex.
+std::atomic<void*>&
+pageEntry(std::uint64_t page)
+{
+    auto& midSlot = pageMap[rootIndex(page)];
+    PageMapMid* mid = midSlot.load(std::memory_order_relaxed);
+    if (mid == nullptr) {
+        mid = new PageMapMid();
+        midSlot.store(mid, std::memory_order_release);
+    }
+    auto& leafSlot = mid->leaves[midIndex(page)];
+    PageMapLeaf* leaf = leafSlot.load(std::memory_order_relaxed);
+    if (leaf == nullptr) {
+        leaf = new PageMapLeaf();
+        leafSlot.store(leaf, std::memory_order_release);
+    }
+    return leaf->pools[leafIndex(page)];
+}
+
+/*
+ * Records pool as the owner of the pages of a chunk, or clears
+ * them if pool is null.
+ *
+ * @return false if the chunk lies outside of the address space
+ *         covered by the page map
+ */
+bool
+mapChunk(const char* data, std::size_t size, void* pool)
+{
+    std::uint64_t first = pageOf(data);
+    std::uint64_t last = pageOf(data + size - 1);
+    if (!isMapped(last)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(pageMapMutex);
+    // Create all the nodes first, so that a failure leaves no page mapped
+    for (std::uint64_t page = first; page <= last; page++) {
+        pageEntry(page);
+    }
+    for (std::uint64_t page = first; page <= last; page++) {
+        pageEntry(page).store(pool, std::memory_order_release);
+    }
+    return true;
+}
+
+}
+
+std::atomic<std::size_t> Arena::numScopes{0};
+std::atomic<std::size_t> Arena::numChunks{0};
+
+/* private */
+Arena::Pool::~Pool()
+{
+    for (const auto& chunk : chunks) {
+        mapChunk(chunk.data, chunk.size, nullptr);
+        numChunks.fetch_sub(1, std::memory_order_release);
+        deleteChunk(chunk.data);
+    }
+}
+
+/* public */
+Arena::Scope::Scope(Arena* arena)
+    : previous(currentArena)
+{
+    if (arena) {
+        numScopes.fetch_add(1, std::memory_order_relaxed);
+    }
+    currentArena = arena;
+}
+
+/* public */
+Arena::Scope::~Scope()
+{
+    if (currentArena) {
+        numScopes.fetch_sub(1, std::memory_order_relaxed);
+    }
+    currentArena = previous;
+}
+
+/* public */
+Arena::Arena(std::size_t chunkSize)
+    : pool(new Pool(std::max(chunkSize, ALIGNMENT)))
+{}
+
+/* public */
+Arena::~Arena()
+{
+    pool->release();
+}
+
+/* public static */
+Arena*
+Arena::current()
+{
+    return currentArena;
+}
+
+/* private static */
+void*
+Arena::allocateScoped(std::size_t size)
+{
+    // An arena may be active on another thread only
+    if (currentArena) {
+        return currentArena->allocate(size);
+    }
+    return ::operator new(size);
+}
+
+/* private static */
+void
+Arena::deallocateChunked(void* p) noexcept
+{
+    if (p == nullptr) {
+        return;
+    }
+
+    // The pool cannot be destroyed meanwhile, since p holds a reference to it
+    Pool* owner = static_cast<Pool*>(findPool(p));
+    if (owner) {
+        owner->release();
+    }
+    else {
+        ::operator delete(p);
+    }
+}
+
+/* private */
+void*
+Arena::allocate(std::size_t size)
+{
+    std::size_t total = allocationSize(size);
+
+    if (static_cast<std::size_t>(pool->end - pool->top) < total) {
+        std::size_t chunkSize = roundToPages(std::max(pool->nextChunkSize, total));
+        Chunk chunk { newChunk(chunkSize), chunkSize };
+        try {
+            pool->chunks.push_back(chunk);
+            if (!mapChunk(chunk.data, chunk.size, pool)) {
+                throw std::bad_alloc();
+            }
+            numChunks.fetch_add(1, std::memory_order_release);
+        }
+        catch (...) {
+            if (!pool->chunks.empty() && pool->chunks.back().data == chunk.data) {
+                pool->chunks.pop_back();
+            }
+            deleteChunk(chunk.data);
+            throw;
+        }
+        pool->top = chunk.data;
+        pool->end = chunk.data + chunk.size;
+        pool->nextChunkSize = std::min(2 * pool->nextChunkSize, MAX_CHUNK_SIZE);
+    }
+
+    void* p = pool->top;
+    pool->top += total;
+    pool->used += total;
+    pool->refs.fetch_add(1, std::memory_order_relaxed);
+    return p;
+}
+
+/* public */
+void
+Arena::reset()
+{
+    if (getNumAllocations() != 0) {
+        throw IllegalStateException("Arena::reset: objects allocated from the arena have not been freed");
+    }
+
+    auto largest = std::max_element(pool->chunks.begin(), pool->chunks.end(),
+    [](const Chunk& a, const Chunk& b) {
+        return a.size < b.size;
+    });
+    if (largest == pool->chunks.end()) {
+        return;
+    }
+
+    Chunk keep = *largest;
+    for (const auto& chunk : pool->chunks) {
+        if (chunk.data != keep.data) {
+            mapChunk(chunk.data, chunk.size, nullptr);
+            numChunks.fetch_sub(1, std::memory_order_release);
+            deleteChunk(chunk.data);
+        }
+    }
+    pool->chunks.assign(1, keep);
+    pool->top = keep.data;
+    pool->end = keep.data + keep.size;
+    pool->used = 0;
+}
+
+/* public */
+std::size_t
+Arena::getNumAllocations() const
+{
+    return pool->refs.load(std::memory_order_acquire) - 1;
+}
+
+/* public */
+std::size_t
+Arena::getBytesUsed() const
+{
+    return pool->used;
+}
+
+/* public */
+std::size_t
+Arena::getBytesReserved() const
+{
+    std::size_t reserved = 0;
+    for (const auto& chunk : pool->chunks) {
+        reserved += chunk.size;
+    }
+    return reserved;
+}
+
+} // namespace geos::util
+} // namespace geos
@@ -15,9 +15,13 @@
 #include <geos/util/Interrupt.h>
 #include <geos/util/GEOSException.h> // for inheritance
 
+#include <atomic>
+
 namespace {
-/* Could these be portably stored in thread-specific space ? */
-bool requested = false;
+/* Could these be portably stored in thread-specific space ?
+ * The flag is atomic as it is polled by the workers of
+ * parallel operations. */
+std::atomic<bool> requested(false);
 
 geos::util::Interrupt::Callback* callback = nullptr;
 }
@@ -0,0 +1,86 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/PhaseProfiler.h>
+#include <geos/util/IllegalArgumentException.h>
+
+namespace geos {
+namespace util { // geos::util
+
+namespace {
+
+thread_local PhaseProfiler* currentProfiler = nullptr;
+
+}
+
+/* public */
+PhaseProfiler::Scope::Scope(PhaseProfiler* profiler)
+    : previous(currentProfiler)
+{
+    currentProfiler = profiler;
+}
+
+/* public */
+PhaseProfiler::Scope::~Scope()
+{
+    currentProfiler = previous;
+}
+
+/* public */
+PhaseProfiler::PhaseProfiler()
+{
+    reset();
+}
+
+/* public static */
+PhaseProfiler*
+PhaseProfiler::current()
+{
+    return currentProfiler;
+}
+
+/* public */
+void
+PhaseProfiler::reset()
+{
+    counts.fill(0);
+    times.fill(std::chrono::nanoseconds::zero());
+}
+
+/* public static */
+const char*
+PhaseProfiler::getPhaseName(Phase phase)
+{
+    switch (phase) {
+    case OVERLAY_NODING:
+        return "overlay_noding";
+    case OVERLAY_GRAPH:
+        return "overlay_graph";
+    case OVERLAY_LABELLING:
+        return "overlay_labelling";
+    case OVERLAY_RESULT:
+        return "overlay_result";
+    case OVERLAY_SNAPPING:
+        return "overlay_snapping";
+    case OVERLAY_SNAPROUNDING:
+        return "overlay_snaprounding";
+    case INDEX_BUILD:
+        return "index_build";
+    default:
+        throw IllegalArgumentException("Unknown profiling phase");
+    }
+}
+
+} // namespace geos::util
+} // namespace geos
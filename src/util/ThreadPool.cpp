@@ -0,0 +1,265 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2025 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/ThreadPool.h>
+
+#include <chrono>
+
+namespace {
+
+// Pool owning the current thread, if the thread is a pool worker,
+// and the index of the worker queue.
+thread_local const geos::util::ThreadPool* currentPool = nullptr;
+thread_local std::size_t currentIndex = 0;
+
+}
+
+namespace geos {
+namespace util { // geos::util
+
+/* public */
+ThreadPool::ThreadPool(std::size_t numThreads)
+    : queuedTasks(0)
+    , stopping(false)
+{
+    if (numThreads == 0) {
+        numThreads = defaultNumThreads();
+    }
+
+    for (std::size_t i = 0; i < numThreads; i++) {
+        queues.emplace_back(new WorkQueue());
+    }
+
+    workers.reserve(numThreads - 1);
+    for (std::size_t i = 1; i < numThreads; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+/* public */
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    sleepCondition.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+/* public static */
+std::size_t
+ThreadPool::defaultNumThreads()
+{
+    std::size_t n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+}
+
+/* private */
+std::size_t
+ThreadPool::currentQueueIndex() const
+{
+    return currentPool == this ? currentIndex : 0;
+}
+
+/* public */
+void
+ThreadPool::submit(std::function<void()> task)
+{
+    // Count the task before it becomes visible, so that
+    // a worker popping it can never see a zero count.
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedTasks++;
+    }
+
+    WorkQueue& queue = *queues[currentQueueIndex()];
+    try {
+        std::lock_guard<std::mutex> lock(queue.mtx);
+        queue.tasks.push_back(std::move(task));
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedTasks--;
+        throw;
+    }
+
+    sleepCondition.notify_one();
+}
+
+/* private */
+bool
+ThreadPool::popTask(std::size_t index, std::function<void()>& task)
+{
+    // Newest task from our own queue...
+    {
+        WorkQueue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mtx);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            queuedTasks--;
+            return true;
+        }
+    }
+
+    // ...otherwise steal the oldest task of another queue
+    std::size_t n = queues.size();
+    for (std::size_t k = 1; k < n; k++) {
+        WorkQueue& queue = *queues[(index + k) % n];
+        std::lock_guard<std::mutex> lock(queue.mtx);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            queuedTasks--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* public */
+bool
+ThreadPool::runPendingTask()
+{
+    std::function<void()> task;
+    if (!popTask(currentQueueIndex(), task)) {
+        return false;
+    }
+    task();
+    return true;
+}
+
+/* private */
+void
+ThreadPool::workerLoop(std::size_t index)
+{
+    currentPool = this;
+    currentIndex = index;
+
+    std::function<void()> task;
+    while (true) {
+        if (popTask(index, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [this]() {
+            return stopping || queuedTasks > 0;
+        });
+        if (stopping && queuedTasks == 0) {
+            return;
+        }
+    }
+}
+
+/* public */
+TaskGroup::~TaskGroup()
+{
+    waitNoThrow();
+}
+
+/* public */
+void
+TaskGroup::run(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        outstanding++;
+    }
+
+    try {
+        pool.submit([this, task = std::move(task)]() mutable {
+            if (!isCancelled()) {
+                try {
+                    task();
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    cancelled = true;
+                }
+            }
+            task = nullptr;
+
+            // Notify while holding the lock, so that the group
+            // cannot be destroyed by the waiter before we are done.
+            std::lock_guard<std::mutex> lock(mtx);
+            if (--outstanding == 0) {
+                done.notify_all();
+            }
+        });
+    }
+    catch (...) {
+        // The task was not queued, so it must not be waited for
+        std::lock_guard<std::mutex> lock(mtx);
+        if (--outstanding == 0) {
+            done.notify_all();
+        }
+        throw;
+    }
+}
+
+/* private */
+void
+TaskGroup::waitNoThrow()
+{
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (outstanding == 0) {
+                return;
+            }
+        }
+
+        if (pool.runPendingTask()) {
+            continue;
+        }
+
+        // Nothing to help with: the remaining tasks are running
+        // on other threads. Sleep briefly, in case one of them
+        // forks more work that we can pick up.
+        std::unique_lock<std::mutex> lock(mtx);
+        done.wait_for(lock, std::chrono::microseconds(100), [this]() {
+            return outstanding == 0;
+        });
+    }
+}
+
+/* public */
+void
+TaskGroup::wait()
+{
+    waitNoThrow();
+
+    std::exception_ptr ex;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        std::swap(ex, error);
+    }
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
+} // namespace geos::util
+} // namespace geos
@@ -0,0 +1,205 @@
+//
+// Test Suite for geos::algorithm::CoordinateKernels
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/CoordinateKernels.h>
+#include <geos/algorithm/RayCrossingCounter.h>
+#include <geos/constants.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Location.h>
+// std
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+using geos::algorithm::CoordinateKernels;
+using geos::algorithm::RayCrossingCounter;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::CoordinateXYZM;
+using geos::geom::Envelope;
+using geos::geom::Location;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_coordinatekernels_data {
+    using InstructionSet = CoordinateKernels::InstructionSet;
+
+    InstructionSet initialIsa;
+
+    test_coordinatekernels_data()
+        : initialIsa(CoordinateKernels::getInstructionSet())
+    {}
+
+    ~test_coordinatekernels_data()
+    {
+        CoordinateKernels::setInstructionSet(initialIsa);
+    }
+
+    static std::vector<InstructionSet>
+    supportedInstructionSets()
+    {
+        std::vector<InstructionSet> isas;
+        for (auto isa : { InstructionSet::SCALAR, InstructionSet::SSE2,
+                          InstructionSet::AVX2, InstructionSet::AVX512 }) {
+            if (CoordinateKernels::isSupported(isa)) {
+                isas.push_back(isa);
+            }
+        }
+        return isas;
+    }
+
+    // A closed star-shaped ring of n vertices with the given stride
+    static CoordinateSequence
+    makeRing(std::size_t n, std::size_t stride)
+    {
+        CoordinateSequence seq = stride == 2 ? CoordinateSequence::XY(0)
+                               : stride == 3 ? CoordinateSequence::XYZ(0)
+                               : CoordinateSequence::XYZM(0);
+        for (std::size_t i = 0; i < n; i++) {
+            double a = 2 * geos::MATH_PI * static_cast<double>(i) / static_cast<double>(n);
+            double r = (i % 2 == 0) ? 100.0 : 37.3;
+            seq.add(CoordinateXYZM(r * std::cos(a) + 0.1, r * std::sin(a) - 0.2, 1, 2));
+        }
+        seq.closeRing();
+        return seq;
+    }
+
+    static double
+    shoelaceArea(const CoordinateSequence& ring)
+    {
+        double sum = 0;
+        for (std::size_t i = 1; i < ring.size(); i++) {
+            sum += ring.getX(i - 1) * ring.getY(i) - ring.getX(i) * ring.getY(i - 1);
+        }
+        return -sum / 2;
+    }
+
+    static Location
+    locateBySegments(const CoordinateXY& p, const CoordinateSequence& ring)
+    {
+        RayCrossingCounter rcc(p);
+        for (std::size_t i = 1; i < ring.size(); i++) {
+            rcc.countSegment(ring.getAt<CoordinateXY>(i - 1), ring.getAt<CoordinateXY>(i));
+            if (rcc.isOnSegment()) {
+                break;
+            }
+        }
+        return rcc.getLocation();
+    }
+};
+
+typedef test_group<test_coordinatekernels_data> group;
+typedef group::object object;
+
+group test_coordinatekernels_group("geos::algorithm::CoordinateKernels");
+
+//
+// Test Cases
+//
+
+// The scalar implementation is always available
+template<>
+template<>
+void object::test<1>
+()
+{
+    ensure(CoordinateKernels::isSupported(InstructionSet::SCALAR));
+    ensure(CoordinateKernels::isSupported(CoordinateKernels::getInstructionSet()));
+
+    CoordinateKernels::setInstructionSet(InstructionSet::SCALAR);
+    ensure(CoordinateKernels::getInstructionSet() == InstructionSet::SCALAR);
+}
+
+// All instruction sets compute identical results
+template<>
+template<>
+void object::test<2>
+()
+{
+    for (std::size_t stride : { 2u, 3u, 4u }) {
+        for (std::size_t n : { 3u, 4u, 9u, 16u, 17u, 63u, 1000u }) {
+            CoordinateSequence ring = makeRing(n, stride);
+
+            CoordinateKernels::setInstructionSet(InstructionSet::SCALAR);
+            double area = CoordinateKernels::signedAreaOfRing(ring);
+            double length = CoordinateKernels::lengthOfLine(ring);
+            Envelope env = ring.getEnvelope();
+
+            ensure_distance(area, shoelaceArea(ring), 1e-9 * std::abs(area));
+            ensure(area < 0);
+            ensure(length > 0);
+
+            for (auto isa : supportedInstructionSets()) {
+                CoordinateKernels::setInstructionSet(isa);
+                ensure_equals(CoordinateKernels::signedAreaOfRing(ring), area);
+                ensure_equals(CoordinateKernels::lengthOfLine(ring), length);
+                ensure(ring.getEnvelope() == env);
+            }
+        }
+    }
+}
+
+// Ray crossing candidates include every segment which affects the location
+template<>
+template<>
+void object::test<3>
+()
+{
+    for (std::size_t stride : { 2u, 3u, 4u }) {
+        CoordinateSequence ring = makeRing(101, stride);
+
+        std::vector<CoordinateXY> pts {
+            { 0, 0 },
+            { 0.1, -0.2 },
+            { 200, 0 },
+            { -50, 3 },
+            ring.getAt<CoordinateXY>(17),
+            ring.getAt<CoordinateXY>(100),
+            { (ring.getX(4) + ring.getX(5)) / 2, (ring.getY(4) + ring.getY(5)) / 2 },
+        };
+
+        for (auto isa : supportedInstructionSets()) {
+            CoordinateKernels::setInstructionSet(isa);
+            for (const auto& p : pts) {
+                ensure_equals(RayCrossingCounter::locatePointInRing(p, ring), locateBySegments(p, ring));
+            }
+        }
+    }
+}
+
+// expandEnvelope ignores NaN ordinates once the envelope is initialized
+template<>
+template<>
+void object::test<4>
+()
+{
+    CoordinateSequence seq = CoordinateSequence::XY(0);
+    seq.add(CoordinateXY(geos::DoubleNotANumber, 5));
+    seq.add(CoordinateXY(0, 0));
+    for (int i = 1; i < 20; i++) {
+        seq.add(CoordinateXY(i % 3 == 0 ? geos::DoubleNotANumber : i,
+                             i % 2 == 0 ? geos::DoubleNotANumber : -i));
+    }
+
+    for (auto isa : supportedInstructionSets()) {
+        CoordinateKernels::setInstructionSet(isa);
+
+        Envelope env;
+        seq.expandEnvelope(env);
+        ensure(env == Envelope(0, 19, -19, 0));
+
+        Envelope env2(-5, -4, 100, 101);
+        seq.expandEnvelope(env2);
+        ensure(env2 == Envelope(-5, 19, -19, 101));
+    }
+}
+
+} // namespace tut
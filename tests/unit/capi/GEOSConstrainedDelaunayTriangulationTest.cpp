@@ -83,6 +83,32 @@ void object::test<4>()
     ensure("curved geometry not supported", result_ == nullptr);
 }
 
+// Triangle mesh
+template<>
+template<>
+void object::test<5>()
+{
+    input_ = fromWKT("POLYGON ((10 10, 20 40, 90 90, 90 10, 10 10))");
+
+    GEOSTriangleMesh* mesh = GEOSConstrainedDelaunayTriangulationMesh(input_);
+    ensure(mesh != nullptr);
+    ensure_equals(GEOSTriangleMesh_getNumVertices(mesh), 4u);
+    ensure_equals(GEOSTriangleMesh_getNumTriangles(mesh), 2u);
+
+    const int* nbrs = GEOSTriangleMesh_getNeighbours(mesh);
+    int numShared = 0;
+    for (std::size_t i = 0; i < 6; i++) {
+        if (nbrs[i] != -1) {
+            numShared++;
+        }
+    }
+    ensure_equals(numShared, 2);
 
-} // namespace tut
+    GEOSTriangleMesh_destroy(mesh);
 
+    geom1_ = fromWKT("CURVEPOLYGON (COMPOUNDCURVE (CIRCULARSTRING (0 0, 1 1, 2 0), (2 0, 0 0)))");
+    ensure(GEOSConstrainedDelaunayTriangulationMesh(geom1_) == nullptr);
+}
+
+
+} // namespace tut
@@ -0,0 +1,99 @@
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_geoscontextarena_data : public capitest::utility {
+
+    GEOSContextHandle_t context;
+
+    test_geoscontextarena_data()
+        : context(GEOS_init_r())
+    {}
+
+    ~test_geoscontextarena_data()
+    {
+        GEOS_finish_r(context);
+    }
+
+};
+
+typedef test_group<test_geoscontextarena_data> group;
+typedef group::object object;
+
+group test_geoscontextarena_group("capi::GEOSContextArena");
+
+//
+// Test Cases
+//
+
+// Geometries created with an arena behave as usual, and the
+// arena can be reset once they have been destroyed
+template<>
+template<>
+void object::test<1>()
+{
+    ensure_equals(GEOSContext_setArenaEnabled_r(context, 1), 1);
+
+    for (int request = 0; request < 3; request++) {
+        GEOSGeometry* a = GEOSGeomFromWKT_r(context, "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+        GEOSGeometry* b = GEOSGeomFromWKT_r(context, "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+        GEOSGeometry* u = GEOSUnion_r(context, a, b);
+        ensure(u != nullptr);
+
+        double area;
+        ensure_equals(GEOSArea_r(context, u, &area), 1);
+        ensure_equals(area, 175.0);
+
+        // Objects are still alive
+        ensure_equals(GEOSContext_resetArena_r(context), 0);
+
+        GEOSGeom_destroy_r(context, a);
+        GEOSGeom_destroy_r(context, b);
+        GEOSGeom_destroy_r(context, u);
+
+        ensure_equals(GEOSContext_resetArena_r(context), 1);
+    }
+}
+
+// Resetting fails when the arena is not enabled
+template<>
+template<>
+void object::test<2>()
+{
+    ensure_equals(GEOSContext_resetArena_r(context), 0);
+
+    ensure_equals(GEOSContext_setArenaEnabled_r(context, 1), 1);
+    ensure_equals(GEOSContext_resetArena_r(context), 1);
+
+    ensure_equals(GEOSContext_setArenaEnabled_r(context, 0), 1);
+    ensure_equals(GEOSContext_resetArena_r(context), 0);
+}
+
+// Geometries may outlive the arena, and be destroyed with another context
+template<>
+template<>
+void object::test<3>()
+{
+    ensure_equals(GEOSContext_setArenaEnabled_r(context, 1), 1);
+    GEOSGeometry* g = GEOSGeomFromWKT_r(context, "LINESTRING (0 0, 3 4)");
+    ensure_equals(GEOSContext_setArenaEnabled_r(context, 0), 1);
+
+    GEOSGeometry* h = GEOSGeom_clone_r(context, g);
+    ensure_equals(GEOSContext_setArenaEnabled_r(context, 1), 1);
+
+    double length;
+    ensure_equals(GEOSLength(g, &length), 1);
+    ensure_equals(length, 5.0);
+
+    GEOSGeom_destroy(g);
+    GEOSGeom_destroy_r(context, h);
+}
+
+} // namespace tut
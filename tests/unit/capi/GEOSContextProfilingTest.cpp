@@ -0,0 +1,122 @@
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+#include <string>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_geoscontextprofiling_data : public capitest::utility {
+
+    GEOSContextHandle_t context;
+
+    test_geoscontextprofiling_data()
+        : context(GEOS_init_r())
+    {}
+
+    ~test_geoscontextprofiling_data()
+    {
+        GEOS_finish_r(context);
+    }
+
+    unsigned long long count(int phase)
+    {
+        unsigned long long n = 0;
+        ensure_equals(GEOSContext_getProfilingCounters_r(context, phase, nullptr, &n, nullptr), 1);
+        return n;
+    }
+
+};
+
+typedef test_group<test_geoscontextprofiling_data> group;
+typedef group::object object;
+
+group test_geoscontextprofiling_group("capi::GEOSContextProfiling");
+
+//
+// Test Cases
+//
+
+// The phases of an overlay are counted
+template<>
+template<>
+void object::test<1>()
+{
+    ensure_equals(GEOSContext_setProfilingEnabled_r(context, 1), 1);
+
+    GEOSGeometry* a = GEOSGeomFromWKT_r(context, "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    GEOSGeometry* b = GEOSGeomFromWKT_r(context, "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+    for (int i = 0; i < 2; i++) {
+        GEOSGeometry* u = GEOSIntersection_r(context, a, b);
+        ensure(u != nullptr);
+        GEOSGeom_destroy_r(context, u);
+    }
+
+    for (int phase : { GEOS_PROFILING_OVERLAY_NODING, GEOS_PROFILING_OVERLAY_GRAPH,
+                       GEOS_PROFILING_OVERLAY_LABELLING, GEOS_PROFILING_OVERLAY_RESULT }) {
+        ensure_equals(count(phase), 2u);
+    }
+    ensure_equals(count(GEOS_PROFILING_OVERLAY_SNAPPING), 0u);
+    ensure_equals(count(GEOS_PROFILING_OVERLAY_SNAPROUNDING), 0u);
+
+    const char* name = nullptr;
+    unsigned long long n = 0;
+    double seconds = -1;
+    ensure_equals(GEOSContext_getProfilingCounters_r(context, GEOS_PROFILING_OVERLAY_NODING, &name, &n, &seconds), 1);
+    ensure_equals(std::string(name), "overlay_noding");
+    ensure(seconds >= 0);
+
+    ensure_equals(GEOSContext_resetProfiling_r(context), 1);
+    ensure_equals(count(GEOS_PROFILING_OVERLAY_NODING), 0u);
+
+    GEOSGeom_destroy_r(context, a);
+    GEOSGeom_destroy_r(context, b);
+}
+
+// Index builds are counted, and nothing is counted for another context
+template<>
+template<>
+void object::test<2>()
+{
+    ensure_equals(GEOSContext_setProfilingEnabled_r(context, 1), 1);
+
+    GEOSSTRtree* tree = GEOSSTRtree_create(10);
+    GEOSGeometry* g = GEOSGeomFromWKT("POINT (1 1)");
+    GEOSSTRtree_insert(tree, g, g);
+    GEOSSTRtree_build(tree);
+    GEOSSTRtree_destroy(tree);
+    GEOSGeom_destroy(g);
+    ensure_equals(count(GEOS_PROFILING_INDEX_BUILD), 0u);
+
+    tree = GEOSSTRtree_create_r(context, 10);
+    g = GEOSGeomFromWKT_r(context, "POINT (1 1)");
+    GEOSSTRtree_insert_r(context, tree, g, g);
+    GEOSSTRtree_build_r(context, tree);
+    GEOSSTRtree_destroy_r(context, tree);
+    GEOSGeom_destroy_r(context, g);
+    ensure_equals(count(GEOS_PROFILING_INDEX_BUILD), 1u);
+}
+
+// Counters are not available when profiling is disabled, or for invalid phases
+template<>
+template<>
+void object::test<3>()
+{
+    unsigned long long n;
+    ensure_equals(GEOSContext_getProfilingCounters_r(context, GEOS_PROFILING_OVERLAY_NODING, nullptr, &n, nullptr), 0);
+    ensure_equals(GEOSContext_resetProfiling_r(context), 0);
+
+    ensure_equals(GEOSContext_setProfilingEnabled_r(context, 1), 1);
+    ensure_equals(GEOSContext_getProfilingCounters_r(context, -1, nullptr, &n, nullptr), 0);
+    ensure_equals(GEOSContext_getProfilingCounters_r(context, GEOS_PROFILING_INDEX_BUILD + 1, nullptr, &n, nullptr), 0);
+
+    ensure_equals(GEOSContext_setProfilingEnabled_r(context, 0), 1);
+    ensure_equals(GEOSContext_resetProfiling_r(context), 0);
+}
+
+} // namespace tut
@@ -100,4 +100,27 @@ template<> void object::test<3>
     ensure_equals("curved geometry not supported", GEOSCoverageIsValid(input_, 0, nullptr), 2);
 }
 
+// Parallel validation
+template<>
+template<> void object::test<4>
+()
+{
+    input_ = fromWKT("GEOMETRYCOLLECTION ("
+        "POLYGON ((0 0, 1 0, 1 1, 0 1, 0 0)), "
+        "POLYGON ((1 0, 2 0, 2 1, 1 1, 1 0)), "
+        "POLYGON ((1.5 0.5, 2.5 0.5, 2.5 1.5, 1.5 1.5, 1.5 0.5)))");
+
+    ensure_equals(GEOSCoverageIsValidParallel(input_, 0, &result_, 4), 0);
+    ensure(result_ != nullptr);
+    ensure_equals(GEOSGetNumGeometries(result_), 3);
+    ensure(GEOSisEmpty(GEOSGetGeometryN(result_, 0)) == 1);
+    ensure(GEOSisEmpty(GEOSGetGeometryN(result_, 1)) == 0);
+
+    GEOSGeometry* valid = fromWKT("GEOMETRYCOLLECTION ("
+        "POLYGON ((0 0, 1 0, 1 1, 0 1, 0 0)), "
+        "POLYGON ((1 0, 2 0, 2 1, 1 1, 1 0)))");
+    ensure_equals(GEOSCoverageIsValidParallel(valid, 0, nullptr, 0), 1);
+    GEOSGeom_destroy(valid);
+}
+
 } // namespace tut
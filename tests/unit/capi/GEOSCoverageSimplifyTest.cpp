@@ -113,5 +113,17 @@ template<> void object::test<4>
     ensure("curved geometry not supported", result_ == nullptr);
 }
 
+// GEOSCoverageSimplifyVWParallel
+template<>
+template<> void object::test<5>
+()
+{
+    input_ = fromWKT("GEOMETRYCOLLECTION(POLYGON(( 0 0,10 0,10.1 5,10 10,0 10,0 0)),POLYGON((10 0,20 0,20 10,10 10,10.1 5,10 0)))");
+    result_ = GEOSCoverageSimplifyVWParallel(input_, 1.0, 0, 4);
+
+    ensure( result_ != nullptr );
+    expected_ = fromWKT("GEOMETRYCOLLECTION(POLYGON((0 0,10 0,10 10,0 10,0 0)),POLYGON((10 0,20 0,20 10,10 10,10 0)))");
+    ensure_geometry_equals(result_, expected_, 0.1);
+}
 
 } // namespace tut
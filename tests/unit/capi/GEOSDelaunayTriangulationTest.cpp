@@ -139,5 +139,52 @@ void object::test<7>()
     ensure("curved geometry not supported", result_ == nullptr);
 }
 
-} // namespace tut
+// Triangle mesh
+template<>
+template<>
+void object::test<8>()
+{
+    input_ = fromWKT("MULTIPOINT ((0 0), (10 0), (10 10), (0 10), (5 5), (0 0))");
+
+    GEOSTriangleMesh* mesh = GEOSDelaunayTriangulationMesh(input_, 0);
+    ensure(mesh != nullptr);
+    ensure_equals(GEOSTriangleMesh_getNumVertices(mesh), 5u);
+    ensure_equals(GEOSTriangleMesh_getNumTriangles(mesh), 4u);
+
+    unsigned int size;
+    ensure(GEOSCoordSeq_getSize(GEOSTriangleMesh_getVertices(mesh), &size));
+    ensure_equals(size, 5u);
+
+    const int* tris = GEOSTriangleMesh_getTriangles(mesh);
+    const int* nbrs = GEOSTriangleMesh_getNeighbours(mesh);
+    int numBoundary = 0;
+    for (std::size_t i = 0; i < 12; i++) {
+        ensure(tris[i] >= 0 && tris[i] < 5);
+        ensure(nbrs[i] >= -1 && nbrs[i] < 4);
+        if (nbrs[i] == -1) {
+            numBoundary++;
+        }
+    }
+    ensure_equals(numBoundary, 4);
+
+    GEOSTriangleMesh_destroy(mesh);
+}
 
+// The index arrays of an empty mesh are not null, which signals an error
+template<>
+template<>
+void object::test<9>()
+{
+    input_ = fromWKT("MULTIPOINT EMPTY");
+
+    GEOSTriangleMesh* mesh = GEOSDelaunayTriangulationMesh(input_, 0);
+    ensure(mesh != nullptr);
+    ensure_equals(GEOSTriangleMesh_getNumVertices(mesh), 0u);
+    ensure_equals(GEOSTriangleMesh_getNumTriangles(mesh), 0u);
+    ensure(GEOSTriangleMesh_getTriangles(mesh) != nullptr);
+    ensure(GEOSTriangleMesh_getNeighbours(mesh) != nullptr);
+
+    GEOSTriangleMesh_destroy(mesh);
+}
+
+} // namespace tut
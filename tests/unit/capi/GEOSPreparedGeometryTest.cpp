@@ -12,6 +12,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
+#include <vector>
 
 #include "capi_test_utils.h"
 
@@ -485,5 +486,143 @@ void object::test<17>()
     GEOSFree(r2);
 }
 
+// Batch XY predicates match the single-point predicates
+template<>
+template<>
+void object::test<18>()
+{
+    geom1_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 4 2, 4 4, 2 4, 2 2))");
+    prepGeom1_ = GEOSPrepare(geom1_);
+
+    std::vector<double> x;
+    std::vector<double> y;
+    for (int i = -2; i <= 12; i++) {
+        for (int j = -2; j <= 12; j++) {
+            x.push_back(i * 0.9);
+            y.push_back(j * 0.9);
+        }
+    }
+    x.push_back(0); y.push_back(5); // boundary
+    x.push_back(3); y.push_back(3); // hole
+
+    unsigned int n = static_cast<unsigned int>(x.size());
+    for (unsigned int numThreads : { 1u, 3u }) {
+        std::vector<unsigned char> contains(n, 2);
+        std::vector<unsigned char> intersects(n, 2);
+
+        ensure_equals(GEOSPreparedContainsXYBatch(prepGeom1_, x.data(), y.data(), n, contains.data(), numThreads), 1);
+        ensure_equals(GEOSPreparedIntersectsXYBatch(prepGeom1_, x.data(), y.data(), n, intersects.data(), numThreads), 1);
+
+        for (unsigned int i = 0; i < n; i++) {
+            ensure_equals(contains[i], GEOSPreparedContainsXY(prepGeom1_, x[i], y[i]));
+            ensure_equals(intersects[i], GEOSPreparedIntersectsXY(prepGeom1_, x[i], y[i]));
+        }
+    }
+}
+
+// Batch geometry predicates match the single-geometry predicates
+template<>
+template<>
+void object::test<19>()
+{
+    geom1_ = fromWKT("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 30 10, 20 10, 20 0)))");
+    prepGeom1_ = GEOSPrepare(geom1_);
+
+    const char* wkt[] = {
+        "POINT (5 5)",
+        "POINT (15 5)",
+        "POINT (0 5)",
+        "POINT EMPTY",
+        "LINESTRING (5 5, 25 5)",
+        "LINESTRING (21 1, 29 9)",
+        "POLYGON ((1 1, 2 1, 2 2, 1 2, 1 1))",
+        "POLYGON ((8 8, 12 8, 12 12, 8 12, 8 8))",
+        "MULTIPOINT ((1 1), (21 1))",
+        "MULTIPOINT ((1 1), (15 1))"
+    };
+
+    std::vector<GEOSGeometry*> geoms;
+    for (const char* w : wkt) {
+        geoms.push_back(fromWKT(w));
+    }
+
+    unsigned int n = static_cast<unsigned int>(geoms.size());
+    for (unsigned int numThreads : { 1u, 4u }) {
+        std::vector<unsigned char> contains(n, 2);
+        std::vector<unsigned char> intersects(n, 2);
+
+        ensure_equals(GEOSPreparedContainsBatch(prepGeom1_, geoms.data(), n, contains.data(), numThreads), 1);
+        ensure_equals(GEOSPreparedIntersectsBatch(prepGeom1_, geoms.data(), n, intersects.data(), numThreads), 1);
+
+        for (unsigned int i = 0; i < n; i++) {
+            ensure_equals(contains[i], GEOSPreparedContains(prepGeom1_, geoms[i]));
+            ensure_equals(intersects[i], GEOSPreparedIntersects(prepGeom1_, geoms[i]));
+        }
+    }
+
+    for (GEOSGeometry* g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+}
+
+// Batch predicates with a non-polygonal prepared geometry
+template<>
+template<>
+void object::test<20>()
+{
+    geom1_ = fromWKT("LINESTRING (0 0, 10 10)");
+    prepGeom1_ = GEOSPrepare(geom1_);
+
+    double x[] = { 5, 5, 0, 10 };
+    double y[] = { 5, 6, 0, 10 };
+    unsigned char results[4];
+
+    ensure_equals(GEOSPreparedContainsXYBatch(prepGeom1_, x, y, 4, results, 2), 1);
+    ensure_equals(results[0], 1);
+    ensure_equals(results[1], 0);
+    ensure_equals(results[2], 0);
+    ensure_equals(results[3], 0);
+
+    ensure_equals(GEOSPreparedIntersectsXYBatch(prepGeom1_, x, y, 4, results, 2), 1);
+    ensure_equals(results[0], 1);
+    ensure_equals(results[1], 0);
+    ensure_equals(results[2], 1);
+    ensure_equals(results[3], 1);
+}
+
+// Null candidates are reported as an error
+template<>
+template<>
+void object::test<21>()
+{
+    geom1_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    prepGeom1_ = GEOSPrepare(geom1_);
+
+    const GEOSGeometry* geoms[] = { nullptr };
+    unsigned char results[1];
+
+    ensure_equals(GEOSPreparedIntersectsBatch(prepGeom1_, geoms, 1, results, 1), 0);
+}
+
+// A shared prepared geometry answers the same as a regular one
+template<>
+template<>
+void object::test<22>()
+{
+    geom1_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))");
+    prepGeom1_ = GEOSPrepare(geom1_);
+    prepGeom2_ = GEOSPrepareShared(geom1_);
+    ensure(prepGeom2_ != nullptr);
+
+    for (const char* wkt : { "POINT (1 1)", "POINT (5 5)", "POINT (10 5)", "LINESTRING (-1 5, 11 5)", "LINESTRING (4.5 4.5, 5.5 5.5)" }) {
+        geom2_ = fromWKT(wkt);
+        ensure_equals(GEOSPreparedIntersects(prepGeom2_, geom2_), GEOSPreparedIntersects(prepGeom1_, geom2_));
+        ensure_equals(GEOSPreparedContains(prepGeom2_, geom2_), GEOSPreparedContains(prepGeom1_, geom2_));
+        ensure_equals(GEOSPreparedTouches(prepGeom2_, geom2_), GEOSPreparedTouches(prepGeom1_, geom2_));
+        GEOSGeom_destroy(geom2_);
+        geom2_ = nullptr;
+    }
+}
+
 } // namespace tut
 
@@ -6,6 +6,7 @@
 #include <geos_c.h>
 #include <geos/constants.h>
 // std
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
@@ -507,6 +508,176 @@ void object::test<14>()
 }
 
 
+// A snapshot written to a file returns the same query results as the tree
+template<>
+template<>
+void object::test<15>()
+{
+    const char* path = "GEOSSTRtreeTest_snapshot.bin";
+
+    GEOSSTRtree* tree = GEOSSTRtree_create(4);
+    std::vector<GEOSGeometry*> geoms;
+    for (std::size_t i = 0; i < 100; i++) {
+        double x = static_cast<double>(i % 10);
+        double y = static_cast<double>(i / 10);
+        geoms.push_back(GEOSGeom_createPointFromXY(x, y));
+        // Store the index of the geometry, rather than a pointer, in the tree
+        GEOSSTRtree_insert(tree, geoms.back(), reinterpret_cast<void*>(i));
+    }
+    // Removed items are not included in the snapshot
+    GEOSSTRtree_remove(tree, geoms[55], reinterpret_cast<void*>(55));
+
+    ensure_equals(GEOSSTRtree_writeSnapshot(tree, path), 1);
+    GEOSSTRtreeSnapshot* snapshot = GEOSSTRtreeSnapshot_open(path);
+    ensure(snapshot != nullptr);
+
+    GEOSGeometry* q = GEOSGeom_createRectangle(3.5, 4.5, 6.5, 6.5);
+
+    std::vector<std::size_t> expected;
+    std::vector<std::size_t> actual;
+    auto collect = [](void* item, void* userdata) {
+        auto& hits = *static_cast<std::vector<std::size_t>*>(userdata);
+        hits.push_back(reinterpret_cast<std::size_t>(item));
+    };
+    GEOSSTRtree_query(tree, q, collect, &expected);
+    GEOSSTRtreeSnapshot_query(snapshot, q, collect, &actual);
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    ensure_equals(actual.size(), 5u);
+    ensure(actual == expected);
+
+    GEOSGeom_destroy(q);
+    GEOSSTRtreeSnapshot_destroy(snapshot);
+    GEOSSTRtree_destroy(tree);
+    for (auto& g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+    std::remove(path);
+}
+
+// Opening a file that is not a snapshot fails
+template<>
+template<>
+void object::test<16>()
+{
+    const char* path = "GEOSSTRtreeTest_invalid.bin";
+    std::FILE* f = std::fopen(path, "wb");
+    std::fputs("POINT (1 1)", f);
+    std::fclose(f);
+
+    ensure(GEOSSTRtreeSnapshot_open(path) == nullptr);
+    ensure(GEOSSTRtreeSnapshot_open("GEOSSTRtreeTest_missing.bin") == nullptr);
+
+    std::remove(path);
+}
+
+// GEOSSTRtree_nearestK returns items in order of increasing distance
+template<>
+template<>
+void object::test<17>()
+{
+    GEOSSTRtree* tree = GEOSSTRtree_create(4);
+    std::vector<GEOSGeometry*> geoms;
+    for (std::size_t i = 0; i < 100; i++) {
+        geoms.push_back(GEOSGeom_createPointFromXY(static_cast<double>(i % 10), static_cast<double>(i / 10)));
+        GEOSSTRtree_insert(tree, geoms.back(), geoms.back());
+    }
+
+    GEOSGeometry* q = GEOSGeom_createPointFromXY(2.1, 3.2);
+    const void* results[5];
+    double distances[5];
+
+    ensure_equals(GEOSSTRtree_nearestK(tree, q, q, 5, -1, nullptr, nullptr, results, distances), 5);
+    ensure(results[0] == geoms[32]);
+    ensure(results[1] == geoms[42]);
+    for (std::size_t i = 0; i < 5; i++) {
+        double d;
+        GEOSDistance(q, static_cast<const GEOSGeometry*>(results[i]), &d);
+        ensure_equals(distances[i], d);
+        if (i > 0) {
+            ensure(distances[i] >= distances[i - 1]);
+        }
+    }
+
+    // Limited by distance
+    ensure_equals(GEOSSTRtree_nearestK(tree, q, q, 5, 0.5, nullptr, nullptr, results, nullptr), 1);
+    ensure(results[0] == geoms[32]);
+
+    // Custom distance
+    INTPOINT p(2, 3);
+    std::vector<INTPOINT> points;
+    GEOSSTRtree* itree = GEOSSTRtree_create(4);
+    for (const auto& g : geoms) {
+        double x, y;
+        GEOSGeomGetX(g, &x);
+        GEOSGeomGetY(g, &y);
+        points.emplace_back(static_cast<int>(x), static_cast<int>(y));
+    }
+    for (std::size_t i = 0; i < points.size(); i++) {
+        GEOSSTRtree_insert(itree, geoms[i], &points[i]);
+    }
+    GEOSGeometry* pg = INTPOINT2GEOS(&p);
+    ensure_equals(GEOSSTRtree_nearestK(itree, &p, pg, 5, 1, INTPOINT_dist, nullptr, results, distances), 5);
+    ensure(results[0] == &points[32]);
+    ensure_equals(distances[0], 0.0);
+    ensure_equals(distances[4], 1.0);
+
+    GEOSGeom_destroy(pg);
+    GEOSGeom_destroy(q);
+    GEOSSTRtree_destroy(itree);
+    GEOSSTRtree_destroy(tree);
+    for (auto& g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+}
+
+// GEOSSTRtree_nearestKBatch returns the same results as GEOSSTRtree_nearestK
+template<>
+template<>
+void object::test<18>()
+{
+    const unsigned int k = 3;
+
+    GEOSSTRtree* tree = GEOSSTRtree_create(4);
+    std::vector<GEOSGeometry*> geoms;
+    for (std::size_t i = 0; i < 400; i++) {
+        geoms.push_back(GEOSGeom_createPointFromXY(static_cast<double>(i % 20), static_cast<double>(i / 20)));
+        GEOSSTRtree_insert(tree, geoms.back(), geoms.back());
+    }
+
+    std::vector<GEOSGeometry*> queries;
+    for (std::size_t i = 0; i < 50; i++) {
+        queries.push_back(GEOSGeom_createPointFromXY(0.5 * static_cast<double>(i), 0.5 * static_cast<double>(i)));
+    }
+
+    std::vector<const void*> results(queries.size() * k);
+    std::vector<double> distances(queries.size() * k);
+    std::vector<unsigned int> counts(queries.size());
+    ensure_equals(GEOSSTRtree_nearestKBatch(tree, queries.data(), static_cast<unsigned int>(queries.size()), k, 2,
+                                            nullptr, nullptr, results.data(), distances.data(), counts.data(), 4), 1);
+
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        const void* expected[k];
+        double expectedDistances[k];
+        int n = GEOSSTRtree_nearestK(tree, queries[i], queries[i], k, 2, nullptr, nullptr, expected, expectedDistances);
+        ensure_equals(counts[i], static_cast<unsigned int>(n));
+        for (std::size_t j = 0; j < counts[i]; j++) {
+            ensure_equals(distances[i * k + j], expectedDistances[j]);
+        }
+    }
+    // Queries beyond the grid find nothing within the distance
+    ensure_equals(counts.back(), 0u);
+
+    for (auto& g : queries) {
+        GEOSGeom_destroy(g);
+    }
+    GEOSSTRtree_destroy(tree);
+    for (auto& g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+}
+
 } // namespace tut
 
 
@@ -0,0 +1,123 @@
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+#include <sstream>
+#include <string>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capiunaryunionparallel_data : public capitest::utility {
+
+    static void
+    interruptNow()
+    {
+        GEOS_interruptRequest();
+    }
+
+    // MultiPolygon of nx * ny overlapping squares
+    static std::string
+    overlappingSquares(int nx, int ny)
+    {
+        std::stringstream wkt;
+        wkt << "MULTIPOLYGON (";
+        for (int i = 0; i < nx; i++) {
+            for (int j = 0; j < ny; j++) {
+                double x = i;
+                double y = j;
+                double d = 1.5;
+                wkt << (i + j > 0 ? ", " : "")
+                    << "((" << x << " " << y << ", " << x + d << " " << y << ", "
+                    << x + d << " " << y + d << ", " << x << " " << y + d << ", "
+                    << x << " " << y << "))";
+            }
+        }
+        wkt << ")";
+        return wkt.str();
+    }
+
+};
+
+typedef test_group<test_capiunaryunionparallel_data> group;
+typedef group::object object;
+
+group test_capiunaryunionparallel_group("capi::GEOSUnaryUnionParallel");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>()
+{
+    input_ = fromWKT("POLYGON EMPTY");
+    GEOSSetSRID(input_, 1234);
+
+    result_ = GEOSUnaryUnionParallel(input_, 4);
+
+    ensure(GEOSisEmpty(result_));
+    ensure_equals(GEOSGetSRID(input_), GEOSGetSRID(result_));
+}
+
+// Result matches the serial union
+template<>
+template<>
+void object::test<2>()
+{
+    input_ = fromWKT(overlappingSquares(10, 3).c_str());
+    ensure_equals(GEOSGetNumGeometries(input_), 30);
+
+    expected_ = GEOSUnaryUnion(input_);
+    result_ = GEOSUnaryUnionParallel(input_, 4);
+
+    ensure(result_ != nullptr);
+    ensure_equals(GEOSEqualsExact(result_, expected_, 0), 1);
+}
+
+// Mixed-dimension input with 0 (automatic) threads
+template<>
+template<>
+void object::test<3>()
+{
+    input_ = fromWKT("GEOMETRYCOLLECTION (POINT (5 5), LINESTRING (0 20, 20 20),"
+                     " POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0)), POLYGON ((5 0, 15 0, 15 10, 5 10, 5 0)))");
+
+    expected_ = GEOSUnaryUnion(input_);
+    result_ = GEOSUnaryUnionParallel(input_, 0);
+
+    ensure_geometry_equals(result_, expected_);
+}
+
+// Interruption is honored by the worker threads
+template<>
+template<>
+void object::test<4>()
+{
+    input_ = fromWKT(overlappingSquares(10, 2).c_str());
+
+    GEOSInterruptCallback* prev = GEOS_interruptRegisterCallback(interruptNow);
+    result_ = GEOSUnaryUnionParallel(input_, 4);
+    GEOS_interruptRegisterCallback(prev);
+
+    ensure("interrupted union returned a result", result_ == nullptr);
+}
+
+template <>
+template <>
+void object::test<5>() {
+    input_ = fromWKT("MULTICURVE ((0 0, 1 1), CIRCULARSTRING (1 1, 2 0, 3 1), (5 5, 8 8))");
+    ensure(input_);
+
+    result_ = GEOSUnaryUnionParallel(input_, 2);
+    ensure("curved geometry not supported", result_ == nullptr);
+}
+
+} // namespace tut
+
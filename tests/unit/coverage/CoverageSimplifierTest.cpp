@@ -6,8 +6,13 @@
 
 // geos
 #include <geos/coverage/CoverageSimplifier.h>
+#include <geos/coverage/CoverageValidator.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Polygon.h>
 
 using geos::coverage::CoverageSimplifier;
+using geos::coverage::CoverageValidator;
 
 namespace tut {
 //
@@ -482,5 +487,65 @@ void object::test<30> ()
     ensure("did not throw IllegalArgumentException", false);
 }
 
+// Simplification on several threads
+template<>
+template<>
+void object::test<31> ()
+{
+    using geos::geom::CoordinateSequence;
+    using geos::geom::CoordinateXY;
+
+    //-- a grid of cells with wiggly sides, shared by the adjacent cells
+    const int n = 60;
+    auto wiggle = [](int i, int j, int q) {
+        return static_cast<double>((i * 31 + j * 17 + q * 7) % 11) / 100.0 - 0.05;
+    };
+    auto gf = geos::geom::GeometryFactory::create();
+    std::vector<std::unique_ptr<Geometry>> input;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            CoordinateSequence ring;
+            for (int q = 0; q < 4; q++)
+                ring.add(CoordinateXY(i + q / 4.0, j + (q == 0 ? 0 : wiggle(i, j, q))));
+            for (int q = 0; q < 4; q++)
+                ring.add(CoordinateXY(i + 1 + (q == 0 ? 0 : wiggle(i + 1, j, q + 4)), j + q / 4.0));
+            for (int q = 4; q > 0; q--)
+                ring.add(CoordinateXY(i + q / 4.0, j + 1 + (q == 4 ? 0 : wiggle(i, j + 1, q))));
+            for (int q = 4; q > 0; q--)
+                ring.add(CoordinateXY(i + (q == 4 ? 0 : wiggle(i, j, q + 4)), j + q / 4.0));
+            ring.add(CoordinateXY(i, j));
+            input.push_back(gf->createPolygon(std::move(ring)));
+        }
+    }
+    std::vector<const Geometry*> coverage;
+    for (const auto& g : input) {
+        coverage.push_back(g.get());
+    }
+    ensure("input is valid", CoverageValidator::isValid(coverage));
+
+    CoverageSimplifier simp2(coverage);
+    simp2.setNumThreads(2);
+    std::vector<std::unique_ptr<Geometry>> result2 = simp2.simplify(0.2);
+
+    CoverageSimplifier simp4(coverage);
+    simp4.setNumThreads(4);
+    std::vector<std::unique_ptr<Geometry>> result4 = simp4.simplify(0.2);
+
+    //-- the result does not depend on the number of threads
+    ensure_equals(result4.size(), input.size());
+    std::size_t numPts = 0;
+    for (std::size_t i = 0; i < result4.size(); i++) {
+        ensure("same result", result2[i]->equalsExact(result4[i].get()));
+        ensure("valid polygon", result4[i]->isValid());
+        numPts += result4[i]->getNumPoints();
+    }
+    ensure("simplified", numPts < static_cast<std::size_t>(n * n * 17) / 2);
+
+    std::vector<const Geometry*> resultCoverage;
+    for (const auto& g : result4) {
+        resultCoverage.push_back(g.get());
+    }
+    ensure("result is valid", CoverageValidator::isValid(resultCoverage));
+}
 
 } // namespace tut
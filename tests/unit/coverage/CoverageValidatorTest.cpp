@@ -349,7 +349,43 @@ void object::test<15> ()
     checkValid(coverage);
 }
 
+// Validation on several threads gives the same result
+template<>
+template<>
+void object::test<16> ()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++) {
+            // every 7th cell overlaps its right neighbour
+            double maxX = (i * 30 + j) % 7 == 0 ? i + 1.5 : i + 1;
+            geoms.push_back(r.read("POLYGON ((" +
+                std::to_string(i) + " " + std::to_string(j) + ", " +
+                std::to_string(maxX) + " " + std::to_string(j) + ", " +
+                std::to_string(maxX) + " " + std::to_string(j + 1) + ", " +
+                std::to_string(i) + " " + std::to_string(j + 1) + ", " +
+                std::to_string(i) + " " + std::to_string(j) + "))"));
+        }
+    }
+    std::vector<const Geometry*> coverage = toCoverage(geoms);
 
+    std::vector<std::unique_ptr<Geometry>> expected = CoverageValidator::validate(coverage);
+    ensure(CoverageValidator::hasInvalidResult(expected));
 
+    CoverageValidator v(coverage);
+    v.setNumThreads(4);
+    std::vector<std::unique_ptr<Geometry>> actual = v.validate();
+
+    ensure_equals(actual.size(), expected.size());
+    for (std::size_t i = 0; i < actual.size(); i++) {
+        if (expected[i] == nullptr) {
+            ensure(actual[i] == nullptr);
+        }
+        else {
+            ensure(actual[i] != nullptr);
+            ensure_equals_geometry(expected[i].get(), actual[i].get());
+        }
+    }
+}
 
 } // namespace tut
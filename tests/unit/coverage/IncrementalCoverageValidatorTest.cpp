@@ -0,0 +1,168 @@
+//
+// Test Suite for geos::coverage::IncrementalCoverageValidator class.
+
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/coverage/CoverageValidator.h>
+#include <geos/coverage/IncrementalCoverageValidator.h>
+#include <geos/util/IllegalArgumentException.h>
+
+using geos::coverage::CoverageValidator;
+using geos::coverage::IncrementalCoverageValidator;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_incrementalcoveragevalidator_data {
+
+    WKTReader r;
+
+    std::unique_ptr<Geometry>
+    box(double minX, double minY, double maxX, double maxY)
+    {
+        std::ostringstream wkt;
+        wkt << "POLYGON ((" << minX << " " << minY << ", " << maxX << " " << minY << ", "
+            << maxX << " " << maxY << ", " << minX << " " << maxY << ", "
+            << minX << " " << minY << "))";
+        return r.read(wkt.str());
+    }
+
+    // Checks the results against a validation of the whole coverage
+    void
+    checkResults(std::vector<const Geometry*>& coverage,
+                 const std::map<std::size_t, std::unique_ptr<Geometry>>& results)
+    {
+        std::vector<std::unique_ptr<Geometry>> expected = CoverageValidator::validate(coverage);
+        for (const auto& result : results) {
+            const Geometry* actual = result.second.get();
+            const Geometry* exp = expected[result.first].get();
+            if (exp == nullptr) {
+                ensure("polygon should be valid", actual == nullptr);
+            }
+            else {
+                ensure("polygon should be invalid", actual != nullptr);
+                ensure_equals_geometry(exp, actual);
+            }
+        }
+    }
+};
+
+typedef test_group<test_incrementalcoveragevalidator_data> group;
+typedef group::object object;
+
+group test_incrementalcoveragevalidator_group("geos::coverage::IncrementalCoverageValidator");
+
+
+//
+// Test Cases
+//
+
+// Editing a polygon of a grid revalidates its neighbourhood only
+template<>
+template<>
+void object::test<1> ()
+{
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    std::vector<const Geometry*> coverage;
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 5; j++) {
+            geoms.push_back(box(i, j, i + 1, j + 1));
+            coverage.push_back(geoms.back().get());
+        }
+    }
+
+    IncrementalCoverageValidator v;
+    for (const Geometry* g : coverage) {
+        v.add(g);
+    }
+    auto results = v.validate();
+    ensure_equals(results.size(), 25u);
+    checkResults(coverage, results);
+    ensure(v.isValid());
+    ensure(v.validate().empty());
+
+    //-- the centre polygon overlaps the two cells on its right
+    std::size_t centre = 2 * 5 + 2;
+    auto edited = box(2, 2, 4.5, 3);
+    v.replace(centre, edited.get());
+    coverage[centre] = edited.get();
+
+    results = v.validate();
+    ensure_equals(results.size(), 12u);
+    checkResults(coverage, results);
+    ensure(results.at(centre) != nullptr);
+    ensure(! v.isValid());
+
+    //-- restoring the polygon makes the coverage valid again
+    v.replace(centre, geoms[centre].get());
+    coverage[centre] = geoms[centre].get();
+    results = v.validate();
+    ensure_equals(results.size(), 12u);
+    checkResults(coverage, results);
+    ensure(v.isValid());
+}
+
+// Adding and removing polygons
+template<>
+template<>
+void object::test<2> ()
+{
+    auto a = box(0, 0, 2, 2);
+    auto b = box(2, 0, 4, 2);
+    auto overlap = box(1, 1, 3, 3);
+    auto empty = r.read("POLYGON EMPTY");
+
+    IncrementalCoverageValidator v;
+    std::size_t idA = v.add(a.get());
+    std::size_t idB = v.add(b.get());
+    v.add(empty.get());
+    v.validate();
+    ensure(v.isValid());
+
+    std::size_t idOverlap = v.add(overlap.get());
+    auto results = v.validate();
+    ensure_equals(results.size(), 3u);
+    ensure(results.at(idA) != nullptr);
+    ensure(results.at(idB) != nullptr);
+    ensure(! v.isValid());
+    ensure_equals(v.size(), 4u);
+
+    v.remove(idOverlap);
+    results = v.validate();
+    ensure_equals(results.size(), 2u);
+    ensure(results.at(idA) == nullptr);
+    ensure(results.at(idB) == nullptr);
+    ensure(v.isValid());
+    ensure_equals(v.size(), 3u);
+
+    ensure_THROW(v.remove(idOverlap), geos::util::IllegalArgumentException);
+    ensure_THROW(v.replace(10, a.get()), geos::util::IllegalArgumentException);
+}
+
+// Narrow gaps
+template<>
+template<>
+void object::test<3> ()
+{
+    auto a = box(0, 0, 1, 1);
+    auto b = box(1.05, 0, 2, 1);
+
+    IncrementalCoverageValidator v(0.1);
+    std::size_t idA = v.add(a.get());
+    v.validate();
+    ensure(v.isValid());
+
+    v.add(b.get());
+    auto results = v.validate();
+    ensure_equals(results.size(), 2u);
+    ensure(results.at(idA) != nullptr);
+    ensure(! v.isValid());
+}
+
+} // namespace tut
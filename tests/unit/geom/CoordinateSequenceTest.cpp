@@ -6,6 +6,7 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateFilter.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
 #include <geos/util.h>
 #include <geos/constants.h>
 #include <utility.h>
@@ -21,6 +22,7 @@ using geos::geom::CoordinateXY;
 using geos::geom::CoordinateXYM;
 using geos::geom::CoordinateXYZM;
 using geos::geom::CoordinateSequence;
+using geos::geom::Envelope;
 
 constexpr const int MAX_TESTS = 100;
 
@@ -1536,4 +1538,38 @@ void object::test<56>
     ensure_equals_xyz(seq1.getAt(3), Coordinate{10, 11, DoubleNotANumber});
 }
 
+// withView provides the XY ordinates of each coordinate type
+template<>
+template<>
+void object::test<57>
+()
+{
+    CoordinateSequence xy = CoordinateSequence::XY(0);
+    CoordinateSequence xyz = CoordinateSequence::XYZ(0);
+    CoordinateSequence xym = CoordinateSequence::XYM(0);
+    CoordinateSequence xyzm = CoordinateSequence::XYZM(0);
+
+    for (int i = 0; i < 5; i++) {
+        double d = static_cast<double>(i);
+        xy.add(CoordinateXY(d, -d));
+        xyz.add(Coordinate(d, -d, 100));
+        xym.add(CoordinateXYM(d, -d, 200));
+        xyzm.add(CoordinateXYZM(d, -d, 100, 200));
+    }
+
+    for (const CoordinateSequence* seq : { &xy, &xyz, &xym, &xyzm }) {
+        seq->withView([seq](const auto& view) {
+            ensure_equals(view.size(), seq->size());
+            ensure(view.data() == seq->data());
+            ensure(view.data() + view.stride == &seq->getAt<CoordinateXY>(1).x);
+            for (std::size_t i = 0; i < view.size(); i++) {
+                ensure_equals(view.x(i), seq->getX(i));
+                ensure_equals(view.y(i), seq->getY(i));
+            }
+        });
+    }
+
+    ensure(xyzm.getEnvelope() == Envelope(0, 4, -4, 0));
+}
+
 } // namespace tut
@@ -12,6 +12,8 @@
 #include <geos/io/WKTReader.h>
 // std
 #include <memory>
+#include <thread>
+#include <vector>
 
 using namespace geos::geom;
 using geos::geom::prep::PreparedGeometry;
@@ -100,4 +102,60 @@ void object::test<3>
 }
 
 
+// A shared prepared geometry gives the same results when queried
+// from several threads at once
+template<>
+template<>
+void object::test<4>
+()
+{
+    g1 = reader.read("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0), (40 40, 60 40, 60 60, 40 60, 40 40))");
+    g1 = g1->buffer(5, 32);
+    g2 = reader.read("MULTILINESTRING ((0 0, 50 50, 100 0), (0 100, 100 100))");
+
+    std::vector<std::unique_ptr<Geometry>> candidates;
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++) {
+            double x = -10 + 4.2 * i;
+            double y = -10 + 4.2 * j;
+            candidates.push_back(factory->createPoint(CoordinateXY(x, y)));
+            candidates.push_back(reader.read("LINESTRING (" + std::to_string(x) + " " + std::to_string(y) + ", "
+                                             + std::to_string(x + 3) + " " + std::to_string(y + 1) + ")"));
+        }
+    }
+
+    for (const Geometry* g : { g1.get(), g2.get() }) {
+        auto prep = prep::PreparedGeometryFactory::prepare(g);
+        auto shared = prep::PreparedGeometryFactory::prepareShared(g);
+
+        std::vector<int> expected;
+        for (const auto& c : candidates) {
+            expected.push_back(prep->intersects(c.get()) | prep->contains(c.get()) << 1 |
+                               prep->covers(c.get()) << 2 | prep->touches(c.get()) << 3 |
+                               prep->isWithinDistance(c.get(), 1.0) << 4);
+        }
+
+        std::size_t numThreads = 4;
+        std::vector<std::vector<int>> actual(numThreads);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < numThreads; t++) {
+            threads.emplace_back([&shared, &candidates, &actual, t]() {
+                for (const auto& c : candidates) {
+                    actual[t].push_back(shared->intersects(c.get()) | shared->contains(c.get()) << 1 |
+                                        shared->covers(c.get()) << 2 | shared->touches(c.get()) << 3 |
+                                        shared->isWithinDistance(c.get(), 1.0) << 4);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (const auto& a : actual) {
+            ensure(a == expected);
+        }
+    }
+}
+
+
 } // namespace tut
@@ -0,0 +1,213 @@
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/index/strtree/STRtreeSnapshot.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace geos;
+using geos::index::strtree::STRtreeSnapshot;
+using geos::index::strtree::TemplateSTRtree;
+
+namespace tut {
+
+struct test_strtreesnapshot_data {
+    // Copy of a serialized snapshot, aligned for use by STRtreeSnapshot
+    std::vector<std::uint64_t> buffer;
+
+    std::size_t store(const std::string& bytes) {
+        buffer.assign((bytes.size() + 7) / 8, 0);
+        std::memcpy(buffer.data(), bytes.data(), bytes.size());
+        return bytes.size();
+    }
+
+    template<typename Tree>
+    static std::string serialize(Tree& tree) {
+        std::stringstream ss;
+        STRtreeSnapshot::write(tree, ss);
+        return ss.str();
+    }
+
+    static std::vector<std::uint64_t> sorted(std::vector<std::uint64_t> v) {
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+};
+
+typedef test_group<test_strtreesnapshot_data> group;
+typedef group::object object;
+
+group test_strtreesnapshot_group("geos::index::strtree::STRtreeSnapshot");
+
+// A snapshot returns the same query results as the tree it was written from
+template<>
+template<>
+void object::test<1>()
+{
+    std::default_random_engine eng(12345);
+    std::uniform_real_distribution<> coord(0, 100);
+
+    TemplateSTRtree<std::size_t> tree(8);
+    for (std::size_t i = 0; i < 5000; i++) {
+        double x = coord(eng);
+        double y = coord(eng);
+        tree.insert(geom::Envelope(x, x + 1, y, y + 1), i);
+    }
+
+    auto size = store(serialize(tree));
+    STRtreeSnapshot snapshot(buffer.data(), size);
+
+    ensure_equals(snapshot.getNumItems(), 5000u);
+    ensure_equals(snapshot.getNumNodes(), tree.getRoot()->getNumNodes());
+    ensure(snapshot.getBounds() == tree.getRoot()->getBounds());
+
+    for (std::size_t i = 0; i < 100; i++) {
+        double x = coord(eng);
+        double y = coord(eng);
+        geom::Envelope query(x, x + 5, y, y + 5);
+
+        std::vector<std::uint64_t> expected;
+        tree.query(query, [&expected](std::size_t item) {
+            expected.push_back(item);
+        });
+
+        ensure(sorted(snapshot.query(query)) == sorted(expected));
+    }
+}
+
+// Empty trees, single-item trees and removed items
+template<>
+template<>
+void object::test<2>()
+{
+    TemplateSTRtree<std::size_t> empty;
+    STRtreeSnapshot emptySnapshot(buffer.data(), store(serialize(empty)));
+    ensure_equals(emptySnapshot.getNumNodes(), 0u);
+    ensure(emptySnapshot.getBounds().isNull());
+    ensure(emptySnapshot.query(geom::Envelope(0, 1, 0, 1)).empty());
+
+    TemplateSTRtree<std::size_t> single;
+    single.insert(geom::Envelope(0, 1, 0, 1), 17);
+    STRtreeSnapshot singleSnapshot(buffer.data(), store(serialize(single)));
+    ensure(singleSnapshot.query(geom::Envelope(0.5, 0.5, 0.5, 0.5)) == std::vector<std::uint64_t>{17});
+    ensure(singleSnapshot.query(geom::Envelope(2, 3, 2, 3)).empty());
+
+    TemplateSTRtree<std::size_t> removed;
+    for (std::size_t i = 0; i < 20; i++) {
+        double x = static_cast<double>(i);
+        removed.insert(geom::Envelope(x, x, 0, 0), i);
+    }
+    removed.remove(geom::Envelope(3, 3, 0, 0), 3);
+    STRtreeSnapshot removedSnapshot(buffer.data(), store(serialize(removed)));
+    ensure_equals(removedSnapshot.getNumItems(), 19u);
+    ensure(sorted(removedSnapshot.query(geom::Envelope(2, 4, -1, 1))) == std::vector<std::uint64_t>{2, 4});
+}
+
+// Identifiers may be computed from items
+template<>
+template<>
+void object::test<3>()
+{
+    std::vector<geom::Envelope> envelopes;
+    for (std::size_t i = 0; i < 100; i++) {
+        double x = static_cast<double>(i);
+        envelopes.emplace_back(x, x + 0.5, 0, 1);
+    }
+
+    TemplateSTRtree<const geom::Envelope*> tree;
+    for (const auto& e : envelopes) {
+        tree.insert(e, &e);
+    }
+
+    std::stringstream ss;
+    STRtreeSnapshot::write(tree, ss, [&envelopes](const geom::Envelope* e) {
+        return static_cast<std::uint64_t>(e - envelopes.data());
+    });
+    STRtreeSnapshot snapshot(buffer.data(), store(ss.str()));
+
+    ensure(sorted(snapshot.query(geom::Envelope(10.2, 12.2, 0, 0))) == std::vector<std::uint64_t>{10, 11, 12});
+}
+
+// Invalid data is rejected
+template<>
+template<>
+void object::test<4>()
+{
+    TemplateSTRtree<std::size_t> tree(4);
+    for (std::size_t i = 0; i < 20; i++) {
+        double x = static_cast<double>(i);
+        tree.insert(geom::Envelope(x, x, 0, 0), i);
+    }
+    std::string bytes = serialize(tree);
+
+    // Truncated
+    auto size = store(bytes);
+    ensure_THROW(STRtreeSnapshot(buffer.data(), size - 8), util::IllegalArgumentException);
+    ensure_THROW(STRtreeSnapshot(buffer.data(), 16), util::IllegalArgumentException);
+
+    // Bad magic
+    std::string badMagic = bytes;
+    badMagic[0] = 'X';
+    size = store(badMagic);
+    ensure_THROW(STRtreeSnapshot(buffer.data(), size), util::IllegalArgumentException);
+
+    // Unsupported version
+    std::string badVersion = bytes;
+    badVersion[8] = 99;
+    size = store(badVersion);
+    ensure_THROW(STRtreeSnapshot(buffer.data(), size), util::IllegalArgumentException);
+
+    // Root whose children would include itself: the nodes are only
+    // checked by validate(), or by a query traversing them
+    std::string cycle = bytes;
+    std::uint64_t zero = 0;
+    std::memcpy(&cycle[32 + 32], &zero, sizeof(zero));
+    size = store(cycle);
+    STRtreeSnapshot snapshot(buffer.data(), size);
+    ensure_THROW(snapshot.validate(), util::IllegalArgumentException);
+    ensure_THROW(snapshot.query(geom::Envelope(0, 1, 0, 0)), util::IllegalArgumentException);
+
+    size = store(bytes);
+    STRtreeSnapshot valid(buffer.data(), size);
+    valid.validate();
+}
+
+// Snapshots can be memory-mapped from a file
+template<>
+template<>
+void object::test<5>()
+{
+    const char* path = "STRtreeSnapshotTest.bin";
+
+    TemplateSTRtree<std::size_t> tree;
+    for (std::size_t i = 0; i < 1000; i++) {
+        double x = static_cast<double>(i % 50);
+        double y = static_cast<double>(i / 50);
+        tree.insert(geom::Envelope(x, x, y, y), i);
+    }
+    {
+        std::ofstream os(path, std::ios::binary);
+        STRtreeSnapshot::write(tree, os);
+    }
+
+    {
+        auto snapshot = STRtreeSnapshot::open(path);
+        ensure_equals(snapshot->getNumItems(), 1000u);
+        ensure(sorted(snapshot->query(geom::Envelope(0.5, 1.5, 0.5, 2.5))) == std::vector<std::uint64_t>{51, 101});
+    }
+
+    std::remove(path);
+
+    ensure_THROW(STRtreeSnapshot::open(path), util::GEOSException);
+}
+
+} // namespace tut
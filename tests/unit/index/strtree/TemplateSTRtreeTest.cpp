@@ -8,7 +8,12 @@
 #include <geos/index/ItemVisitor.h>
 #include <geos/io/WKTReader.h>
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <mutex>
+#include <random>
+#include <vector>
 
 using namespace geos;
 using geos::index::strtree::TemplateSTRtree;
@@ -475,5 +480,233 @@ void object::test<11>()
 }
 
 
+// A tree built in parallel returns the same query results as a tree built sequentially
+template<>
+template<>
+void object::test<12>()
+{
+    std::default_random_engine eng(12345);
+    std::uniform_real_distribution<> coord(0, 1000);
+    std::uniform_int_distribution<> gridCoord(0, 99);
+
+    // Half of the envelopes are on a grid, so that many share their coordinates
+    std::vector<geom::Envelope> envelopes;
+    for (std::size_t i = 0; i < 150000; i++) {
+        double x = i % 2 ? coord(eng) : gridCoord(eng) * 10;
+        double y = i % 2 ? coord(eng) : gridCoord(eng) * 10;
+        envelopes.emplace_back(x, x + 2, y, y + 2);
+    }
+
+    TemplateSTRtree<std::size_t> sequential(10, envelopes.size());
+    TemplateSTRtree<std::size_t> parallel(10, envelopes.size(), 4);
+    for (std::size_t i = 0; i < envelopes.size(); i++) {
+        sequential.insert(envelopes[i], i);
+        parallel.insert(envelopes[i], i);
+    }
+    sequential.build();
+    parallel.build();
+
+    ensure_equals(parallel.getRoot()->getNumNodes(), sequential.getRoot()->getNumNodes());
+    ensure(parallel.getRoot()->getBounds() == sequential.getRoot()->getBounds());
+
+    for (std::size_t i = 0; i < 200; i++) {
+        double x = coord(eng);
+        double y = coord(eng);
+        geom::Envelope query(x, x + 25, y, y + 25);
+
+        std::vector<std::size_t> expected;
+        std::vector<std::size_t> actual;
+        sequential.query(query, [&expected](std::size_t item) { expected.push_back(item); });
+        parallel.query(query, [&actual](std::size_t item) { actual.push_back(item); });
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        ensure(expected == actual);
+    }
+}
+
+// join returns all pairs of items with intersecting bounds, sequentially and in parallel
+template<>
+template<>
+void object::test<13>()
+{
+    std::default_random_engine eng(12345);
+    std::uniform_real_distribution<> coord(0, 100);
+    std::uniform_real_distribution<> size(0, 3);
+
+    auto randomEnvelopes = [&](std::size_t n) {
+        std::vector<geom::Envelope> envelopes;
+        for (std::size_t i = 0; i < n; i++) {
+            double x = coord(eng);
+            double y = coord(eng);
+            envelopes.emplace_back(x, x + size(eng), y, y + size(eng));
+        }
+        return envelopes;
+    };
+
+    auto envelopes1 = randomEnvelopes(2000);
+    auto envelopes2 = randomEnvelopes(500);
+
+    std::vector<std::pair<std::size_t, std::size_t>> expected;
+    for (std::size_t i = 0; i < envelopes1.size(); i++) {
+        for (std::size_t j = 0; j < envelopes2.size(); j++) {
+            if (envelopes1[i].intersects(envelopes2[j])) {
+                expected.emplace_back(i, j);
+            }
+        }
+    }
+    ensure(!expected.empty());
+
+    TemplateSTRtree<std::size_t> tree1;
+    for (std::size_t i = 0; i < envelopes1.size(); i++) {
+        tree1.insert(envelopes1[i], i);
+    }
+    TemplateSTRtree<const geom::Envelope*> tree2(4);
+    for (const auto& e : envelopes2) {
+        tree2.insert(e, &e);
+    }
+
+    for (std::size_t numThreads : { 1u, 4u }) {
+        std::mutex mtx;
+        std::vector<std::pair<std::size_t, std::size_t>> actual;
+        tree1.join(tree2, [&](std::size_t i, const geom::Envelope* e) {
+            std::lock_guard<std::mutex> lock(mtx);
+            actual.emplace_back(i, static_cast<std::size_t>(e - envelopes2.data()));
+        }, numThreads);
+
+        std::sort(actual.begin(), actual.end());
+        ensure_equals(actual.size(), expected.size());
+        ensure(actual == expected);
+    }
+
+    // A visitor returning false stops the join
+    std::size_t visited = 0;
+    tree1.join(tree2, [&visited](std::size_t, const geom::Envelope*) {
+        visited++;
+        return visited < 3;
+    });
+    ensure_equals(visited, 3u);
+
+    // Joining with an empty tree visits nothing
+    TemplateSTRtree<std::size_t> empty;
+    tree1.join(empty, [](std::size_t, std::size_t) {
+        fail();
+    }, 4);
+}
+
+// nearestNeighbours and itemsWithinDistance return items in order of increasing distance
+template<>
+template<>
+void object::test<14>()
+{
+    Grid grid;
+    grid.nx = grid.ny = 20;
+    auto geoms = pointGrid(grid);
+    auto tree = makeTree<const geom::Point*>(geoms);
+
+    struct PointDistance {
+        double operator()(const geom::Point* a, const geom::Point* b) {
+            return a->distance(b);
+        };
+    };
+
+    auto gf = geom::GeometryFactory::create();
+    auto query = gf->createPoint(geom::Coordinate(5.2, 7.1));
+
+    std::vector<double> expected;
+    for (const auto& g : geoms) {
+        expected.push_back(g->distance(query.get()));
+    }
+    std::sort(expected.begin(), expected.end());
+
+    // Remove the nearest point
+    auto nearest = tree.nearestNeighbour<PointDistance>(*query->getEnvelopeInternal(), query.get());
+    ensure(tree.remove(*nearest->getEnvelopeInternal(), nearest));
+    expected.erase(expected.begin());
+
+    auto found = tree.nearestNeighbours<PointDistance>(*query->getEnvelopeInternal(), query.get(), 10);
+    ensure_equals(found.size(), 10u);
+    for (std::size_t i = 0; i < found.size(); i++) {
+        ensure(found[i] != nearest);
+        ensure_equals(found[i]->distance(query.get()), expected[i]);
+    }
+
+    // k larger than the number of items
+    found = tree.nearestNeighbours<PointDistance>(*query->getEnvelopeInternal(), query.get(), 1000);
+    ensure_equals(found.size(), geoms.size() - 1);
+
+    // Items within a distance
+    found = tree.itemsWithinDistance<PointDistance>(*query->getEnvelopeInternal(), query.get(), 1.5);
+    auto numWithin = static_cast<std::size_t>(std::upper_bound(expected.begin(), expected.end(), 1.5) - expected.begin());
+    ensure_equals(found.size(), numWithin);
+    for (std::size_t i = 0; i < found.size(); i++) {
+        ensure_equals(found[i]->distance(query.get()), expected[i]);
+    }
+
+    // Empty tree
+    TemplateSTRtree<const geom::Point*> empty;
+    ensure(empty.nearestNeighbours<PointDistance>(*query->getEnvelopeInternal(), query.get(), 3).empty());
+}
+
+// A one-dimensional tree built in parallel returns the same query results
+// as a tree built sequentially
+template<>
+template<>
+void object::test<15>()
+{
+    using index::strtree::Interval;
+    using index::strtree::IntervalTraits;
+
+    std::default_random_engine eng(12345);
+    std::uniform_real_distribution<> coord(0, 100000);
+
+    std::vector<Interval> intervals;
+    for (std::size_t i = 0; i < 100000; i++) {
+        double x = coord(eng);
+        intervals.emplace_back(x, x + 2);
+    }
+
+    TemplateSTRtree<std::size_t, IntervalTraits> sequential(10, intervals.size());
+    TemplateSTRtree<std::size_t, IntervalTraits> parallel(10, intervals.size(), 4);
+    for (std::size_t i = 0; i < intervals.size(); i++) {
+        sequential.insert(intervals[i], i);
+        parallel.insert(intervals[i], i);
+    }
+    sequential.build();
+    parallel.build();
+
+    ensure_equals(parallel.getRoot()->getNumNodes(), sequential.getRoot()->getNumNodes());
+    ensure(parallel.getRoot()->getBounds().equals(&sequential.getRoot()->getBounds()));
+
+    for (std::size_t i = 0; i < 200; i++) {
+        double x = coord(eng);
+        Interval query(x, x + 25);
+
+        std::vector<std::size_t> expected;
+        std::vector<std::size_t> actual;
+        sequential.query(query, [&expected](std::size_t item) { expected.push_back(item); });
+        parallel.query(query, [&actual](std::size_t item) { actual.push_back(item); });
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        ensure(expected == actual);
+    }
+
+    // The parents of the leaves are as compact as in the sequential build,
+    // which they are not if the leaves of a slice are left unordered
+    using Node = decltype(sequential)::Node;
+    std::function<double(const Node&)> leafParentWidth = [&leafParentWidth](const Node& node) {
+        if (node.beginChildren()->isLeaf()) {
+            return node.getBounds().getWidth();
+        }
+        double width = 0;
+        for (const Node* child = node.beginChildren(); child < node.endChildren(); ++child) {
+            width += leafParentWidth(*child);
+        }
+        return width;
+    };
+    ensure(leafParentWidth(*parallel.getRoot()) <= 1.01 * leafParentWidth(*sequential.getRoot()));
+}
+
 } // namespace tut
 
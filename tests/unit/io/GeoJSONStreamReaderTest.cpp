@@ -0,0 +1,180 @@
+//
+// Test Suite for geos::io::GeoJSONStreamReader
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/io/GeoJSONReader.h>
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Geometry.h>
+// std
+#include <sstream>
+#include <string>
+#include <vector>
+
+using geos::io::GeoJSONFeature;
+using geos::io::GeoJSONStreamReader;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_geojsonstreamreader_data {
+    geos::io::GeoJSONReader reader;
+    GeoJSONStreamReader streamReader;
+
+    std::vector<GeoJSONFeature> readFeatures(const std::string& geojson) {
+        std::vector<GeoJSONFeature> features;
+        streamReader.readFeatures(geojson, [&features](GeoJSONFeature&& f) {
+            features.push_back(std::move(f));
+        });
+        return features;
+    }
+
+    // Checks that features are read as GeoJSONReader::readFeatures reads them
+    void checkFeatures(const std::string& geojson) {
+        auto expected = reader.readFeatures(geojson).getFeatures();
+        auto actual = readFeatures(geojson);
+
+        ensure_equals(actual.size(), expected.size());
+        for (std::size_t i = 0; i < actual.size(); i++) {
+            ensure(actual[i].getGeometry()->equalsIdentical(expected[i].getGeometry()));
+            ensure_equals(actual[i].getGeometry()->getCoordinateDimension(),
+                          expected[i].getGeometry()->getCoordinateDimension());
+            ensure_equals(actual[i].getId(), expected[i].getId());
+            ensure_equals(actual[i].getProperties().size(), expected[i].getProperties().size());
+        }
+    }
+};
+
+typedef test_group<test_geojsonstreamreader_data> group;
+typedef group::object object;
+
+group test_geojsonstreamreader_group("geos::io::GeoJSONStreamReader");
+
+//
+// Test Cases
+//
+
+// All geometry types, as documents and as features
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::vector<std::string> geometries {
+        "{\"type\":\"Point\",\"coordinates\":[1,2]}",
+        "{\"type\":\"Point\",\"coordinates\":[1,2,3]}",
+        "{\"type\":\"Point\",\"coordinates\":[]}",
+        "{\"type\":\"LineString\",\"coordinates\":[[1,2],[3,4,5]]}",
+        "{\"type\":\"LineString\",\"coordinates\":[]}",
+        "{\"type\":\"Polygon\",\"coordinates\":[[[0,0],[10,0],[10,10],[0,0]],[[1,1],[2,1],[2,2],[1,1]]]}",
+        "{\"type\":\"Polygon\",\"coordinates\":[]}",
+        "{\"type\":\"MultiPoint\",\"coordinates\":[[1,2],[3,4]]}",
+        "{\"type\":\"MultiLineString\",\"coordinates\":[[[1,2],[3,4]],[[5,6],[7,8]]]}",
+        "{\"type\":\"MultiPolygon\",\"coordinates\":[[[[0,0],[1,0],[1,1],[0,0]]],[[[5,5],[6,5],[6,6],[5,5]]]]}",
+        "{\"type\":\"GeometryCollection\",\"geometries\":[{\"type\":\"Point\",\"coordinates\":[1,2]},"
+        "{\"type\":\"GeometryCollection\",\"geometries\":[]}]}"
+    };
+
+    std::string collection = "{\"type\":\"FeatureCollection\",\"features\":[";
+    for (std::size_t i = 0; i < geometries.size(); i++) {
+        checkFeatures(geometries[i]);
+        std::string feature = "{\"type\":\"Feature\",\"id\":" + std::to_string(i)
+                              + ",\"geometry\":" + geometries[i] + ",\"properties\":null}";
+        checkFeatures(feature);
+        collection += (i ? "," : "") + feature;
+    }
+    collection += "]}";
+    checkFeatures(collection);
+}
+
+// Members in any order, with properties and unknown members
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::string geojson = "{\"features\":["
+                          "{\"properties\":{\"name\":\"a\",\"n\":1.5,\"flag\":true,\"none\":null,"
+                          "\"list\":[1,\"x\",[2]],\"obj\":{\"k\":\"v\"}},"
+                          "\"bbox\":[0,0,1,1],\"geometry\":{\"coordinates\":[1,2],\"type\":\"Point\"},"
+                          "\"id\":\"f1\",\"type\":\"Feature\"}],"
+                          "\"crs\":{\"type\":\"name\",\"properties\":{\"name\":\"x\"}},"
+                          "\"type\":\"FeatureCollection\"}";
+    checkFeatures(geojson);
+
+    auto features = readFeatures(geojson);
+    const auto& props = features[0].getProperties();
+    ensure_equals(features[0].getId(), "f1");
+    ensure_equals(props.at("name").getString(), "a");
+    ensure_equals(props.at("n").getNumber(), 1.5);
+    ensure(props.at("flag").getBoolean());
+    ensure(props.at("none").isNull());
+    ensure_equals(props.at("list").getArray().size(), 3u);
+    ensure(props.at("list").getArray()[2].isArray());
+    ensure_equals(props.at("obj").getObject().at("k").getString(), "v");
+}
+
+// Geometries are read without properties
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::istringstream is("{\"type\":\"FeatureCollection\",\"features\":["
+                          "{\"type\":\"Feature\",\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]},\"properties\":{\"a\":[1]}},"
+                          "{\"type\":\"Feature\",\"geometry\":{\"type\":\"Point\",\"coordinates\":[3,4]}}]}");
+    std::vector<std::string> wkt;
+    streamReader.readGeometries(is, [&wkt](std::unique_ptr<geos::geom::Geometry>&& g) {
+        wkt.push_back(g->toText());
+    });
+    ensure_equals(wkt.size(), 2u);
+    ensure_equals(wkt[0], "POINT (1 2)");
+    ensure_equals(wkt[1], "POINT (3 4)");
+}
+
+// Invalid documents throw
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::vector<std::string> invalid {
+        "{\"type\":\"Point\",\"coordinates\":[1]}",
+        "{\"type\":\"Point\",\"coordinates\":[1,2,3,4]}",
+        "{\"type\":\"LineString\",\"coordinates\":[[[1,2]]]}",
+        "{\"type\":\"Polygon\",\"coordinates\":[[1,2]]}",
+        "{\"type\":\"Curve\",\"coordinates\":[[1,2]]}",
+        "{\"type\":\"Feature\",\"geometry\":null,\"properties\":null}",
+        "{\"type\":\"Feature\",\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]}}",
+        "{\"type\":\"Point\",\"features\":[]}",
+        "{\"type\":\"Point\",\"coordinates\":[1,2]",
+        "{\"type\":\"Point\",\"coordinates\":[1,x]}"
+    };
+    for (const auto& geojson : invalid) {
+        ensure_THROW(readFeatures(geojson), geos::io::ParseException);
+    }
+}
+
+// Numeric ids
+template<>
+template<>
+void object::test<5>
+()
+{
+    auto features = readFeatures("{\"type\":\"FeatureCollection\",\"features\":["
+                                 "{\"type\":\"Feature\",\"id\":-7,\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]},\"properties\":null},"
+                                 "{\"type\":\"Feature\",\"id\":18446744073709551615,\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]},\"properties\":null},"
+                                 "{\"type\":\"Feature\",\"id\":1.50,\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]},\"properties\":{\"n\":1.50}}]}");
+    ensure_equals(features.size(), 3u);
+    ensure_equals(features[0].getId(), "-7");
+    ensure_equals(features[1].getId(), "18446744073709551615");
+    ensure_equals(features[2].getId(), "1.50");
+    ensure_equals(features[2].getProperties().at("n").getNumber(), 1.5);
+}
+
+} // namespace tut
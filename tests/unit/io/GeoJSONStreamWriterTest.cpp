@@ -0,0 +1,166 @@
+//
+// Test Suite for geos::io::GeoJSONStreamWriter
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/io/GeoJSONReader.h>
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/Writer.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalStateException.h>
+// std
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using geos::io::GeoJSONStreamWriter;
+using geos::io::GeoJSONValue;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_geojsonstreamwriter_data {
+    geos::io::WKTReader wktreader;
+    geos::io::GeoJSONReader geojsonreader;
+
+    std::string writeGeometry(const std::string& wkt) {
+        std::ostringstream os;
+        {
+            GeoJSONStreamWriter writer(os);
+            writer.writeGeometry(*wktreader.read(wkt));
+        }
+        return os.str();
+    }
+};
+
+typedef test_group<test_geojsonstreamwriter_data> group;
+typedef group::object object;
+
+group test_geojsonstreamwriter_group("geos::io::GeoJSONStreamWriter");
+
+//
+// Test Cases
+//
+
+// Geometries
+template<>
+template<>
+void object::test<1>
+()
+{
+    ensure_equals(writeGeometry("POINT (1 2.5)"), "{\"type\":\"Point\",\"coordinates\":[1,2.5]}");
+    ensure_equals(writeGeometry("POINT Z (1 2 3)"), "{\"type\":\"Point\",\"coordinates\":[1,2,3]}");
+    ensure_equals(writeGeometry("POINT EMPTY"), "{\"type\":\"Point\",\"coordinates\":[]}");
+    ensure_equals(writeGeometry("LINESTRING (0.1 0.2, 123456.789 -1e-7)"),
+                  "{\"type\":\"LineString\",\"coordinates\":[[0.1,0.2],[123456.789,-1e-7]]}");
+    ensure_equals(writeGeometry("MULTIPOINT ((1 1), EMPTY, (2 2))"),
+                  "{\"type\":\"MultiPoint\",\"coordinates\":[[1,1],[2,2]]}");
+    ensure_equals(writeGeometry("GEOMETRYCOLLECTION (POINT (1 1), GEOMETRYCOLLECTION EMPTY)"),
+                  "{\"type\":\"GeometryCollection\",\"geometries\":[{\"type\":\"Point\",\"coordinates\":[1,1]},"
+                  "{\"type\":\"GeometryCollection\",\"geometries\":[]}]}");
+
+    // Round trip through GeoJSONReader
+    for (const char* wkt : {
+        "POLYGON ((0 0, 10 0, 10 10, 0 0), (1 1, 2 1, 2 2, 1 1))",
+        "MULTILINESTRING ((0 0, 1 1), (2 2, 3 3))",
+        "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 6 5, 6 6, 5 5)))",
+        "LINESTRING Z (0 0 1, 1 1 2)"
+    }) {
+        auto g = wktreader.read(wkt);
+        auto result = geojsonreader.read(writeGeometry(wkt));
+        ensure(std::string(wkt), result->equalsIdentical(g.get()));
+    }
+}
+
+// A FeatureCollection, written to a Writer
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::map<std::string, GeoJSONValue> properties {
+        { "name", GeoJSONValue(std::string("a \"quoted\"\n\x01 name")) },
+        { "n", GeoJSONValue(0.1) },
+        { "flag", GeoJSONValue(false) },
+        { "none", GeoJSONValue() },
+        { "list", GeoJSONValue(std::vector<GeoJSONValue>{ GeoJSONValue(1.0), GeoJSONValue(std::string("x")) }) }
+    };
+
+    geos::io::Writer out;
+    {
+        GeoJSONStreamWriter writer(out);
+        writer.setRoundingPrecision(2);
+        writer.beginFeatureCollection();
+        for (int i = 0; i < 3; i++) {
+            writer.writeFeature(*wktreader.read("POINT (1.23456 2)"), properties, std::to_string(i));
+        }
+        writer.endFeatureCollection();
+    }
+
+    auto features = geojsonreader.readFeatures(out.toString()).getFeatures();
+    ensure_equals(features.size(), 3u);
+    ensure_equals(features[2].getId(), "2");
+    ensure_equals(features[0].getGeometry()->toText(), "POINT (1.23 2)");
+    const auto& props = features[1].getProperties();
+    ensure_equals(props.at("name").getString(), "a \"quoted\"\n\x01 name");
+    ensure_equals(props.at("n").getNumber(), 0.1);
+    ensure(!props.at("flag").getBoolean());
+    ensure(props.at("none").isNull());
+    ensure_equals(props.at("list").getArray()[1].getString(), "x");
+}
+
+// Output dimension, and invalid use
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::ostringstream os;
+    GeoJSONStreamWriter writer(os);
+    writer.setOutputDimension(2);
+    writer.writeGeometry(*wktreader.read("POINT Z (1 2 3)"));
+    writer.flush();
+    ensure_equals(os.str(), "{\"type\":\"Point\",\"coordinates\":[1,2]}");
+
+    ensure_THROW(writer.endFeatureCollection(), geos::util::IllegalStateException);
+    writer.beginFeatureCollection();
+    ensure_THROW(writer.beginFeatureCollection(), geos::util::IllegalStateException);
+    ensure_THROW(writer.writeGeometry(*wktreader.read("POINT (1 1)")), geos::util::IllegalStateException);
+    writer.endFeatureCollection();
+}
+
+// Property numbers are written with the fewest digits that round-trip
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::vector<double> values { 0.00012345678901234567, 1e-300, 0.1, 1.0 / 3, 123456789012345678.0, -2.5 };
+
+    std::map<std::string, GeoJSONValue> properties;
+    for (std::size_t i = 0; i < values.size(); i++) {
+        properties["n" + std::to_string(i)] = GeoJSONValue(values[i]);
+    }
+
+    std::ostringstream os;
+    {
+        GeoJSONStreamWriter writer(os);
+        writer.writeFeature(*wktreader.read("POINT (1 2)"), properties, "");
+    }
+    ensure(os.str().find("\"n0\":0.00012345678901234567") != std::string::npos);
+    ensure(os.str().find("\"n2\":0.1,") != std::string::npos);
+
+    auto features = geojsonreader.readFeatures(os.str()).getFeatures();
+    const auto& props = features[0].getProperties();
+    for (std::size_t i = 0; i < values.size(); i++) {
+        ensure_equals(props.at("n" + std::to_string(i)).getNumber(), values[i]);
+    }
+}
+
+} // namespace tut
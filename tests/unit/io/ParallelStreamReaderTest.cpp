@@ -0,0 +1,127 @@
+//
+// Test Suite for geos::io::ParallelStreamReader
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/io/ParallelStreamReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/geom/Geometry.h>
+// std
+#include <sstream>
+#include <string>
+#include <vector>
+
+using geos::io::ParallelStreamReader;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_parallelstreamreader_data {
+    geos::io::WKTReader wktreader;
+
+    // Lines split over two lines of text, with distinct coordinates
+    // so that the order can be checked
+    static std::string makeWKT(std::size_t n) {
+        std::string s;
+        for (std::size_t i = 0; i < n; i++) {
+            s += "LINESTRING (" + std::to_string(i) + " 0,\n" + std::to_string(i) + " 1)\n";
+        }
+        return s;
+    }
+
+    void checkOrder(ParallelStreamReader& rdr, std::size_t n) {
+        std::size_t i = 0;
+        for (auto& g : rdr) {
+            ensure_equals(g->getCoordinates()->getX(0), static_cast<double>(i));
+            i++;
+        }
+        ensure_equals(i, n);
+        ensure(rdr.next() == nullptr);
+    }
+};
+
+typedef test_group<test_parallelstreamreader_data> group;
+typedef group::object object;
+
+group test_parallelstreamreader_group("geos::io::ParallelStreamReader");
+
+//
+// Test Cases
+//
+
+// Multi-line WKT records are returned in stream order
+template<>
+template<>
+void object::test<1>
+()
+{
+    for (std::size_t numThreads : { 1u, 2u, 4u }) {
+        std::istringstream in(makeWKT(1000));
+        ParallelStreamReader rdr(in, ParallelStreamReader::Format::WKT, numThreads, 8);
+        checkOrder(rdr, 1000);
+    }
+}
+
+// Hex WKB records
+template<>
+template<>
+void object::test<2>
+()
+{
+    geos::io::WKBWriter writer;
+    std::stringstream hex;
+    auto geoms = wktreader.read("GEOMETRYCOLLECTION (POINT (1 2), POLYGON ((0 0, 1 0, 1 1, 0 0)), POINT EMPTY)");
+    for (std::size_t i = 0; i < geoms->getNumGeometries(); i++) {
+        writer.writeHEX(*geoms->getGeometryN(i), hex);
+        hex << std::endl;
+    }
+
+    ParallelStreamReader rdr(hex, ParallelStreamReader::Format::WKB_HEX, 3);
+    for (std::size_t i = 0; i < geoms->getNumGeometries(); i++) {
+        auto g = rdr.next();
+        ensure(g != nullptr);
+        ensure(g->equalsIdentical(geoms->getGeometryN(i)));
+    }
+    ensure(rdr.next() == nullptr);
+}
+
+// A record which cannot be parsed throws in order, and reading continues
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::istringstream in("POINT (1 1)\nPOINT (2 2\n)\nLINESTRING (1 x)\nPOINT (3 3)\n");
+    ParallelStreamReader rdr(in, ParallelStreamReader::Format::WKT, 2);
+
+    ensure_equals(rdr.next()->getCoordinates()->getX(0), 1.0);
+    ensure_equals(rdr.next()->getCoordinates()->getX(0), 2.0);
+    ensure_THROW(rdr.next(), geos::io::ParseException);
+    ensure_equals(rdr.next()->getCoordinates()->getX(0), 3.0);
+    ensure(rdr.next() == nullptr);
+}
+
+// A reader may be destroyed before the stream has been read
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::istringstream in(makeWKT(10000));
+    {
+        ParallelStreamReader rdr(in, ParallelStreamReader::Format::WKT, 4, 16);
+        ensure(rdr.next() != nullptr);
+    }
+    std::istringstream empty("");
+    ParallelStreamReader rdr(empty, ParallelStreamReader::Format::WKT, 2);
+    ensure(rdr.begin() == rdr.end());
+}
+
+} // namespace tut
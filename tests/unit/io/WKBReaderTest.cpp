@@ -11,6 +11,7 @@
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKBConstants.h>
 #include <geos/io/WKBWriter.h>
+#include <geos/io/ParseException.h>
 #include <geos/io/WKTReader.h>
 #include <geos/geom/CompoundCurve.h>
 #include <geos/geom/CurvePolygon.h>
@@ -22,6 +23,7 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace tut {
 //
@@ -838,5 +840,63 @@ void object::test<36>
                    "ParseException: Expected SimpleCurve but got Point");
 }
 
-} // namespace tut
+// Coordinates of all dimensions are read in either byte order
+template<>
+template<>
+void object::test<37>
+()
+{
+    auto floating = geos::geom::GeometryFactory::create();
+    geos::io::WKTReader reader(*floating);
+    geos::io::WKBReader floatingReader(*floating);
+
+    std::vector<std::string> wkts {
+        "POINT (1.5 2.5)",
+        "POINT M (1.5 2.5 3.5)",
+        "LINESTRING (1.5 2.5, 3.5 4.5, 5.5 6.5)",
+        "LINESTRING Z (1.5 2.5 3.5, 4.5 5.5 6.5)",
+        "LINESTRING M (1.5 2.5 3.5, 4.5 5.5 6.5)",
+        "LINESTRING ZM (1.5 2.5 3.5 4.5, 5.5 6.5 7.5 8.5)",
+        "POLYGON M ((0 0 1, 10 0 2, 10 10 3, 0 0 4), (1 1 5, 2 1 6, 2 2 7, 1 1 8))",
+        "MULTIPOINT Z ((1.5 2.5 3.5), (4.5 5.5 6.5))"
+    };
+
+    for (const auto& wkt : wkts) {
+        auto expected = reader.read(wkt);
+
+        for (int byteOrder : { geos::io::WKBConstants::wkbXDR, geos::io::WKBConstants::wkbNDR }) {
+            geos::io::WKBWriter writer(4, byteOrder, false, geos::io::WKBConstants::wkbIso);
+            std::stringstream wkb;
+            writer.write(*expected, wkb);
+            std::string buf = wkb.str();
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(buf.data());
+
+            auto g = floatingReader.read(bytes, buf.size());
+            ensure(wkt, g->equalsIdentical(expected.get()));
+
+            // The precision model only applies to X and Y
+            auto fixed = wkbreader.read(bytes, buf.size());
+            auto fixedCoords = fixed->getCoordinates();
+            auto coords = g->getCoordinates();
+            ensure_equals(fixedCoords->size(), coords->size());
+            for (std::size_t i = 0; i < coords->size(); i++) {
+                CoordinateXYZM c, f;
+                coords->getAt(i, c);
+                fixedCoords->getAt(i, f);
+                c.x = pm.makePrecise(c.x);
+                c.y = pm.makePrecise(c.y);
+                ensure(wkt, f.equals4D(c));
+            }
+
+            // Truncated input
+            try {
+                wkbreader.read(bytes, buf.size() - 1);
+                fail("truncated WKB parsed");
+            }
+            catch (const geos::io::ParseException&) {
+            }
+        }
+    }
+}
 
+} // namespace tut
@@ -4,6 +4,7 @@
 // tut
 #include <tut/tut.hpp>
 // geos
+#include <geos/io/StringTokenizer.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/geom/PrecisionModel.h>
@@ -17,7 +18,12 @@
 #include <geos/util/GEOSException.h>
 #include <geos/util/IllegalArgumentException.h>
 // std
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <random>
 
 namespace tut {
 //
@@ -473,4 +479,54 @@ void object::test<24>
     ensure_equals(geom->getNumGeometries(), 3u);
 }
 
+// Numbers are parsed to the same values as by strtod
+template<>
+template<>
+void object::test<25>
+()
+{
+    using geos::io::StringTokenizer;
+
+    auto check = [](const char* s) {
+        double expected = std::strtod(s, nullptr);
+        double actual = 0;
+        ensure(s, StringTokenizer::readDouble(s, s + std::strlen(s), actual));
+        if (std::isnan(expected)) {
+            ensure(s, std::isnan(actual));
+        }
+        else {
+            ensure_equals(s, actual, expected);
+            ensure_equals(s, std::signbit(actual), std::signbit(expected));
+        }
+    };
+
+    for (const char* s : { "0", "-0", "+1.5", "1.", ".5", "00012", "1e5", "1E-5", "12e+3",
+                           "123456789012345678901234567890", "0.30000000000000004",
+                           "4.9e-324", "2.2250738585072011e-308", "1.7976931348623157e308",
+                           "1e309", "-1e400", "1e-400", "9007199254740993", "inf", "-Infinity", "nan" }) {
+        check(s);
+    }
+
+    std::mt19937_64 eng(42);
+    std::uniform_real_distribution<double> dist(-1e7, 1e7);
+    char buf[64];
+    for (int i = 0; i < 20000; i++) {
+        double d = dist(eng);
+        std::snprintf(buf, sizeof(buf), "%.*g", 1 + i % 17, d);
+        check(buf);
+        std::snprintf(buf, sizeof(buf), "%.*f", i % 12, d / 1e4);
+        check(buf);
+    }
+
+    double d;
+    for (const char* s : { "", "-", ".", "e5", "1e", "1e+", "1.2.3", "1-2", "EMPTY" }) {
+        ensure(s, !StringTokenizer::readDouble(s, s + std::strlen(s), d));
+    }
+
+    geos::io::WKTReader reader;
+    GeomPtr geom(reader.read("POINT (-1.25e-3 17.0000000000000001)"));
+    ensure_equals(geom->getCoordinates()->getX(0), -1.25e-3);
+    ensure_equals(geom->getCoordinates()->getY(0), 17.0);
+}
+
 } // namespace tut
@@ -126,6 +126,49 @@ create_discs(geos::geom::GeometryFactory& gf, int num, double radius,
     }
 }
 
+// Parallel union produces exactly the serial result
+template<>
+template<>
+void object::test<2>
+()
+{
+    using geos::operation::geounion::CascadedPolygonUnion;
+    using geos::operation::geounion::ClassicUnionStrategy;
+
+    std::vector<geos::geom::Polygon*> g;
+    create_discs(const_cast<geos::geom::GeometryFactory&>(gf), 12, 0.7, &g);
+
+    ClassicUnionStrategy unionFun;
+    auto serial = CascadedPolygonUnion::Union(&g, &unionFun, 1);
+    auto parallel = CascadedPolygonUnion::Union(&g, &unionFun, 4);
+
+    ensure(parallel->isValid());
+    ensure(parallel->equalsExact(serial.get()));
+
+    for_each(g.begin(), g.end(), delete_geometry);
+}
+
+// Parallel union with fewer inputs than a section
+template<>
+template<>
+void object::test<3>
+()
+{
+    using geos::operation::geounion::CascadedPolygonUnion;
+
+    std::vector<geos::geom::Polygon*> g;
+    create_discs(const_cast<geos::geom::GeometryFactory&>(gf), 2, 0.7, &g);
+
+    CascadedPolygonUnion op(&g);
+    op.setNumThreads(0);
+    auto result = op.Union();
+    auto expected = CascadedPolygonUnion::Union(&g);
+
+    ensure(result->equalsExact(expected.get()));
+
+    for_each(g.begin(), g.end(), delete_geometry);
+}
+
 // these tests currently fail because the geometries generated by the different
 // union algorithms are slightly different. In order to make those tests pass
 // we need to port the similarity measure classes from JTS, allowing to
@@ -5,6 +5,8 @@
 #include <utility.h>
 
 // geos
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryFactory.h>
 #include <geos/operation/overlayng/OverlayNG.h>
 
 // std
@@ -582,4 +584,37 @@ void object::test<45> ()
     testOverlay(a, b, exp, OverlayNG::INTERSECTION, 0);
 }
 
+template<>
+template<>
+void object::test<46> ()
+{
+    set_test_name("testParallelNodingSameResult");
+
+    // Zigzag lines with many monotone chains and many crossings
+    auto gf = GeometryFactory::create();
+    CoordinateSequence seqA, seqB;
+    for (int i = 0; i < 3000; i++) {
+        seqA.add(CoordinateXY(i, (i % 2) * 10));
+        seqB.add(CoordinateXY(i + 0.5, 5 + ((i % 3) - 1) * 7));
+    }
+    std::unique_ptr<Geometry> a = gf->createLineString(seqA.clone());
+    std::unique_ptr<Geometry> b = gf->createLineString(seqB.clone());
+    auto aPoly = a->buffer(0.25, 2);
+    auto bPoly = b->buffer(0.25, 2);
+
+    for (int opCode : { OverlayNG::UNION, OverlayNG::INTERSECTION }) {
+        for (auto& input : { std::make_pair(a.get(), b.get()), std::make_pair(aPoly.get(), bPoly.get()) }) {
+            PrecisionModel pm;
+            OverlayNG sequential(input.first, input.second, &pm, opCode);
+            auto expected = sequential.getResult();
+
+            OverlayNG parallel(input.first, input.second, &pm, opCode);
+            parallel.setNumThreads(4);
+            auto actual = parallel.getResult();
+
+            ensure(expected->equalsExact(actual.get()));
+        }
+    }
+}
+
 } // namespace tut
@@ -0,0 +1,152 @@
+//
+// Test Suite for geos::operation::overlayng::TiledOverlayNG class.
+
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/operation/overlayng/TiledOverlayNG.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+
+// std
+#include <memory>
+
+using geos::geom::Geometry;
+using geos::io::WKTReader;
+using geos::operation::overlayng::OverlayNG;
+using geos::operation::overlayng::OverlayNGRobust;
+using geos::operation::overlayng::TiledOverlayNG;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_tiledoverlayng_data {
+
+    WKTReader r;
+
+    // A polygon with holes which crosses the cells of a grid
+    std::unique_ptr<Geometry> geomA = r.read(
+        "MULTIPOLYGON (((0 0, 100 0, 100 100, 0 100, 0 0), (10 10, 10 40, 40 40, 40 10, 10 10), (60 60, 60 90, 90 90, 90 60, 60 60)), ((120 0, 140 0, 140 20, 120 0)))");
+    std::unique_ptr<Geometry> geomB = r.read(
+        "POLYGON ((50 -20, 130 30, 50 120, -30 50, 50 -20), (50 20, 20 50, 50 80, 80 50, 50 20))");
+
+    void
+    checkTiled(const Geometry* a, const Geometry* b, int opCode,
+               std::size_t nx, std::size_t ny, std::size_t numThreads)
+    {
+        auto expected = OverlayNGRobust::Overlay(a, b, opCode);
+
+        TiledOverlayNG ov(a, b, opCode);
+        ov.setGridSize(nx, ny);
+        ov.setNumThreads(numThreads);
+        auto actual = ov.getResult();
+
+        ensure("result is valid", actual->isValid());
+        ensure_equals("result area", actual->getArea(), expected->getArea(), 1e-9 * expected->getArea() + 1e-9);
+
+        auto diff = actual->symDifference(expected.get());
+        ensure("result equals untiled overlay", diff->getArea() < 1e-9 * expected->getArea() + 1e-9);
+    }
+};
+
+typedef test_group<test_tiledoverlayng_data> group;
+typedef group::object object;
+
+group test_tiledoverlayng_group("geos::operation::overlayng::TiledOverlayNG");
+
+//
+// Test Cases
+//
+
+// All operations on a grid, sequentially and in parallel
+template<>
+template<>
+void object::test<1> ()
+{
+    for (int opCode : { OverlayNG::INTERSECTION, OverlayNG::UNION,
+                        OverlayNG::DIFFERENCE, OverlayNG::SYMDIFFERENCE }) {
+        checkTiled(geomA.get(), geomB.get(), opCode, 3, 3, 1);
+        checkTiled(geomA.get(), geomB.get(), opCode, 7, 4, 4);
+        checkTiled(geomB.get(), geomA.get(), opCode, 5, 5, 2);
+    }
+}
+
+// Polygons which are split by cell sides are stitched back together
+template<>
+template<>
+void object::test<2> ()
+{
+    auto a = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto b = r.read("POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+
+    TiledOverlayNG ov(a.get(), b.get(), OverlayNG::UNION);
+    ov.setGridSize(4, 4);
+    auto result = ov.getResult();
+
+    ensure_equals(result->getGeometryTypeId(), geos::geom::GEOS_POLYGON);
+    ensure_equals(result->getArea(), 175.0);
+    ensure(result->equals(r.read("POLYGON ((0 0, 10 0, 10 5, 15 5, 15 15, 5 15, 5 10, 0 10, 0 0))").get()));
+}
+
+// Inputs which cannot be tiled use a plain overlay
+template<>
+template<>
+void object::test<3> ()
+{
+    auto line = r.read("LINESTRING (-10 50, 150 50)");
+    auto result = TiledOverlayNG::overlay(line.get(), geomA.get(), OverlayNG::INTERSECTION, 2);
+    auto expected = OverlayNGRobust::Overlay(line.get(), geomA.get(), OverlayNG::INTERSECTION);
+    ensure_equals_geometry(result.get(), expected.get());
+
+    auto empty = r.read("POLYGON EMPTY");
+    result = TiledOverlayNG::overlay(empty.get(), geomA.get(), OverlayNG::UNION, 2);
+    ensure_equals(result->getArea(), geomA->getArea());
+}
+
+// Disjoint inputs, and cells containing no input
+template<>
+template<>
+void object::test<4> ()
+{
+    auto a = r.read("MULTIPOLYGON (((0 0, 1 0, 1 1, 0 1, 0 0)), ((99 99, 100 99, 100 100, 99 100, 99 99)))");
+    auto b = r.read("POLYGON ((0 99, 1 99, 1 100, 0 100, 0 99))");
+
+    checkTiled(a.get(), b.get(), OverlayNG::UNION, 10, 10, 3);
+    checkTiled(a.get(), b.get(), OverlayNG::DIFFERENCE, 10, 10, 3);
+
+    TiledOverlayNG ov(a.get(), b.get(), OverlayNG::INTERSECTION);
+    ov.setGridSize(10, 10);
+    auto result = ov.getResult();
+    ensure(result->isEmpty());
+}
+
+// Polygonal inputs give a polygonal result, whether or not they are tiled
+template<>
+template<>
+void object::test<5> ()
+{
+    auto a = r.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto b = r.read("POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))");
+    auto bz = r.read("POLYGON Z ((10 0 1, 20 0 1, 20 10 1, 10 10 1, 10 0 1))");
+
+    // Tiled, untiled because of a single cell, and untiled because of Z
+    TiledOverlayNG tiled(a.get(), b.get(), OverlayNG::INTERSECTION);
+    tiled.setGridSize(4, 4);
+    TiledOverlayNG single(a.get(), b.get(), OverlayNG::INTERSECTION);
+    single.setGridSize(1, 1);
+    TiledOverlayNG withZ(a.get(), bz.get(), OverlayNG::INTERSECTION);
+    withZ.setGridSize(4, 4);
+
+    for (TiledOverlayNG* ov : { &tiled, &single, &withZ }) {
+        auto result = ov->getResult();
+        ensure_equals(result->getGeometryTypeId(), geos::geom::GEOS_POLYGON);
+        ensure(result->isEmpty());
+    }
+}
+
+} // namespace tut
@@ -18,6 +18,8 @@
 #include <geos/geom/CoordinateSequence.h>
 //#include <stdio.h>
 
+#include <algorithm>
+
 using namespace geos::triangulate;
 using namespace geos::triangulate::quadedge;
 using namespace geos::geom;
@@ -370,4 +372,46 @@ void object::test<20>()
     checkDelaunayHull(wkt);
 }
 
+// Large inputs are inserted in a deterministic biased randomized order
+template<>
+template<>
+void object::test<21>()
+{
+    CoordinateSequence coords;
+    for (int i = 0; i < 40; i++) {
+        for (int j = 0; j < 50; j++) {
+            // a jittered grid, with some cocircular points
+            double dx = (i * j) % 7 == 0 ? 0 : 0.1 * ((i * 31 + j * 17) % 5);
+            coords.add(CoordinateXY(i + dx, j));
+        }
+    }
+
+    auto sameOrder = [](const IncrementalDelaunayTriangulator::VertexList& a,
+                        const IncrementalDelaunayTriangulator::VertexList& b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+            [](const Vertex& v1, const Vertex& v2) { return v1.equals(v2); });
+    };
+
+    auto vertices = DelaunayTriangulationBuilder::toVertices(coords);
+    auto order1 = vertices;
+    auto order2 = vertices;
+    DelaunayTriangulationBuilder::sortForInsertion(order1);
+    DelaunayTriangulationBuilder::sortForInsertion(order2);
+    ensure(sameOrder(order1, order2));
+    ensure(!sameOrder(order1, vertices));
+    std::sort(order1.begin(), order1.end());
+    std::sort(vertices.begin(), vertices.end());
+    ensure(sameOrder(order1, vertices));
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(coords);
+    auto tris = builder.getTriangles(*GeometryFactory::getDefaultInstance());
+
+    // The triangles cover the convex hull without overlapping
+    auto hull = geos::coverage::CoverageUnion::Union(tris.get());
+    auto sites = GeometryFactory::getDefaultInstance()->createMultiPoint(coords);
+    ensure(hull->equals(sites->convexHull().get()));
+    ensure_distance(tris->getArea(), hull->getArea(), 1e-9);
+}
+
 } // namespace tut
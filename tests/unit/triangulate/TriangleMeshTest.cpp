@@ -0,0 +1,145 @@
+//
+// Test Suite for geos::triangulate::TriangleMesh
+//
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+#include <utility.h>
+// geos
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKTReader.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/TriangleMesh.h>
+#include <geos/triangulate/polygon/ConstrainedDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/IllegalStateException.h>
+
+using geos::triangulate::TriangleMesh;
+using geos::triangulate::TriangleMeshBuilder;
+using geos::geom::Coordinate;
+using geos::geom::Geometry;
+using geos::geom::GeometryFactory;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_trianglemesh_data {
+    geos::io::WKTReader r;
+    const GeometryFactory& gf = *GeometryFactory::getDefaultInstance();
+
+    // Each interior edge must be shared with its neighbour
+    static void checkNeighbours(const TriangleMesh& mesh)
+    {
+        const auto& tris = mesh.getTriangles();
+        const auto& nbrs = mesh.getNeighbours();
+        ensure_equals(nbrs.size(), tris.size());
+        for (std::size_t t = 0; t < mesh.getNumTriangles(); t++) {
+            for (std::size_t i = 0; i < 3; i++) {
+                int32_t n = nbrs[3 * t + i];
+                if (n == TriangleMesh::NO_NEIGHBOUR) {
+                    continue;
+                }
+                auto nt = static_cast<std::size_t>(n);
+                bool isBack = false;
+                for (std::size_t j = 0; j < 3; j++) {
+                    if (nbrs[3 * nt + j] == static_cast<int32_t>(t)) {
+                        isBack = true;
+                        // the shared edge has the same vertices, reversed
+                        ensure_equals(tris[3 * nt + j], tris[3 * t + (i + 1) % 3]);
+                        ensure_equals(tris[3 * nt + (j + 1) % 3], tris[3 * t + i]);
+                    }
+                }
+                ensure(isBack);
+            }
+        }
+    }
+};
+
+typedef test_group<test_trianglemesh_data> group;
+typedef group::object object;
+
+group test_trianglemesh_group("geos::triangulate::TriangleMesh");
+
+//
+// Test Cases
+//
+
+// Shared vertices and neighbours of a square
+template<>
+template<>
+void object::test<1>()
+{
+    TriangleMeshBuilder builder;
+    builder.addTriangle(Coordinate(0, 0), Coordinate(1, 0), Coordinate(1, 1));
+    builder.addTriangle(Coordinate(0, 0), Coordinate(1, 1), Coordinate(0, 1));
+    std::unique_ptr<TriangleMesh> meshPtr = builder.getMesh();
+    TriangleMesh& mesh = *meshPtr;
+    ensure_THROW(builder.getMesh(), geos::util::IllegalStateException);
+
+    ensure_equals(mesh.getNumVertices(), 4u);
+    ensure_equals(mesh.getNumTriangles(), 2u);
+    ensure_equals(mesh.getTriangles()[3], 0);
+    ensure_equals(mesh.getTriangles()[4], 2);
+
+    const auto& nbrs = mesh.getNeighbours();
+    ensure_equals(nbrs[2], 1);
+    ensure_equals(nbrs[3], 0);
+    ensure_equals(nbrs[0], TriangleMesh::NO_NEIGHBOUR);
+    checkNeighbours(mesh);
+
+    ensure(mesh.getCoordinate(1, 2).equals2D(Coordinate(0, 1)));
+    ensure_THROW(mesh.getCoordinate(2, 0), geos::util::IllegalArgumentException);
+
+    // neighbours are recomputed after a triangle is added
+    mesh.addTriangle(1, mesh.addVertex(Coordinate(2, 0)), 2);
+    ensure_equals(mesh.getNeighbours()[1], 2);
+    ensure_THROW(mesh.addTriangle(0, 1, 5), geos::util::IllegalArgumentException);
+
+    auto expected = r.read("GEOMETRYCOLLECTION (POLYGON ((0 0, 1 0, 1 1, 0 0)), POLYGON ((0 0, 1 1, 0 1, 0 0)), POLYGON ((1 0, 2 0, 1 1, 1 0)))");
+    ensure(expected->equalsExact(mesh.toGeometry(gf).get()));
+}
+
+// Delaunay triangulation
+template<>
+template<>
+void object::test<2>()
+{
+    auto sites = r.read("MULTIPOINT Z ((10 10 1), (10 20 2), (20 20 3), (20 10 4), (20 0 5), (10 0 6), (0 0 7), (0 10 8), (0 20 9), (15 12 10))");
+
+    geos::triangulate::DelaunayTriangulationBuilder builder;
+    builder.setSites(*sites);
+    auto mesh = builder.getTriangleMesh();
+
+    ensure_equals(mesh->getNumVertices(), 10u);
+    ensure(mesh->getVertices().hasZ());
+    checkNeighbours(*mesh);
+
+    auto tris = builder.getTriangles(gf);
+    ensure_equals(mesh->getNumTriangles(), tris->getNumGeometries());
+    ensure_equals_geometry(tris.get(), mesh->toGeometry(gf).get());
+}
+
+// Constrained Delaunay triangulation
+template<>
+template<>
+void object::test<3>()
+{
+    using geos::triangulate::polygon::ConstrainedDelaunayTriangulator;
+
+    auto geom = r.read("MULTIPOLYGON (((10 90, 90 90, 90 10, 10 10, 10 90), (20 80, 50 70, 30 30, 20 80)), ((100 0, 110 0, 110 10, 100 0)))");
+    auto mesh = ConstrainedDelaunayTriangulator::triangulateToMesh(geom.get());
+    checkNeighbours(*mesh);
+
+    auto tris = ConstrainedDelaunayTriangulator::triangulate(geom.get());
+    ensure_equals(mesh->getNumTriangles(), tris->getNumGeometries());
+    ensure_equals_geometry(tris.get(), mesh->toGeometry(gf).get());
+
+    auto empty = r.read("POLYGON EMPTY");
+    ensure_equals(ConstrainedDelaunayTriangulator::triangulateToMesh(empty.get())->getNumTriangles(), 0u);
+}
+
+} // namespace tut
@@ -0,0 +1,223 @@
+//
+// Test Suite for geos::util::Arena
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/util/Arena.h>
+#include <geos/util/IllegalStateException.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using geos::util::Arena;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_arena_data {
+    geos::io::WKTReader reader;
+};
+
+typedef test_group<test_arena_data> group;
+typedef group::object object;
+
+group test_arena_group("geos::util::Arena");
+
+//
+// Test Cases
+//
+
+// Allocations are made from the active arena, and aligned
+template<>
+template<>
+void object::test<1>
+()
+{
+    Arena arena(256);
+    ensure(Arena::current() == nullptr);
+
+    std::vector<void*> ptrs;
+    {
+        Arena::Scope scope(&arena);
+        ensure(Arena::current() == &arena);
+
+        for (std::size_t size : { 1u, 7u, 16u, 100u, 1000u }) {
+            void* p = Arena::allocateCurrent(size);
+            ensure_equals(reinterpret_cast<std::uintptr_t>(p) % alignof(std::max_align_t), 0u);
+            ptrs.push_back(p);
+        }
+    }
+    ensure(Arena::current() == nullptr);
+
+    ensure_equals(arena.getNumAllocations(), 5u);
+    ensure(arena.getBytesUsed() >= 1124);
+    ensure(arena.getBytesReserved() >= arena.getBytesUsed());
+
+    for (void* p : ptrs) {
+        Arena::deallocate(p);
+    }
+    ensure_equals(arena.getNumAllocations(), 0u);
+}
+
+// reset reclaims memory once every allocation has been freed
+template<>
+template<>
+void object::test<2>
+()
+{
+    Arena arena(1024);
+    Arena::Scope scope(&arena);
+
+    // Does not fit in the first chunk
+    void* p = Arena::allocateCurrent(10000);
+    void* q = Arena::allocateCurrent(100000);
+    Arena::deallocate(q);
+
+    ensure_THROW(arena.reset(), geos::util::IllegalStateException);
+
+    Arena::deallocate(p);
+    std::size_t reserved = arena.getBytesReserved();
+    arena.reset();
+    ensure_equals(arena.getBytesUsed(), 0u);
+    ensure(arena.getBytesReserved() < reserved);
+
+    // Memory is reused after a reset
+    reserved = arena.getBytesReserved();
+    q = Arena::allocateCurrent(10);
+    ensure_equals(arena.getBytesReserved(), reserved);
+    Arena::deallocate(q);
+}
+
+// Nested scopes restore the previously active arena
+template<>
+template<>
+void object::test<3>
+()
+{
+    Arena a;
+    Arena b;
+    {
+        Arena::Scope sa(&a);
+        {
+            Arena::Scope sb(&b);
+            ensure(Arena::current() == &b);
+            {
+                Arena::Scope heap(nullptr);
+                ensure(Arena::current() == nullptr);
+            }
+            ensure(Arena::current() == &b);
+        }
+        ensure(Arena::current() == &a);
+    }
+    ensure(Arena::current() == nullptr);
+}
+
+// Geometries and their coordinates are allocated from the active arena,
+// and may be freed outside of the scope, on another thread, or after the
+// arena has been destroyed
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::unique_ptr<geos::geom::Geometry> g1, g2, g3;
+    {
+        std::unique_ptr<Arena> arena(new Arena());
+        {
+            Arena::Scope scope(arena.get());
+            g1 = reader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))");
+            g2 = g1->buffer(1);
+            g3 = g1->clone();
+        }
+        std::size_t numAllocations = arena->getNumAllocations();
+        ensure(numAllocations > 3);
+
+        // Objects created outside of the scope use the heap
+        auto heap = reader.read("LINESTRING (0 0, 1 1)");
+        auto seq = heap->getCoordinates();
+        ensure_equals(arena->getNumAllocations(), numAllocations);
+
+        g1.reset();
+        std::thread([&g2]() {
+            g2.reset();
+        }).join();
+    }
+
+    ensure_equals(g3->getArea(), 99.5);
+    g3.reset();
+}
+
+// Without an active arena, memory comes from the heap without any
+// header, and heap memory is freed while arenas hold memory
+template<>
+template<>
+void object::test<5>
+()
+{
+    void* p = Arena::allocateCurrent(24);
+    ::operator delete(p);
+
+    Arena arena;
+    std::unique_ptr<geos::geom::Geometry> g;
+    void* q = nullptr;
+    {
+        Arena::Scope scope(&arena);
+        g = reader.read("POINT (1 2)");
+        std::thread([&q]() {
+            q = Arena::allocateCurrent(24);
+        }).join();
+    }
+    ensure(arena.getNumAllocations() > 0);
+    std::size_t numAllocations = arena.getNumAllocations();
+
+    // Allocated on a thread without an active arena
+    ::operator delete(q);
+    auto heap = reader.read("LINESTRING (0 0, 1 1)");
+    heap.reset();
+    ensure_equals(arena.getNumAllocations(), numAllocations);
+
+    g.reset();
+    ensure_equals(arena.getNumAllocations(), 0u);
+}
+
+// The nothrow and aligned forms of operator new are not hidden
+// by the class-level ones
+template<>
+template<>
+void object::test<6>
+()
+{
+    using geos::geom::CoordinateSequence;
+
+    struct alignas(64) AlignedSequence : public CoordinateSequence {};
+
+    Arena arena;
+    {
+        Arena::Scope scope(&arena);
+
+        std::unique_ptr<CoordinateSequence> seq(new (std::nothrow) CoordinateSequence(3u, 2u));
+        ensure(seq != nullptr);
+        ensure_equals(arena.getNumAllocations(), 2u);
+
+        // Over-aligned objects come from the heap
+        std::unique_ptr<AlignedSequence> aligned(new AlignedSequence());
+        ensure_equals(reinterpret_cast<std::uintptr_t>(aligned.get()) % 64, 0u);
+        ensure_equals(arena.getNumAllocations(), 2u);
+
+        std::unique_ptr<AlignedSequence> alignedNoThrow(new (std::nothrow) AlignedSequence());
+        ensure(alignedNoThrow != nullptr);
+        ensure_equals(reinterpret_cast<std::uintptr_t>(alignedNoThrow.get()) % 64, 0u);
+    }
+    ensure_equals(arena.getNumAllocations(), 0u);
+}
+
+} // namespace tut
@@ -0,0 +1,116 @@
+//
+// Test Suite for geos::util::ThreadPool
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/ThreadPool.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_threadpool_data {};
+
+typedef test_group<test_threadpool_data> group;
+typedef group::object object;
+
+group test_threadpool_group("geos::util::ThreadPool");
+
+static std::size_t
+fib(geos::util::ThreadPool& pool, std::size_t n)
+{
+    if (n < 2) {
+        return n;
+    }
+    std::size_t a = 0;
+    geos::util::TaskGroup tasks(pool);
+    tasks.run([&]() { a = fib(pool, n - 1); });
+    std::size_t b = fib(pool, n - 2);
+    tasks.wait();
+    return a + b;
+}
+
+//
+// Test Cases
+//
+
+// parallelFor visits every index exactly once
+template<>
+template<>
+void object::test<1>
+()
+{
+    for (std::size_t numThreads : { 1u, 3u, 8u }) {
+        geos::util::ThreadPool pool(numThreads);
+        ensure_equals(pool.getNumThreads(), numThreads);
+
+        std::vector<int> visits(1000, 0);
+        pool.parallelFor(visits.size(), [&visits](std::size_t i) {
+            visits[i]++;
+        });
+
+        for (int v : visits) {
+            ensure_equals(v, 1);
+        }
+    }
+}
+
+// Nested task groups do not deadlock
+template<>
+template<>
+void object::test<2>
+()
+{
+    geos::util::ThreadPool pool(4);
+    ensure_equals(fib(pool, 20), 6765u);
+}
+
+// The first exception of a group is rethrown by wait()
+template<>
+template<>
+void object::test<3>
+()
+{
+    geos::util::ThreadPool pool(4);
+    std::atomic<int> count(0);
+
+    try {
+        pool.parallelFor(100, [&count](std::size_t i) {
+            count++;
+            if (i == 10) {
+                throw geos::util::IllegalArgumentException("failed");
+            }
+        });
+        fail("exception not propagated");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+    }
+
+    ensure(count > 0);
+
+    // pool is still usable
+    std::atomic<int> sum(0);
+    pool.parallelFor(10, [&sum](std::size_t i) {
+        sum += static_cast<int>(i);
+    });
+    ensure_equals(sum.load(), 45);
+}
+
+// Zero threads uses the hardware concurrency
+template<>
+template<>
+void object::test<4>
+()
+{
+    geos::util::ThreadPool pool(0);
+    ensure_equals(pool.getNumThreads(), geos::util::ThreadPool::defaultNumThreads());
+}
+
+} // namespace tut
@@ -95,10 +95,11 @@ public:
 
 private:
     std::unique_ptr<const PreparedGeometry> m_pg;
-    const Geometry* m_key;
+    const Geometry* m_key = nullptr;
 };
 
-PreparedGeometryCache prepGeomCache;
+// Each thread running operations prepares its own geometries
+thread_local PreparedGeometryCache prepGeomCache;
 
 const std::string catCluster = "Clustering";
 const std::string catConst = "Construction";
@@ -19,13 +19,16 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/operation/valid/MakeValid.h>
 #include <geos/io/GeoJSONWriter.h>
+#include <geos/io/ParallelStreamReader.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTStreamReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKBStreamReader.h>
 #include <geos/io/WKBWriter.h>
+#include <geos/util/ThreadPool.h>
 
+#include <algorithm>
 #include <cfenv>
 #include <fstream>
 #include <iostream>
@@ -90,6 +93,8 @@ int main(int argc, char** argv) {
         ("p,precision", "Set number of decimal places in output coordinates", cxxopts::value<int>( cmdArgs.precision ) )
         ("q,quiet", "Disable result output", cxxopts::value<bool>( cmdArgs.isQuiet ) )
         ("r,repeat", "Repeat operation N times", cxxopts::value<int>( cmdArgs.repeatNum ) )
+        ("readthreads", "Parse input files on N threads (0 = all hardware threads)", cxxopts::value<int>( cmdArgs.readThreads ) )
+        ("threads", "Run operations on N threads (0 = all hardware threads)", cxxopts::value<int>( cmdArgs.numThreads ) )
         ("select", "Select geometries where op result is true", cxxopts::value<bool>( cmdArgs.isSelect ) )
         ("selectNot", "Select geometries where op result is false", cxxopts::value<bool>( cmdArgs.isSelectNot ) )
         ("t,time", "Print execution time", cxxopts::value<bool>( cmdArgs.isShowTime ) )
@@ -235,10 +240,9 @@ bool isWKBLiteral(std::string s) {
     return s.find_first_not_of(hexChars) == std::string::npos;
 }
 
+template<typename Reader>
 std::vector<std::unique_ptr<Geometry>>
-readWKTFile(std::istream& in, int limit, int offset) {
-
-    WKTStreamReader rdr( in );
+readGeometries(Reader& rdr, int limit, int offset) {
     std::vector<std::unique_ptr<Geometry>> geoms;
     int count = 0;
     while (limit < 0 || (int) geoms.size() < limit) {
@@ -254,40 +258,39 @@ readWKTFile(std::istream& in, int limit, int offset) {
 }
 
 std::vector<std::unique_ptr<Geometry>>
-readWKTFile(std::string src, int limit, int offset) {
-    if (src == "-" || src == "-.wkt" || src == "stdin" || src == "stdin.wkt") {
-        return readWKTFile( std::cin, limit, offset );
+readFile(std::istream& in, ParallelStreamReader::Format format, int limit, int offset, int numThreads) {
+    if (numThreads != 1) {
+        ParallelStreamReader rdr( in, format, (std::size_t) std::max(numThreads, 0) );
+        return readGeometries( rdr, limit, offset );
     }
-    std::ifstream f( src );
-    auto geoms = readWKTFile( f, limit, offset );
-    f.close();
-    return geoms;
+    if (format == ParallelStreamReader::Format::WKT) {
+        WKTStreamReader rdr( in );
+        return readGeometries( rdr, limit, offset );
+    }
+    WKBStreamReader rdr( in );
+    return readGeometries( rdr, limit, offset );
 }
 
 std::vector<std::unique_ptr<Geometry>>
-readWKBFile(std::istream& in, int limit, int offset) {
-    WKBStreamReader rdr( in );
-    std::vector<std::unique_ptr<Geometry>> geoms;
-    int count = 0;
-    while (limit < 0 || (int) geoms.size() < limit) {
-        auto geom = rdr.next();
-        if (geom == nullptr)
-            break;
-        if (count > offset) {
-            geoms.push_back(std::move(geom));
-        }
-        count++;
+readWKTFile(std::string src, int limit, int offset, int numThreads) {
+    auto format = ParallelStreamReader::Format::WKT;
+    if (src == "-" || src == "-.wkt" || src == "stdin" || src == "stdin.wkt") {
+        return readFile( std::cin, format, limit, offset, numThreads );
     }
+    std::ifstream f( src );
+    auto geoms = readFile( f, format, limit, offset, numThreads );
+    f.close();
     return geoms;
 }
 
 std::vector<std::unique_ptr<Geometry>>
-readWKBFile(std::string src, int limit, int offset) {
+readWKBFile(std::string src, int limit, int offset, int numThreads) {
+    auto format = ParallelStreamReader::Format::WKB_HEX;
     if (src == "-.wkb" || src == "stdin.wkb" ) {
-        return readWKBFile( std::cin, limit, offset );
+        return readFile( std::cin, format, limit, offset, numThreads );
     }
     std::ifstream f( src );
-    auto geoms = readWKBFile( f, limit, offset );
+    auto geoms = readFile( f, format, limit, offset, numThreads );
     f.close();
     return geoms;
 }
@@ -320,11 +323,11 @@ GeosOp::readInput(std::string name, std::string src, int limit, int offset) {
     }
     else if (endsWith(src, ".wkb")) {
         log(srcDesc + "WKB file " + src);
-        geoms = readWKBFile( src, limit, offset );
+        geoms = readWKBFile( src, limit, offset, args.readThreads );
     }
     else {
         log(srcDesc + "WKT file " + src);
-        geoms = readWKTFile( src, limit, offset );
+        geoms = readWKTFile( src, limit, offset, args.readThreads );
     }
     return geoms;
 }
@@ -427,6 +430,22 @@ void GeosOp::run(OpArguments& opArgs) {
             << "  -- " << formatNum( (long) totalTime ) <<  " usec"
             << "    (GEOS " << geosversion() << ")"
             << std::endl;
+        if (args.numThreads != 1) {
+            std::size_t numThreads = args.numThreads > 0
+                ? (std::size_t) args.numThreads
+                : geos::util::ThreadPool::defaultNumThreads();
+            std::cerr
+                << "Elapsed on " << numThreads << " threads"
+                << "  -- " << formatNum( (long) elapsedTime ) << " usec"
+                << std::endl;
+            for (std::size_t i = 0; i < threadStats.size(); i++) {
+                const ThreadStats& stats = threadStats[i].second;
+                std::cerr
+                    << "  Thread " << (i + 1) << ": " << formatNum( stats.opCount ) << " ops"
+                    << "  -- " << formatNum( (long) stats.time ) << " usec"
+                    << std::endl;
+            }
+        }
     }
 }
 
@@ -449,7 +468,10 @@ GeometryOp* GeosOp::getOp() {
 
 void GeosOp::execute(GeometryOp* op, OpArguments& opArgs) {
 
-    if (op->isBinary()) {
+    if (args.numThreads != 1) {
+        executeParallel(op, opArgs);
+    }
+    else if (op->isBinary()) {
         executeBinary(op, opArgs);
     }
     else {
@@ -489,6 +511,102 @@ std::string inputDesc(std::string name, unsigned int index, const std::unique_pt
     return desc;
 }
 
+/**
+ * Runs the operation on each A geometry (and each B geometry for binary
+ * operations) on a pool of threads.
+ * Operations are run in batches, whose results are output in input order
+ * once the whole batch has completed.
+ */
+void GeosOp::executeParallel(GeometryOp * op, OpArguments& opArgs) {
+    // The number of operations in a batch for each thread
+    constexpr std::size_t OPS_PER_THREAD = 16;
+
+    struct OpResult {
+        std::unique_ptr<Result> result;
+        double time = 0;
+        std::thread::id threadId;
+    };
+
+    geos::util::Profile swElapsed( "elapsed" );
+    swElapsed.start();
+
+    geos::util::ThreadPool pool( (std::size_t) std::max(args.numThreads, 0) );
+
+    std::size_t numB = op->isBinary() ? geomB.size() : 1;
+    std::size_t numOps = geomA.size() * numB;
+    std::size_t batchSize = pool.getNumThreads() * OPS_PER_THREAD;
+    std::vector<OpResult> results( std::min(batchSize, numOps) );
+    const std::unique_ptr<Geometry> noGeom;
+
+    for (std::size_t start = 0; start < numOps; start += batchSize) {
+        std::size_t count = std::min(batchSize, numOps - start);
+
+        pool.parallelFor(count, [&](std::size_t i) {
+            std::size_t index = start + i;
+            const auto& gA = geomA[index / numB];
+            const auto& gB = op->isBinary() ? geomB[index % numB] : noGeom;
+
+            geos::util::Profile sw( "op" );
+            sw.start();
+            std::unique_ptr<Result> result;
+            for (int rep = 0; rep < args.repeatNum; rep++) {
+                result.reset( op->execute( gA, gB, opArgs.arg1, opArgs.arg2 ) );
+            }
+            sw.stop();
+
+            results[i].result = std::move(result);
+            results[i].time = sw.getTot();
+            results[i].threadId = std::this_thread::get_id();
+        });
+
+        for (std::size_t i = 0; i < count; i++) {
+            std::size_t index = start + i;
+            unsigned ia = (unsigned) (index / numB);
+            unsigned ib = (unsigned) (index % numB);
+            const auto& gA = geomA[ia];
+            const auto& gB = op->isBinary() ? geomB[ib] : noGeom;
+            OpResult& res = results[i];
+
+            vertexCount += gA->getNumPoints();
+            if (gB) {
+                vertexCount += gB->getNumPoints();
+            }
+            opCount += args.repeatNum;
+            totalTime += res.time;
+            ThreadStats& stats = getThreadStats(res.threadId);
+            stats.opCount += args.repeatNum;
+            stats.time += res.time;
+
+            if (args.isVerbose) {
+                log(
+                    "[ " + std::to_string(opCount) + "] " + op->name() + ": "
+                    + inputDesc("A", ia, gA) + " "
+                    + inputDesc("B", ib, gB)
+                    + " -> " + res.result->metadata()
+                    + "  --  " + formatNum( (int) res.time ) + " usec"
+                );
+            }
+
+            output(res.result.get(), gA.get());
+            res.result.reset();
+        }
+    }
+
+    swElapsed.stop();
+    elapsedTime = swElapsed.getTot();
+}
+
+GeosOp::ThreadStats& GeosOp::getThreadStats(std::thread::id id) {
+    for (auto& entry : threadStats) {
+        if (entry.first == id) {
+            return entry.second;
+        }
+    }
+    threadStats.emplace_back(id, ThreadStats());
+    return threadStats.back().second;
+}
+
+
 Result* GeosOp::executeOpRepeat(GeometryOp * op,
     unsigned int indexA,
     const std::unique_ptr<Geometry>& gA,
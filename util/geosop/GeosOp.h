@@ -17,6 +17,10 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/PrecisionModel.h>
 
+#include <thread>
+#include <utility>
+#include <vector>
+
 using namespace geos;
 using namespace geos::geom;
 
@@ -42,6 +46,8 @@ public:
     bool isQuiet = false;
     int precision = -1;
     int repeatNum = 1;
+    int readThreads = 1;
+    int numThreads = 1;
 
     //std::string format;
 
@@ -74,6 +80,14 @@ private:
     long opCount = 0;
     std::size_t vertexCount = 0;
     double totalTime = 0;
+    double elapsedTime = 0;
+
+    // Operation count and time of each thread running operations
+    struct ThreadStats {
+        long opCount = 0;
+        double time = 0;
+    };
+    std::vector<std::pair<std::thread::id, ThreadStats>> threadStats;
 
     std::vector<std::unique_ptr<Geometry>> geomA;
 
@@ -85,6 +99,8 @@ private:
     void execute(GeometryOp * op, OpArguments& opArgs);
     void executeUnary(GeometryOp * op, OpArguments& opArgs);
     void executeBinary(GeometryOp * op, OpArguments& opArgs);
+    void executeParallel(GeometryOp * op, OpArguments& opArgs);
+    ThreadStats& getThreadStats(std::thread::id id);
     Result* executeOpRepeat(GeometryOp * op,
         unsigned int indexA, const  std::unique_ptr<Geometry>& geomA,
         unsigned int indexB, const  std::unique_ptr<Geometry>& geomB,